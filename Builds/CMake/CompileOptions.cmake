@@ -12,6 +12,10 @@ if(ROSETTASTONE_WARNINGS_AS_ERRORS)
 	endif()
 endif()
 
+# Count allocations of startup phases by replacing the global operator new
+# NOTE: It affects every program that links the library, so it is off by default.
+option(ROSETTASTONE_COUNT_ALLOCATIONS "Count allocations of startup phases" OFF)
+
 # Get upper case system name
 string(TOUPPER ${CMAKE_SYSTEM_NAME} SYSTEM_NAME_UPPER)
 
@@ -162,6 +166,13 @@ if (CMAKE_CXX_COMPILER_ID MATCHES "GNU" OR CMAKE_SYSTEM_NAME MATCHES "Linux")
 	)
 endif()
 
+# Use librt for POSIX shared memory on linux
+if (CMAKE_SYSTEM_NAME MATCHES "Linux")
+	set(DEFAULT_LINKER_OPTIONS ${DEFAULT_LINKER_OPTIONS}
+		-lrt
+	)
+endif()
+
 # Code coverage - Debug only
 # NOTE: Code coverage results with an optimized (non-Debug) build may be misleading
 if (CMAKE_BUILD_TYPE MATCHES Debug AND (CMAKE_CXX_COMPILER_ID MATCHES "GNU" OR CMAKE_CXX_COMPILER_ID MATCHES "Clang"))
@@ -6,7 +6,9 @@
 
 #include "Console.hpp"
 
+#include <Rosetta/Battlegrounds/Agents/RandomAgent.hpp>
 #include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Managers/GameRunner.hpp>
 #include <Rosetta/Common/Utils.hpp>
 #include <Rosetta/PlayMode/Actions/Choose.hpp>
 #include <Rosetta/PlayMode/Agents/RandomAgent.hpp>
@@ -15,6 +17,7 @@
 #include <Rosetta/PlayMode/Zones/HandZone.hpp>
 
 #include <iostream>
+#include <random>
 
 namespace RosettaStone
 {
@@ -99,6 +102,35 @@ void Console::PlayStandardOrWild(PlayMode::Deck&& deck1, PlayMode::Deck&& deck2)
 
 void Console::PlayBattlegrounds()
 {
+    std::size_t numGames = 0;
+
+    std::cout << "Input the number of games (8 random agents per game): ";
+    std::cin >> numGames;
+
+    Battlegrounds::GameRunner runner([](std::size_t) {
+        return std::make_unique<Battlegrounds::RandomAgent>();
+    });
+
+    const auto stats = runner.Run(numGames, std::random_device{}());
+
+    std::cout << "Games: " << stats.numGames << " (truncated "
+              << stats.numTruncatedGames << ")\n";
+    std::cout << "Games/s: " << stats.GetGamesPerSecond() << '\n';
+    std::cout << "Turns: " << stats.numTurns
+              << ", Actions: " << stats.numActions << '\n';
+    std::cout << "Time (s): select hero " << stats.selectHeroSec
+              << ", recruit " << stats.recruitSec << ", combat "
+              << stats.combatSec << "\n\n";
+
+    for (std::size_t seat = 0; seat < stats.placements.size(); ++seat)
+    {
+        std::cout << "Player " << seat + 1 << " placements:";
+        for (const auto count : stats.placements[seat])
+        {
+            std::cout << ' ' << count;
+        }
+        std::cout << " (average " << stats.GetAveragePlacement(seat) << ")\n";
+    }
 }
 
 void Console::ProcessMulligan(PlayMode::Game& game)
@@ -154,7 +186,8 @@ void Console::ProcessMulliganForComputer(PlayMode::Game& game)
     }
 
     const std::vector<int> intIndices =
-        m_computerAgent->GetActionForMulligan(game);
+        m_computerAgent->GetActionForMulligan(
+            PlayMode::ObservationView(*game.GetPlayer2()));
 
     PlayMode::Generic::ChoiceMulligan(game.GetPlayer2(), intIndices);
 
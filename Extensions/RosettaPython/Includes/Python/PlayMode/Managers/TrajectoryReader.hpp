@@ -0,0 +1,14 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PYTHON_PLAYMODE_TRAJECTORY_READER_HPP
+#define ROSETTASTONE_PYTHON_PLAYMODE_TRAJECTORY_READER_HPP
+
+#include <pybind11/pybind11.h>
+
+void AddTrajectoryReader(pybind11::module& m);
+
+#endif  // ROSETTASTONE_PYTHON_PLAYMODE_TRAJECTORY_READER_HPP
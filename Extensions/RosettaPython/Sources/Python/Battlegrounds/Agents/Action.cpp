@@ -0,0 +1,57 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/Battlegrounds/Agents/Action.hpp>
+#include <Rosetta/Battlegrounds/Agents/Action.hpp>
+
+#include <pybind11/operators.h>
+#include <pybind11/pybind11.h>
+
+using namespace RosettaStone::Battlegrounds;
+
+void AddAction(pybind11::module& m)
+{
+    pybind11::enum_<ActionType>(
+        m, "ActionType",
+        R"pbdoc(An enumerator for identifying the action in recruit phase.)pbdoc")
+        .value("PURCHASE", ActionType::PURCHASE,
+               R"pbdoc(Purchase a minion in Tavern.)pbdoc")
+        .value("SELL", ActionType::SELL,
+               R"pbdoc(Sell a minion on the field.)pbdoc")
+        .value("PLAY", ActionType::PLAY, R"pbdoc(Play a card in hand.)pbdoc")
+        .value("UPGRADE", ActionType::UPGRADE, R"pbdoc(Upgrade Tavern.)pbdoc")
+        .value("REFRESH", ActionType::REFRESH, R"pbdoc(Refresh Tavern.)pbdoc")
+        .value("FREEZE", ActionType::FREEZE, R"pbdoc(Freeze Tavern.)pbdoc")
+        .value("REARRANGE", ActionType::REARRANGE,
+               R"pbdoc(Rearrange a minion on the field.)pbdoc")
+        .value("END_TURN", ActionType::END_TURN,
+               R"pbdoc(Complete recruit.)pbdoc");
+
+    pybind11::class_<Action>(
+        m, "Action",
+        R"pbdoc(This class represents an action of a player in recruit phase.)pbdoc")
+        .def(pybind11::init([](ActionType type, int index, int target) {
+                 return Action{ type, index, target };
+             }),
+             R"pbdoc(Constructs action with given type, index and target.
+
+             Parameters
+             ----------
+             type : The type of action.
+             index : The index of a minion or a card, -1 if not used.
+             target : The target of PLAY or the new index of REARRANGE.)pbdoc",
+             pybind11::arg("type"), pybind11::arg("index") = -1,
+             pybind11::arg("target") = -1)
+        .def_readwrite("type", &Action::type,
+                       R"pbdoc(The type of action.)pbdoc")
+        .def_readwrite("index", &Action::index,
+                       R"pbdoc(The index of a minion or a card.)pbdoc")
+        .def_readwrite(
+            "target", &Action::target,
+            R"pbdoc(The target of PLAY or the new index of REARRANGE.)pbdoc")
+        .def(pybind11::self == pybind11::self)
+        .def(pybind11::self != pybind11::self);
+}
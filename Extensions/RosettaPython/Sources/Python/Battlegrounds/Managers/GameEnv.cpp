@@ -0,0 +1,136 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/Battlegrounds/Managers/GameEnv.hpp>
+#include <Rosetta/Battlegrounds/Managers/GameEnv.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone::Battlegrounds;
+
+void AddGameEnv(pybind11::module& m)
+{
+    using ReleaseGIL = pybind11::call_guard<pybind11::gil_scoped_release>;
+
+    pybind11::class_<GameEnv>(
+        m, "GameEnv",
+        R"pbdoc(This class steps a game of Battlegrounds one recruit action at a time.
+
+        Players of the recruit phase act in the order of seats, and the
+        combat phase runs when the last player ends its turn. Actions can be
+        given as Action or as indices of the fixed action space.)pbdoc")
+        .def(pybind11::init<>(), R"pbdoc(Constructs GameEnv class.)pbdoc")
+        .def_readonly_static("NUM_ACTIONS", &GameEnv::NUM_ACTIONS,
+                             R"pbdoc(The size of the action space.)pbdoc")
+        .def_readonly_static("NUM_OBSERVATIONS", &GameEnv::NUM_OBSERVATIONS,
+                             R"pbdoc(The size of an observation.)pbdoc")
+        .def_static("encode_action", &GameEnv::EncodeAction,
+                    R"pbdoc(Returns the index of the action.
+
+                    Parameters
+                    ----------
+                    action : The action to encode.)pbdoc",
+                    pybind11::arg("action"))
+        .def_static("decode_action", &GameEnv::DecodeAction,
+                    R"pbdoc(Returns the action at the index.
+
+                    Parameters
+                    ----------
+                    action_idx : The index of the action.)pbdoc",
+                    pybind11::arg("action_idx"))
+        .def("set_max_turns", &GameEnv::SetMaxTurns,
+             R"pbdoc(Sets the maximum number of turns of an episode.
+
+             Parameters
+             ----------
+             max_turns : The maximum number of turns.)pbdoc",
+             pybind11::arg("max_turns"))
+        .def("set_max_actions_per_turn", &GameEnv::SetMaxActionsPerTurn,
+             R"pbdoc(Sets the maximum number of actions of a player in a turn.
+
+             Parameters
+             ----------
+             max_actions : The maximum number of actions.)pbdoc",
+             pybind11::arg("max_actions"))
+        .def("reset", &GameEnv::Reset, ReleaseGIL(),
+             R"pbdoc(Starts a new episode and steps until the first recruit phase.
+
+             Parameters
+             ----------
+             seed : The seed of the episode.)pbdoc",
+             pybind11::arg("seed"))
+        .def("legal_actions", &GameEnv::GetLegalActions,
+             R"pbdoc(Returns the legal actions of the current player.)pbdoc")
+        .def(
+            "legal_mask",
+            [](GameEnv& env) {
+                pybind11::array_t<std::uint8_t> mask(GameEnv::NUM_ACTIONS);
+                env.WriteLegalMask(mask.mutable_data());
+                return mask;
+            },
+            R"pbdoc(Returns the mask of legal actions of the current player.)pbdoc")
+        .def("step", &GameEnv::Step, ReleaseGIL(),
+             R"pbdoc(Applies the action of the current player.
+
+             true if the episode is done, and false otherwise.
+
+             Parameters
+             ----------
+             action : The action that is one of legal_actions().)pbdoc",
+             pybind11::arg("action"))
+        .def(
+            "step",
+            [](GameEnv& env, std::size_t actionIdx) {
+                const Action action = GameEnv::DecodeAction(actionIdx);
+                return env.Step(action);
+            },
+            ReleaseGIL(),
+            R"pbdoc(Applies the action at the index of the action space.
+
+            true if the episode is done, and false otherwise.
+
+            Parameters
+            ----------
+            action_idx : The index of a legal action.)pbdoc",
+            pybind11::arg("action_idx"))
+        .def(
+            "advance_phase", &GameEnv::AdvancePhase, ReleaseGIL(),
+            R"pbdoc(Ends the turns of the remaining players and runs the combat phase.)pbdoc")
+        .def(
+            "observation",
+            [](const GameEnv& env, std::size_t seatIdx) {
+                pybind11::array_t<float> observation(
+                    GameEnv::NUM_OBSERVATIONS);
+                env.WriteObservation(seatIdx, observation.mutable_data());
+                return observation;
+            },
+            R"pbdoc(Returns the observation of the player in the given seat.
+
+            Parameters
+            ----------
+            seat_idx : The index of the player in the game.)pbdoc",
+            pybind11::arg("seat_idx"))
+        .def("reward", &GameEnv::GetReward,
+             R"pbdoc(Returns the reward of the player in the given seat.
+
+             Parameters
+             ----------
+             seat_idx : The index of the player in the game.)pbdoc",
+             pybind11::arg("seat_idx"))
+        .def_property_readonly("current_player", &GameEnv::GetCurrentPlayerIdx,
+                               R"pbdoc(The index of the player to act.)pbdoc")
+        .def_property_readonly(
+            "num_turns", &GameEnv::GetNumTurns,
+            R"pbdoc(The number of recruit phases of the episode.)pbdoc")
+        .def_property_readonly(
+            "is_done", &GameEnv::IsDone,
+            R"pbdoc(The flag indicates the episode is done.)pbdoc")
+        .def_property_readonly(
+            "is_truncated", &GameEnv::IsTruncated,
+            R"pbdoc(The flag indicates the episode reached the maximum number of turns.)pbdoc");
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/Battlegrounds/Managers/VectorEnv.hpp>
+#include <Rosetta/Battlegrounds/Managers/VectorEnv.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+namespace
+{
+//! Returns a new numpy array of (num_envs, \p numColumns) of \p env.
+template <typename T>
+pybind11::array_t<T> MakeArray(const VectorEnv& env, std::size_t numColumns)
+{
+    return pybind11::array_t<T>({ env.GetNumEnvs(), numColumns });
+}
+
+//! Returns a new numpy array of (num_envs) of \p env.
+template <typename T>
+pybind11::array_t<T> MakeArray(const VectorEnv& env)
+{
+    return pybind11::array_t<T>(env.GetNumEnvs());
+}
+}  // namespace
+
+void AddVectorEnv(pybind11::module& m)
+{
+    pybind11::class_<VectorEnv>(
+        m, "VectorEnv",
+        R"pbdoc(This class steps a number of GameEnv at once in C++.
+
+        step() and reset() release the GIL while environments are stepped,
+        optionally on a thread pool. An environment whose episode is done is
+        reset in the same step, so the observation and the mask belong to the
+        new episode while the rewards and the flag belong to the finished one.
+
+        Calls are serialized, and each call returns new arrays of its own
+        outputs, so the environment can be stepped from several threads.
+
+        An illegal action raises before any environment is changed. If a call
+        raises after that, the environments no longer match the outputs, so
+        step() raises until reset() succeeds. step() also raises before the
+        first reset().)pbdoc")
+        .def(pybind11::init<std::size_t, std::size_t>(),
+             R"pbdoc(Constructs VectorEnv with given num_envs and num_threads.
+
+             Parameters
+             ----------
+             num_envs : The number of environments.
+             num_threads : The number of worker threads. If it is 0, the number of hardware threads is used.)pbdoc",
+             pybind11::arg("num_envs"), pybind11::arg("num_threads") = 1)
+        .def("set_max_turns", &VectorEnv::SetMaxTurns,
+             R"pbdoc(Sets the maximum number of turns of an episode.
+
+             Parameters
+             ----------
+             max_turns : The maximum number of turns.)pbdoc",
+             pybind11::arg("max_turns"))
+        .def("set_max_actions_per_turn", &VectorEnv::SetMaxActionsPerTurn,
+             R"pbdoc(Sets the maximum number of actions of a player in a turn.
+
+             Parameters
+             ----------
+             max_actions : The maximum number of actions.)pbdoc",
+             pybind11::arg("max_actions"))
+        .def(
+            "reset",
+            [](VectorEnv& env, unsigned int seed) {
+                auto observations =
+                    MakeArray<float>(env, GameEnv::NUM_OBSERVATIONS);
+                auto legalMasks =
+                    MakeArray<std::uint8_t>(env, GameEnv::NUM_ACTIONS);
+                auto currentPlayers = MakeArray<std::int32_t>(env);
+
+                VectorEnvOutputs outputs;
+                outputs.observations = observations.mutable_data();
+                outputs.legalMasks = legalMasks.mutable_data();
+                outputs.currentPlayers = currentPlayers.mutable_data();
+
+                // NOTE: The outputs are copied before the step lock is
+                // released, so they belong to this call even if another
+                // thread steps the environment after it.
+                {
+                    pybind11::gil_scoped_release release;
+                    env.Reset(seed, outputs);
+                }
+
+                return pybind11::make_tuple(observations, legalMasks,
+                                            currentPlayers);
+            },
+            R"pbdoc(Starts new episodes of all environments.
+
+            (observations, legal_masks, current_players)
+
+            Parameters
+            ----------
+            seed : The seed that the seeds of episodes are derived from.)pbdoc",
+            pybind11::arg("seed"))
+        .def(
+            "step",
+            [](VectorEnv& env,
+               const pybind11::array_t<std::int32_t,
+                                       pybind11::array::c_style |
+                                           pybind11::array::forcecast>&
+                   actions) {
+                if (static_cast<std::size_t>(actions.size()) !=
+                    env.GetNumEnvs())
+                {
+                    throw std::invalid_argument(
+                        "The number of actions must be num_envs");
+                }
+
+                auto observations =
+                    MakeArray<float>(env, GameEnv::NUM_OBSERVATIONS);
+                auto rewards =
+                    MakeArray<float>(env, NUM_BATTLEGROUNDS_PLAYERS);
+                auto dones = MakeArray<std::uint8_t>(env);
+                auto legalMasks =
+                    MakeArray<std::uint8_t>(env, GameEnv::NUM_ACTIONS);
+                auto currentPlayers = MakeArray<std::int32_t>(env);
+
+                VectorEnvOutputs outputs;
+                outputs.observations = observations.mutable_data();
+                outputs.legalMasks = legalMasks.mutable_data();
+                outputs.currentPlayers = currentPlayers.mutable_data();
+                outputs.rewards = rewards.mutable_data();
+                outputs.dones = dones.mutable_data();
+
+                {
+                    pybind11::gil_scoped_release release;
+                    env.Step(actions.data(), outputs);
+                }
+
+                return pybind11::make_tuple(observations, rewards, dones,
+                                            legalMasks, currentPlayers);
+            },
+            R"pbdoc(Applies an action to each environment.
+
+            (observations, rewards, dones, legal_masks, current_players)
+
+            Parameters
+            ----------
+            actions : The indices of legal actions of all environments.)pbdoc",
+            pybind11::arg("actions"))
+        .def_property_readonly("num_envs", &VectorEnv::GetNumEnvs,
+                               R"pbdoc(The number of environments.)pbdoc")
+        .def("env", &VectorEnv::GetEnv,
+             pybind11::return_value_policy::reference_internal,
+             R"pbdoc(Returns the environment at env_idx.
+
+             Parameters
+             ----------
+             env_idx : The index of environment.)pbdoc",
+             pybind11::arg("env_idx"));
+}
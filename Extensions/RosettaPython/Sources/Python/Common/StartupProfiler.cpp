@@ -0,0 +1,47 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/Common/StartupProfiler.hpp>
+#include <Rosetta/Common/StartupProfiler.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone;
+
+void AddStartupProfiler(pybind11::module& m)
+{
+    pybind11::class_<StartupPhase>(
+        m, "StartupPhase",
+        R"pbdoc(This structure stores the wall time and the allocations of a startup phase.)pbdoc")
+        .def_readonly("name", &StartupPhase::name)
+        .def_readonly("depth", &StartupPhase::depth)
+        .def_readonly("num_calls", &StartupPhase::numCalls)
+        .def_readonly("elapsed_ms", &StartupPhase::elapsedMs)
+        .def_readonly("num_allocations", &StartupPhase::numAllocations)
+        .def_readonly("allocated_bytes", &StartupPhase::allocatedBytes);
+
+    pybind11::class_<StartupProfiler>(
+        m, "StartupProfiler",
+        R"pbdoc(This class records the startup phases such as loading cards.)pbdoc")
+        .def_static("phases", &StartupProfiler::GetPhases,
+                    R"pbdoc(Returns a list of recorded phases.)pbdoc")
+        .def_static("find_phase", &StartupProfiler::FindPhase,
+                    R"pbdoc(Returns a phase that matches name.
+
+                    Parameters
+                    ----------
+                    name : The name of the phase.)pbdoc",
+                    pybind11::arg("name"))
+        .def_static(
+            "is_counting_allocations", &StartupProfiler::IsCountingAllocations,
+            R"pbdoc(Returns whether allocations of phases are counted.)pbdoc")
+        .def_static("reset", &StartupProfiler::Reset,
+                    R"pbdoc(Clears all recorded phases.)pbdoc")
+        .def_static(
+            "to_string", &StartupProfiler::ToString,
+            R"pbdoc(Returns the recorded phases as a human-readable table.)pbdoc");
+}
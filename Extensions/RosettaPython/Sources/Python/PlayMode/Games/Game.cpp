@@ -0,0 +1,60 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace RosettaStone::PlayMode;
+
+void AddGame(pybind11::module& m)
+{
+    using ReleaseGIL = pybind11::call_guard<pybind11::gil_scoped_release>;
+
+    pybind11::class_<Game>(
+        m, "Game",
+        R"pbdoc(This class processes a game of Hearthstone.
+
+        Players are owned by the game, so they are valid while the game is
+        alive. Actions of the current player are applied by the functions of
+        player tasks such as play_card() and end_turn().)pbdoc")
+        .def(pybind11::init<const GameConfig&>(),
+             R"pbdoc(Constructs Game with given game_config.
+
+             Parameters
+             ----------
+             game_config : The configuration of the game.)pbdoc",
+             pybind11::arg("game_config"))
+        .def("start", &Game::Start, ReleaseGIL(),
+             R"pbdoc(Starts the game.)pbdoc")
+        .def("process_until", &Game::ProcessUntil, ReleaseGIL(),
+             R"pbdoc(Processes steps of the game until the step.
+
+             Parameters
+             ----------
+             step : The step to stop at.)pbdoc",
+             pybind11::arg("step"))
+        .def("player1", &Game::GetPlayer1,
+             pybind11::return_value_policy::reference_internal,
+             R"pbdoc(Returns the first player.)pbdoc")
+        .def("player2", &Game::GetPlayer2,
+             pybind11::return_value_policy::reference_internal,
+             R"pbdoc(Returns the second player.)pbdoc")
+        .def("current_player", &Game::GetCurrentPlayer,
+             pybind11::return_value_policy::reference_internal,
+             R"pbdoc(Returns the player who has the turn.)pbdoc")
+        .def("opponent_player", &Game::GetOpponentPlayer,
+             pybind11::return_value_policy::reference_internal,
+             R"pbdoc(Returns the opponent of the current player.)pbdoc")
+        .def("turn", &Game::GetTurn,
+             R"pbdoc(Returns the turn of the game.)pbdoc")
+        .def_readonly("state", &Game::state,
+                      R"pbdoc(The state of the game.)pbdoc")
+        .def_readonly("step", &Game::step,
+                      R"pbdoc(The current step of the game.)pbdoc");
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+//! Returns the cards of \p deck except empty slots.
+std::vector<Card*> GetDeck(const std::array<Card*, START_DECK_SIZE>& deck)
+{
+    std::vector<Card*> cards;
+    for (const auto& card : deck)
+    {
+        if (card)
+        {
+            cards.emplace_back(card);
+        }
+    }
+
+    return cards;
+}
+
+//! Sets \p cards to \p deck and fills the rest with empty slots.
+void SetDeck(std::array<Card*, START_DECK_SIZE>& deck,
+             const std::vector<Card*>& cards)
+{
+    if (cards.size() > deck.size())
+    {
+        throw std::invalid_argument("A deck can't have more than 30 cards");
+    }
+
+    deck.fill(nullptr);
+    std::copy(cards.begin(), cards.end(), deck.begin());
+}
+}  // namespace
+
+void AddGameConfig(pybind11::module& m)
+{
+    pybind11::class_<GameConfig>(
+        m, "GameConfig",
+        R"pbdoc(This class holds all configuration values to create a new Game.)pbdoc")
+        .def(pybind11::init<>(), R"pbdoc(Constructs GameConfig class.)pbdoc")
+        .def_readwrite("format_type", &GameConfig::formatType,
+                       R"pbdoc(The format type of the game.)pbdoc")
+        .def_readwrite("start_player", &GameConfig::startPlayer,
+                       R"pbdoc(The player who starts the game.)pbdoc")
+        .def_readwrite("player1_class", &GameConfig::player1Class,
+                       R"pbdoc(The class of the first player.)pbdoc")
+        .def_readwrite("player2_class", &GameConfig::player2Class,
+                       R"pbdoc(The class of the second player.)pbdoc")
+        .def_property(
+            "player1_deck",
+            [](const GameConfig& config) {
+                return GetDeck(config.player1Deck);
+            },
+            [](GameConfig& config, const std::vector<Card*>& cards) {
+                SetDeck(config.player1Deck, cards);
+            },
+            pybind11::return_value_policy::reference,
+            R"pbdoc(The cards of the deck of the first player.)pbdoc")
+        .def_property(
+            "player2_deck",
+            [](const GameConfig& config) {
+                return GetDeck(config.player2Deck);
+            },
+            [](GameConfig& config, const std::vector<Card*>& cards) {
+                SetDeck(config.player2Deck, cards);
+            },
+            pybind11::return_value_policy::reference,
+            R"pbdoc(The cards of the deck of the second player.)pbdoc")
+        .def_readwrite("fill_card_ids", &GameConfig::fillCardIDs,
+                       R"pbdoc(The IDs of cards to fill decks.)pbdoc")
+        .def_readwrite("do_fill_decks", &GameConfig::doFillDecks,
+                       R"pbdoc(Whether to fill decks with fill_card_ids.)pbdoc")
+        .def_readwrite("do_shuffle", &GameConfig::doShuffle,
+                       R"pbdoc(Whether to shuffle decks.)pbdoc")
+        .def_readwrite("skip_mulligan", &GameConfig::skipMulligan,
+                       R"pbdoc(Whether to skip mulligan.)pbdoc")
+        .def_readwrite("auto_run", &GameConfig::autoRun,
+                       R"pbdoc(Whether to run steps of the game automatically.)pbdoc");
+}
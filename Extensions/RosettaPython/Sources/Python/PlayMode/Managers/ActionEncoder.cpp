@@ -0,0 +1,99 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Managers/ActionEncoder.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Managers/ActionEncoder.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone::PlayMode;
+
+void AddActionEncoder(pybind11::module& m)
+{
+    pybind11::class_<ActionEncoder>(
+        m, "ActionEncoder",
+        R"pbdoc(This class maps an action to an index of a fixed action space and back.
+
+        An index is legal if and only if its action is in legal_actions().
+        See the offsets for the layout.)pbdoc")
+        .def(pybind11::init<std::size_t>(),
+             R"pbdoc(Constructs ActionEncoder with given num_threads.
+
+             Parameters
+             ----------
+             num_threads : The number of worker threads of mask_batch(). If it is 0, the number of hardware threads is used.)pbdoc",
+             pybind11::arg("num_threads") = 1)
+        .def_readonly_static("NUM_ACTIONS", &ActionEncoder::NUM_ACTIONS,
+                             R"pbdoc(The size of the action space.)pbdoc")
+        .def_readonly_static("PLAY_CARD_OFFSET",
+                             &ActionEncoder::PLAY_CARD_OFFSET,
+                             R"pbdoc(The offset of PLAY_CARD actions.)pbdoc")
+        .def_readonly_static("ATTACK_OFFSET", &ActionEncoder::ATTACK_OFFSET,
+                             R"pbdoc(The offset of ATTACK actions.)pbdoc")
+        .def_readonly_static("HERO_POWER_OFFSET",
+                             &ActionEncoder::HERO_POWER_OFFSET,
+                             R"pbdoc(The offset of HERO_POWER actions.)pbdoc")
+        .def_readonly_static("TRADE_CARD_OFFSET",
+                             &ActionEncoder::TRADE_CARD_OFFSET,
+                             R"pbdoc(The offset of TRADE_CARD actions.)pbdoc")
+        .def_readonly_static("CHOOSE_OFFSET", &ActionEncoder::CHOOSE_OFFSET,
+                             R"pbdoc(The offset of CHOOSE actions.)pbdoc")
+        .def_readonly_static("END_TURN_OFFSET",
+                             &ActionEncoder::END_TURN_OFFSET,
+                             R"pbdoc(The index of END_TURN action.)pbdoc")
+        .def_static("encode", &ActionEncoder::Encode,
+                    R"pbdoc(Returns the index of the action.
+
+                    Parameters
+                    ----------
+                    action : The action to encode.)pbdoc",
+                    pybind11::arg("action"))
+        .def_static("decode", &ActionEncoder::Decode,
+                    R"pbdoc(Returns the action at the index.
+
+                    Parameters
+                    ----------
+                    action_idx : The index in the action space.)pbdoc",
+                    pybind11::arg("action_idx"))
+        .def_static(
+            "mask",
+            [](Game& game) {
+                pybind11::array_t<bool> mask(ActionEncoder::NUM_ACTIONS);
+                ActionEncoder::WriteMask(
+                    game, reinterpret_cast<std::uint8_t*>(mask.mutable_data()));
+                return mask;
+            },
+            R"pbdoc(Returns the mask of legal actions of the current player.
+
+            Parameters
+            ----------
+            game : The game in main action step.)pbdoc",
+            pybind11::arg("game"))
+        .def(
+            "mask_batch",
+            [](ActionEncoder& encoder, const std::vector<Game*>& games) {
+                pybind11::array_t<bool> masks(
+                    { games.size(), ActionEncoder::NUM_ACTIONS });
+                auto data =
+                    reinterpret_cast<std::uint8_t*>(masks.mutable_data());
+
+                {
+                    pybind11::gil_scoped_release release;
+                    encoder.WriteMaskBatch(games, data);
+                }
+
+                return masks;
+            },
+            R"pbdoc(Returns the masks of legal actions of the current players of the games.
+
+            Parameters
+            ----------
+            games : The games to write.)pbdoc",
+            pybind11::arg("games"));
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Managers/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Managers/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone::PlayMode;
+
+void AddObservationEncoder(pybind11::module& m)
+{
+    pybind11::class_<ObservationEncoder>(
+        m, "ObservationEncoder",
+        R"pbdoc(This class writes the view of a player into a fixed-size float tensor.
+
+        An observation consists of the turn, the block of the player, the
+        block of the opponent and the cards in hand of the player. See the
+        offsets and the sizes of features for the layout.)pbdoc")
+        .def(pybind11::init<std::size_t>(),
+             R"pbdoc(Constructs ObservationEncoder with given num_threads.
+
+             Parameters
+             ----------
+             num_threads : The number of worker threads of encode_batch(). If it is 0, the number of hardware threads is used.)pbdoc",
+             pybind11::arg("num_threads") = 1)
+        .def_readonly_static("NUM_FEATURES", &ObservationEncoder::NUM_FEATURES,
+                             R"pbdoc(The size of an observation.)pbdoc")
+        .def_readonly_static("NUM_PLAYER_FEATURES",
+                             &ObservationEncoder::NUM_PLAYER_FEATURES,
+                             R"pbdoc(The number of player features.)pbdoc")
+        .def_readonly_static("NUM_HERO_FEATURES",
+                             &ObservationEncoder::NUM_HERO_FEATURES,
+                             R"pbdoc(The number of hero features.)pbdoc")
+        .def_readonly_static("NUM_HERO_POWER_FEATURES",
+                             &ObservationEncoder::NUM_HERO_POWER_FEATURES,
+                             R"pbdoc(The number of hero power features.)pbdoc")
+        .def_readonly_static("NUM_WEAPON_FEATURES",
+                             &ObservationEncoder::NUM_WEAPON_FEATURES,
+                             R"pbdoc(The number of weapon features.)pbdoc")
+        .def_readonly_static("NUM_MINION_FEATURES",
+                             &ObservationEncoder::NUM_MINION_FEATURES,
+                             R"pbdoc(The number of features of a minion.)pbdoc")
+        .def_readonly_static("NUM_HAND_FEATURES",
+                             &ObservationEncoder::NUM_HAND_FEATURES,
+                             R"pbdoc(The number of features of a card in hand.)pbdoc")
+        .def_readonly_static("PLAYER_OFFSET",
+                             &ObservationEncoder::PLAYER_OFFSET,
+                             R"pbdoc(The offset of the block of the player.)pbdoc")
+        .def_readonly_static("OPPONENT_OFFSET",
+                             &ObservationEncoder::OPPONENT_OFFSET,
+                             R"pbdoc(The offset of the block of the opponent.)pbdoc")
+        .def_readonly_static("HAND_OFFSET", &ObservationEncoder::HAND_OFFSET,
+                             R"pbdoc(The offset of the cards in hand.)pbdoc")
+        .def_static(
+            "encode",
+            [](const Player& player) {
+                pybind11::array_t<float> observation(
+                    ObservationEncoder::NUM_FEATURES);
+                ObservationEncoder::Encode(player, observation.mutable_data());
+                return observation;
+            },
+            R"pbdoc(Returns the view of the player.
+
+            Parameters
+            ----------
+            player : The player who observes the game.)pbdoc",
+            pybind11::arg("player"))
+        .def(
+            "encode_batch",
+            [](ObservationEncoder& encoder, const std::vector<Game*>& games) {
+                pybind11::array_t<float> observations(
+                    { games.size(), ObservationEncoder::NUM_FEATURES });
+                float* data = observations.mutable_data();
+
+                {
+                    pybind11::gil_scoped_release release;
+                    encoder.EncodeBatch(games, data);
+                }
+
+                return observations;
+            },
+            R"pbdoc(Returns the views of the current players of the games.
+
+            Parameters
+            ----------
+            games : The games to encode.)pbdoc",
+            pybind11::arg("games"));
+}
@@ -0,0 +1,96 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Managers/TrajectoryReader.hpp>
+#include <Rosetta/PlayMode/Managers/TrajectoryReader.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace RosettaStone::PlayMode;
+
+namespace
+{
+//! Moves \p values to a new numpy array of \p shape without copy.
+template <typename T, typename U = T>
+pybind11::array_t<T> ToArray(std::vector<U>&& values,
+                             std::vector<std::size_t> shape)
+{
+    auto* owner = new std::vector<U>(std::move(values));
+    pybind11::capsule base(owner, [](void* ptr) {
+        delete static_cast<std::vector<U>*>(ptr);
+    });
+
+    return pybind11::array_t<T>(std::move(shape),
+                                reinterpret_cast<const T*>(owner->data()),
+                                base);
+}
+}  // namespace
+
+void AddTrajectoryReader(pybind11::module& m)
+{
+    pybind11::class_<TrajectoryReader>(
+        m, "TrajectoryReader",
+        R"pbdoc(This class maps a trajectory file read-only and decompresses its chunks on demand.)pbdoc")
+        .def(pybind11::init<>(),
+             R"pbdoc(Constructs TrajectoryReader that isn't opened.)pbdoc")
+        .def("open", &TrajectoryReader::Open,
+             R"pbdoc(Maps the trajectory file at path read-only.
+
+             Parameters
+             ----------
+             path : The path of the file to map.)pbdoc",
+             pybind11::arg("path"))
+        .def("close", &TrajectoryReader::Close,
+             R"pbdoc(Unmaps the trajectory file.)pbdoc")
+        .def_property_readonly("is_open", &TrajectoryReader::IsOpen,
+                               R"pbdoc(Whether the file is mapped.)pbdoc")
+        .def_property_readonly("num_chunks", &TrajectoryReader::GetNumChunks,
+                               R"pbdoc(The number of complete chunks.)pbdoc")
+        .def_property_readonly(
+            "num_steps",
+            pybind11::overload_cast<>(&TrajectoryReader::GetNumSteps,
+                                      pybind11::const_),
+            R"pbdoc(The number of steps in complete chunks.)pbdoc")
+        .def(
+            "read_chunk",
+            [](const TrajectoryReader& reader, std::size_t chunkIdx) {
+                TrajectoryChunk chunk;
+                {
+                    pybind11::gil_scoped_release release;
+                    reader.ReadChunk(chunkIdx, chunk);
+                }
+
+                const std::size_t numSteps = chunk.numSteps;
+                pybind11::dict columns;
+                columns["observations"] = ToArray<float>(
+                    std::move(chunk.observations),
+                    { numSteps, reader.GetNumFeatures() });
+                columns["envs"] =
+                    ToArray<std::uint32_t>(std::move(chunk.envs), { numSteps });
+                columns["actions"] = ToArray<std::int32_t>(
+                    std::move(chunk.actions), { numSteps });
+                columns["action_masks"] = ToArray<bool>(
+                    std::move(chunk.actionMasks),
+                    { numSteps, reader.GetNumActions() });
+                columns["rewards"] =
+                    ToArray<float>(std::move(chunk.rewards), { numSteps });
+                columns["dones"] =
+                    ToArray<bool>(std::move(chunk.dones), { numSteps });
+
+                return columns;
+            },
+            R"pbdoc(Returns the columns of the chunk as a dict of numpy arrays.
+
+            Parameters
+            ----------
+            chunk_idx : The index of the chunk.)pbdoc",
+            pybind11::arg("chunk_idx"));
+}
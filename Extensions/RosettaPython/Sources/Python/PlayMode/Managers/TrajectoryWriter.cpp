@@ -0,0 +1,100 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Managers/TrajectoryWriter.hpp>
+#include <Rosetta/PlayMode/Managers/ActionEncoder.hpp>
+#include <Rosetta/PlayMode/Managers/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Managers/TrajectoryWriter.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+using namespace RosettaStone::PlayMode;
+
+namespace
+{
+template <typename T>
+using Array =
+    pybind11::array_t<T, pybind11::array::c_style | pybind11::array::forcecast>;
+
+//! Throws std::invalid_argument if \p array doesn't have \p size elements.
+template <typename T>
+void CheckSize(const Array<T>& array, std::size_t size, const char* name)
+{
+    if (static_cast<std::size_t>(array.size()) != size)
+    {
+        throw std::invalid_argument(std::string("Invalid size of ") + name);
+    }
+}
+}  // namespace
+
+void AddTrajectoryWriter(pybind11::module& m)
+{
+    pybind11::class_<TrajectoryWriter>(
+        m, "TrajectoryWriter",
+        R"pbdoc(This class appends steps of self-play to a trajectory file.
+
+        Full chunks are compressed and written by a background thread. When
+        max_pending_chunks full chunks wait to be written, append_batch()
+        blocks until one is written. Otherwise it never waits for I/O.)pbdoc")
+        .def(pybind11::init<const std::string&, std::size_t, std::size_t>(),
+             R"pbdoc(Constructs TrajectoryWriter that creates the file at path.
+
+             Parameters
+             ----------
+             path : The path of the file to write.
+             chunk_size : The number of steps in a chunk.
+             max_pending_chunks : The maximum number of full chunks that wait to be written.)pbdoc",
+             pybind11::arg("path"), pybind11::arg("chunk_size") = 4096,
+             pybind11::arg("max_pending_chunks") = 4)
+        .def(
+            "append_batch",
+            [](TrajectoryWriter& writer, const Array<float>& observations,
+               const Array<std::int32_t>& actionIndices,
+               const Array<std::uint8_t>& actionMasks,
+               const Array<float>& rewards, const Array<std::uint8_t>& dones) {
+                const auto numEnvs = static_cast<std::size_t>(dones.size());
+                CheckSize(observations,
+                          numEnvs * ObservationEncoder::NUM_FEATURES,
+                          "observations");
+                CheckSize(actionIndices, numEnvs, "action_indices");
+                CheckSize(actionMasks, numEnvs * ActionEncoder::NUM_ACTIONS,
+                          "action_masks");
+                CheckSize(rewards, numEnvs, "rewards");
+
+                pybind11::gil_scoped_release release;
+                writer.AppendBatch(numEnvs, observations.data(),
+                                   actionIndices.data(), actionMasks.data(),
+                                   rewards.data(), dones.data());
+            },
+            R"pbdoc(Appends a step of each environment in the order of environments.
+
+            Parameters
+            ----------
+            observations : The observations of (num_envs, NUM_FEATURES).
+            action_indices : The indices of actions of (num_envs).
+            action_masks : The masks of (num_envs, NUM_ACTIONS).
+            rewards : The rewards of (num_envs).
+            dones : The flags of (num_envs).)pbdoc",
+            pybind11::arg("observations"), pybind11::arg("action_indices"),
+            pybind11::arg("action_masks"), pybind11::arg("rewards"),
+            pybind11::arg("dones"))
+        .def("flush", &TrajectoryWriter::Flush,
+             pybind11::call_guard<pybind11::gil_scoped_release>(),
+             R"pbdoc(Writes all appended steps and waits until they are written and flushed.)pbdoc")
+        .def("close", &TrajectoryWriter::Close,
+             pybind11::call_guard<pybind11::gil_scoped_release>(),
+             R"pbdoc(Writes all appended steps and closes the file.)pbdoc")
+        .def_property_readonly("num_steps", &TrajectoryWriter::GetNumSteps,
+                               R"pbdoc(The number of appended steps.)pbdoc")
+        .def_property_readonly(
+            "num_bytes", &TrajectoryWriter::GetNumBytes,
+            R"pbdoc(The number of bytes written to the file.)pbdoc");
+}
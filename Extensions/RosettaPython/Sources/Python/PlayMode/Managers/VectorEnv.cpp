@@ -0,0 +1,183 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Managers/VectorEnv.hpp>
+#include <Rosetta/PlayMode/Managers/VectorEnv.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace RosettaStone::PlayMode;
+
+namespace
+{
+//! Returns a read-only numpy view of \p values of \p shape. The view keeps
+//! \p owner alive and doesn't copy the values.
+template <typename T, typename U = T>
+pybind11::array_t<T> ToView(const std::vector<U>& values,
+                            std::vector<std::size_t> shape,
+                            pybind11::handle owner)
+{
+    static_assert(sizeof(T) == sizeof(U));
+
+    pybind11::array_t<T> view(std::move(shape),
+                              reinterpret_cast<const T*>(values.data()), owner);
+    view.attr("setflags")(pybind11::arg("write") = false);
+
+    return view;
+}
+
+//! Returns the views of the observations of \p self.
+pybind11::array_t<float> ToObservations(pybind11::handle self)
+{
+    const auto& env = self.cast<const VectorEnv&>();
+    return ToView<float>(env.GetObservations(),
+                         { env.GetNumEnvs(), ObservationEncoder::NUM_FEATURES },
+                         self);
+}
+
+//! Returns the views of the outputs of the last step of \p self of
+//! (observations, rewards, dones, current_players, turns).
+pybind11::tuple ToStepOutputs(pybind11::handle self)
+{
+    const auto& env = self.cast<const VectorEnv&>();
+    const std::size_t numEnvs = env.GetNumEnvs();
+
+    return pybind11::make_tuple(
+        ToObservations(self),
+        ToView<float>(env.GetRewards(), { numEnvs, 2 }, self),
+        ToView<bool>(env.GetDones(), { numEnvs }, self),
+        ToView<std::int32_t>(env.GetCurrentPlayers(), { numEnvs }, self),
+        ToView<std::int32_t>(env.GetTurns(), { numEnvs }, self));
+}
+}  // namespace
+
+void AddPlayModeVectorEnv(pybind11::module& m)
+{
+    pybind11::class_<VectorEnv>(
+        m, "VectorEnv",
+        R"pbdoc(This class owns a number of games and steps all of them at once in C++.
+
+        step() and reset() release the GIL while games are stepped, optionally
+        on a thread pool. A game that is done is restarted in the same step,
+        so the observation, the current player, the turn and the legal actions
+        belong to the new game while the rewards and the flag belong to the
+        finished one.
+
+        Outputs are read-only numpy views of double-buffered arrays owned by
+        the environment, so nothing is copied. The arrays of a call stay valid
+        during the next call and are overwritten by the call after next. Copy
+        them to keep them longer. legal_actions() is decoded from the same
+        masks, so it can be read on another thread while a call runs.
+
+        An illegal action raises before any game is changed. If a call raises
+        after that, the games no longer match the outputs, so step() raises
+        until reset() succeeds.)pbdoc")
+        .def(pybind11::init<const GameConfig&, std::size_t, std::size_t>(),
+             R"pbdoc(Constructs VectorEnv with given game_config, num_envs and num_threads.
+
+             Parameters
+             ----------
+             game_config : The configuration of games. Games always run automatically and skip mulligan.
+             num_envs : The number of games.
+             num_threads : The number of worker threads. If it is 0, the number of hardware threads is used.)pbdoc",
+             pybind11::arg("game_config"), pybind11::arg("num_envs"),
+             pybind11::arg("num_threads") = 1)
+        .def("set_max_turns", &VectorEnv::SetMaxTurns,
+             R"pbdoc(Sets the maximum number of turns of a game.
+
+             Parameters
+             ----------
+             max_turns : The maximum number of turns.)pbdoc",
+             pybind11::arg("max_turns"))
+        .def(
+            "reset",
+            [](pybind11::object self, unsigned int seed) {
+                auto& env = self.cast<VectorEnv&>();
+                {
+                    pybind11::gil_scoped_release release;
+                    env.Reset(seed);
+                }
+
+                const pybind11::tuple outputs = ToStepOutputs(self);
+                return pybind11::make_tuple(outputs[0], outputs[3],
+                                            outputs[4]);
+            },
+            R"pbdoc(Starts new games.
+
+            (observations, current_players, turns)
+
+            Parameters
+            ----------
+            seed : The seed that the seeds of games are derived from.)pbdoc",
+            pybind11::arg("seed"))
+        .def(
+            "step",
+            [](pybind11::object self, const std::vector<Action>& actions) {
+                auto& env = self.cast<VectorEnv&>();
+                {
+                    pybind11::gil_scoped_release release;
+                    env.Step(actions);
+                }
+
+                return ToStepOutputs(self);
+            },
+            R"pbdoc(Applies an action of the current player to each game.
+
+            (observations, rewards, dones, current_players, turns)
+
+            Parameters
+            ----------
+            actions : The legal actions of all games.)pbdoc",
+            pybind11::arg("actions"))
+        .def(
+            "step",
+            [](pybind11::object self,
+               const std::vector<std::size_t>& actionIndices) {
+                auto& env = self.cast<VectorEnv&>();
+                {
+                    pybind11::gil_scoped_release release;
+                    env.Step(actionIndices);
+                }
+
+                return ToStepOutputs(self);
+            },
+            R"pbdoc(Applies an action of the current player to each game.
+
+            (observations, rewards, dones, current_players, turns)
+
+            Parameters
+            ----------
+            action_indices : The indices of legal actions of all games in the action space of ActionEncoder.)pbdoc",
+            pybind11::arg("action_indices"))
+        .def("observations", &ToObservations,
+             R"pbdoc(Returns the view of the observations of (num_envs, NUM_FEATURES).)pbdoc")
+        .def(
+            "action_masks",
+            [](pybind11::object self) {
+                const auto& env = self.cast<const VectorEnv&>();
+                return ToView<bool>(
+                    env.GetActionMasks(),
+                    { env.GetNumEnvs(), ActionEncoder::NUM_ACTIONS }, self);
+            },
+            R"pbdoc(Returns the view of the masks of legal actions of (num_envs, NUM_ACTIONS).)pbdoc")
+        .def_property_readonly("buffer_index", &VectorEnv::GetBufferIndex,
+                               R"pbdoc(The index of the front buffers, 0 or 1.)pbdoc")
+        .def_property_readonly("num_envs", &VectorEnv::GetNumEnvs,
+                               R"pbdoc(The number of games.)pbdoc")
+        .def("legal_actions", &VectorEnv::GetLegalActions,
+             R"pbdoc(Returns the legal actions of the current player of the game.
+
+             Parameters
+             ----------
+             env_idx : The index of game.)pbdoc",
+             pybind11::arg("env_idx"));
+}
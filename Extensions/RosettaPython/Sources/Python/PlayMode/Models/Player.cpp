@@ -0,0 +1,72 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Models/Hero.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+#include <Rosetta/PlayMode/Zones/SecretZone.hpp>
+
+#include <pybind11/pybind11.h>
+
+using namespace RosettaStone::PlayMode;
+
+void AddPlayer(pybind11::module& m)
+{
+    // NOTE: Players are owned by Game, so Python never deletes them.
+    pybind11::class_<Player, std::unique_ptr<Player, pybind11::nodelete>>(
+        m, "Player", R"pbdoc(This class represents a player of a game.)pbdoc")
+        .def_readonly("nickname", &Player::nickname,
+                      R"pbdoc(The nickname of the player.)pbdoc")
+        .def_readonly("player_type", &Player::playerType,
+                      R"pbdoc(The type of the player.)pbdoc")
+        .def_readonly("base_class", &Player::baseClass,
+                      R"pbdoc(The class of the player.)pbdoc")
+        .def_readonly("play_state", &Player::playState,
+                      R"pbdoc(The play state of the player.)pbdoc")
+        .def("total_mana", &Player::GetTotalMana,
+             R"pbdoc(Returns the number of mana crystals.)pbdoc")
+        .def("remaining_mana", &Player::GetRemainingMana,
+             R"pbdoc(Returns the amount of mana that the player can use.)pbdoc")
+        .def("overload_owed", &Player::GetOverloadOwed,
+             R"pbdoc(Returns the amount of overload for the next turn.)pbdoc")
+        .def("overload_locked", &Player::GetOverloadLocked,
+             R"pbdoc(Returns the amount of mana locked by overload.)pbdoc")
+        .def(
+            "hero_health",
+            [](const Player& player) { return player.GetHero()->GetHealth(); },
+            R"pbdoc(Returns the health of the hero.)pbdoc")
+        .def(
+            "hero_armor",
+            [](const Player& player) { return player.GetHero()->GetArmor(); },
+            R"pbdoc(Returns the armor of the hero.)pbdoc")
+        .def(
+            "hand_count",
+            [](const Player& player) {
+                return player.GetHandZone()->GetCount();
+            },
+            R"pbdoc(Returns the number of cards in hand.)pbdoc")
+        .def(
+            "deck_count",
+            [](const Player& player) {
+                return player.GetDeckZone()->GetCount();
+            },
+            R"pbdoc(Returns the number of cards in deck.)pbdoc")
+        .def(
+            "field_count",
+            [](const Player& player) {
+                return player.GetFieldZone()->GetCount();
+            },
+            R"pbdoc(Returns the number of minions on the field.)pbdoc")
+        .def(
+            "secret_count",
+            [](const Player& player) {
+                return player.GetSecretZone()->GetCount();
+            },
+            R"pbdoc(Returns the number of secrets.)pbdoc");
+}
@@ -0,0 +1,180 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/PlayMode/Tasks/PlayerTasks.hpp>
+#include <Rosetta/PlayMode/Agents/Action.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+
+#include <pybind11/operators.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace RosettaStone::PlayMode;
+
+void AddPlayerTasks(pybind11::module& m)
+{
+    using ReleaseGIL = pybind11::call_guard<pybind11::gil_scoped_release>;
+
+    pybind11::enum_<ActionType>(
+        m, "ActionType",
+        R"pbdoc(An enumerator for identifying the action of a player.)pbdoc")
+        .value("PLAY_CARD", ActionType::PLAY_CARD,
+               R"pbdoc(Play a card in hand.)pbdoc")
+        .value("ATTACK", ActionType::ATTACK,
+               R"pbdoc(Attack with a character.)pbdoc")
+        .value("HERO_POWER", ActionType::HERO_POWER,
+               R"pbdoc(Use hero power.)pbdoc")
+        .value("TRADE_CARD", ActionType::TRADE_CARD,
+               R"pbdoc(Trade a card in hand.)pbdoc")
+        .value("CHOOSE", ActionType::CHOOSE,
+               R"pbdoc(Choose a card of the current choice.)pbdoc")
+        .value("END_TURN", ActionType::END_TURN, R"pbdoc(End the turn.)pbdoc");
+
+    pybind11::class_<Action>(
+        m, "Action",
+        R"pbdoc(This class represents an action of the current player.
+
+        Characters are referred to by the index from the view of the current
+        player: 0 is the hero, 1 to 7 are the minions on the field, 8 is the
+        opponent hero and 9 to 15 are the opponent minions on the field.)pbdoc")
+        .def(pybind11::init([](ActionType type, int index, int target,
+                               int position, int chooseOne) {
+                 return Action{ type, index, target, position, chooseOne };
+             }),
+             R"pbdoc(Constructs action with given type, index and target.
+
+             Parameters
+             ----------
+             type : The type of action.
+             index : The position of a card, the index of an attacker or the position of a choice.
+             target : The index of a target character, -1 if not used.
+             position : The field position of a minion, -1 for the rightmost.
+             choose_one : The option of a choose one card, 0 if not used.)pbdoc",
+             pybind11::arg("type"), pybind11::arg("index") = -1,
+             pybind11::arg("target") = -1, pybind11::arg("position") = -1,
+             pybind11::arg("choose_one") = 0)
+        .def_readwrite("type", &Action::type,
+                       R"pbdoc(The type of action.)pbdoc")
+        .def_readwrite("index", &Action::index,
+                       R"pbdoc(The index of a card, a character or a choice.)pbdoc")
+        .def_readwrite("target", &Action::target,
+                       R"pbdoc(The index of a target character.)pbdoc")
+        .def_readwrite("position", &Action::position,
+                       R"pbdoc(The field position of a minion.)pbdoc")
+        .def_readwrite("choose_one", &Action::chooseOne,
+                       R"pbdoc(The option of a choose one card.)pbdoc")
+        .def(pybind11::self == pybind11::self)
+        .def(pybind11::self != pybind11::self);
+
+    m.def("legal_actions", &GetLegalActions,
+          R"pbdoc(Returns a list of actions that the current player can do.
+
+          Parameters
+          ----------
+          game : The game in main action step.)pbdoc",
+          pybind11::arg("game"));
+
+    m.def("apply_action", &ApplyAction, ReleaseGIL(),
+          R"pbdoc(Applies the action of the current player.
+
+          (player1_play_state, player2_play_state)
+
+          Parameters
+          ----------
+          game : The game in main action step.
+          action : The action to apply.)pbdoc",
+          pybind11::arg("game"), pybind11::arg("action"));
+
+    m.def(
+        "play_card",
+        [](Game& game, int handPos, int target, int position, int chooseOne) {
+            return ApplyAction(game, Action{ ActionType::PLAY_CARD, handPos,
+                                             target, position, chooseOne });
+        },
+        ReleaseGIL(),
+        R"pbdoc(Plays a card in hand of the current player.
+
+        Parameters
+        ----------
+        game : The game in main action step.
+        hand_pos : The position of a card in hand.
+        target : The index of a target character, -1 if not used.
+        position : The field position of a minion, -1 for the rightmost.
+        choose_one : The option of a choose one card, 0 if not used.)pbdoc",
+        pybind11::arg("game"), pybind11::arg("hand_pos"),
+        pybind11::arg("target") = -1, pybind11::arg("position") = -1,
+        pybind11::arg("choose_one") = 0);
+
+    m.def(
+        "attack",
+        [](Game& game, int attacker, int defender) {
+            return ApplyAction(
+                game, Action{ ActionType::ATTACK, attacker, defender });
+        },
+        ReleaseGIL(),
+        R"pbdoc(Attacks with a character of the current player.
+
+        Parameters
+        ----------
+        game : The game in main action step.
+        attacker : The index of an attacker.
+        defender : The index of a defender.)pbdoc",
+        pybind11::arg("game"), pybind11::arg("attacker"),
+        pybind11::arg("defender"));
+
+    m.def(
+        "hero_power",
+        [](Game& game, int target) {
+            return ApplyAction(game,
+                               Action{ ActionType::HERO_POWER, -1, target });
+        },
+        ReleaseGIL(),
+        R"pbdoc(Uses hero power of the current player.
+
+        Parameters
+        ----------
+        game : The game in main action step.
+        target : The index of a target character, -1 if not used.)pbdoc",
+        pybind11::arg("game"), pybind11::arg("target") = -1);
+
+    m.def(
+        "trade_card",
+        [](Game& game, int handPos) {
+            return ApplyAction(game, Action{ ActionType::TRADE_CARD, handPos });
+        },
+        ReleaseGIL(),
+        R"pbdoc(Trades a card in hand of the current player.
+
+        Parameters
+        ----------
+        game : The game in main action step.
+        hand_pos : The position of a card in hand.)pbdoc",
+        pybind11::arg("game"), pybind11::arg("hand_pos"));
+
+    m.def(
+        "choose",
+        [](Game& game, int choiceIdx) {
+            return ApplyAction(game, Action{ ActionType::CHOOSE, choiceIdx });
+        },
+        ReleaseGIL(),
+        R"pbdoc(Chooses a card of the current choice.
+
+        Parameters
+        ----------
+        game : The game that the current player has a choice.
+        choice_idx : The position of a card in the choice.)pbdoc",
+        pybind11::arg("game"), pybind11::arg("choice_idx"));
+
+    m.def(
+        "end_turn",
+        [](Game& game) { return ApplyAction(game, Action{}); }, ReleaseGIL(),
+        R"pbdoc(Ends the turn of the current player.
+
+        Parameters
+        ----------
+        game : The game in main action step.)pbdoc",
+        pybind11::arg("game"));
+}
@@ -4,6 +4,12 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Python/Battlegrounds/Agents/Action.hpp>
+#include <Python/Battlegrounds/Managers/GameEnv.hpp>
+#include <Python/Battlegrounds/Managers/VectorEnv.hpp>
+
+#include <Python/Common/StartupProfiler.hpp>
+
 #include <Python/PlayMode/Cards/Card.hpp>
 #include <Python/PlayMode/Cards/Cards.hpp>
 
@@ -16,9 +22,22 @@
 #include <Python/PlayMode/Enums/TaskEnums.hpp>
 #include <Python/PlayMode/Enums/TriggerEnums.hpp>
 
+#include <Python/PlayMode/Games/Game.hpp>
+#include <Python/PlayMode/Games/GameConfig.hpp>
+
 #include <Python/PlayMode/Loaders/InternalCardLoader.hpp>
 #include <Python/PlayMode/Loaders/TargetingPredicates.hpp>
 
+#include <Python/PlayMode/Managers/ActionEncoder.hpp>
+#include <Python/PlayMode/Managers/ObservationEncoder.hpp>
+#include <Python/PlayMode/Managers/TrajectoryReader.hpp>
+#include <Python/PlayMode/Managers/TrajectoryWriter.hpp>
+#include <Python/PlayMode/Managers/VectorEnv.hpp>
+
+#include <Python/PlayMode/Models/Player.hpp>
+
+#include <Python/PlayMode/Tasks/PlayerTasks.hpp>
+
 #include <Python/PlayMode/Utils/Constants.hpp>
 #include <Python/PlayMode/Utils/DeckCode.hpp>
 
@@ -29,6 +48,9 @@ PYBIND11_MODULE(pyRosetta, m)
     m.doc() =
         R"pbdoc(Hearthstone simulator with some reinforcement learning)pbdoc";
 
+    // Common
+    AddStartupProfiler(m);
+
     // Cards
     AddCard(m);
     AddCards(m);
@@ -44,11 +66,35 @@ PYBIND11_MODULE(pyRosetta, m)
     AddTaskEnums(m);
     AddTriggerEnums(m);
 
+    // Games
+    AddGameConfig(m);
+    AddGame(m);
+
     // Loaders
     AddInternalCardLoader(m);
     AddTargetingPredicates(m);
 
+    // Managers
+    AddActionEncoder(m);
+    AddObservationEncoder(m);
+    AddTrajectoryReader(m);
+    AddTrajectoryWriter(m);
+    AddPlayModeVectorEnv(m);
+
+    // Models
+    AddPlayer(m);
+
+    // Tasks
+    AddPlayerTasks(m);
+
     // Utils
     AddConstants(m);
     AddDeckCode(m);
+
+    // Battlegrounds
+    pybind11::module bg = m.def_submodule(
+        "battlegrounds", R"pbdoc(Hearthstone: Battlegrounds)pbdoc");
+    AddAction(bg);
+    AddGameEnv(bg);
+    AddVectorEnv(bg);
 }
\ No newline at end of file
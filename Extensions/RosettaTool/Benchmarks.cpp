@@ -0,0 +1,673 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "Benchmarks.hpp"
+
+#include <Rosetta/Battlegrounds/Agents/RandomAgent.hpp>
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Battlegrounds/Managers/GameRunner.hpp>
+#include <Rosetta/Battlegrounds/Models/BatchCombat.hpp>
+#include <Rosetta/Battlegrounds/Models/Battle.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatSimulator.hpp>
+#include <Rosetta/Battlegrounds/Models/MinionPool.hpp>
+#include <Rosetta/PlayMode/Agents/Action.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Evaluators/BatchEvaluator.hpp>
+#include <Rosetta/PlayMode/Evaluators/HeuristicEvaluator.hpp>
+#include <Rosetta/PlayMode/Evaluators/StubModel.hpp>
+#include <Rosetta/PlayMode/Games/Determinizer.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Games/GameRecorder.hpp>
+#include <Rosetta/PlayMode/Managers/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Managers/TrajectoryWriter.hpp>
+#include <Rosetta/PlayMode/Managers/VectorEnv.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+namespace RosettaStone
+{
+namespace
+{
+struct Benchmark
+{
+    std::string name;
+    std::string unit;
+    std::function<double(std::size_t)> run;
+};
+
+//! Returns the elapsed time of \p func in seconds.
+template <typename F>
+double Measure(F&& func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+//! Refreshes Tavern of each player in turn.
+double TavernRefresh(std::size_t numIterations)
+{
+    Battlegrounds::Game game;
+    game.Start();
+
+    for (auto& player : game.GetGameState().players)
+    {
+        player.SelectHero(0);
+    }
+
+    auto& players = game.GetGameState().players;
+
+    return Measure([&]() {
+        for (std::size_t i = 0; i < numIterations; ++i)
+        {
+            auto& player = players[i % players.size()];
+            player.currentTier = static_cast<int>(i % TIER_UPPER_LIMIT) + 1;
+            player.remainCoin = NUM_COIN_REFRESH_TAVERN;
+            player.RefreshTavern();
+        }
+    });
+}
+
+//! Runs recruit actions (refresh, purchase, play and sell) of each player in
+//! turn. An iteration consists of four actions.
+double Recruit(std::size_t numIterations)
+{
+    Battlegrounds::Game game;
+    game.Start();
+
+    for (auto& player : game.GetGameState().players)
+    {
+        player.SelectHero(0);
+    }
+
+    auto& players = game.GetGameState().players;
+
+    return Measure([&]() {
+        for (std::size_t i = 0; i < numIterations; ++i)
+        {
+            auto& player = players[i % players.size()];
+            player.remainCoin =
+                NUM_COIN_REFRESH_TAVERN + NUM_COIN_PURCHASE_MINION;
+
+            player.RefreshTavern();
+            player.PurchaseMinion(0);
+
+            // NOTE: A minion that needs a target stays in hand.
+            if (player.hand.GetCount() > 0)
+            {
+                player.PlayCard(player.hand.GetCount() - 1, 0);
+            }
+            if (!player.recruitField.IsEmpty())
+            {
+                player.SellMinion(0);
+            }
+        }
+    });
+}
+
+//! Initializes the minion pool, excluding each race in turn.
+double MinionPoolInitialize(std::size_t numIterations)
+{
+    // NOTE: The pool holds all minions by value, so it is too large to be on
+    // the stack.
+    auto pool = std::make_unique<Battlegrounds::MinionPool>();
+
+    return Measure([&]() {
+        for (std::size_t i = 0; i < numIterations; ++i)
+        {
+            pool->Initialize(
+                RACES_IN_BATTLEGROUNDS[i % RACES_IN_BATTLEGROUNDS.size()]);
+        }
+    });
+}
+
+//! Fills the recruit fields of the first \p numPlayers players with
+//! \p cardIDs.
+void AddCombatBoards(Battlegrounds::Game& game,
+                     const std::vector<std::string>& cardIDs,
+                     std::size_t numPlayers = 2)
+{
+    game.Start();
+
+    for (auto& player : game.GetGameState().players)
+    {
+        player.SelectHero(0);
+    }
+
+    auto& players = game.GetGameState().players;
+
+    for (std::size_t i = 0; i < numPlayers; ++i)
+    {
+        for (int pos = 0; pos < MAX_FIELD_SIZE; ++pos)
+        {
+            Battlegrounds::Minion minion(Battlegrounds::Cards::FindCardByID(
+                cardIDs[pos % cardIDs.size()]));
+            minion.owner = &players[i];
+            players[i].recruitField.Add(minion);
+        }
+    }
+}
+
+//! Simulates battles between two full boards that consist of \p cardIDs.
+double Combats(std::size_t numIterations,
+               const std::vector<std::string>& cardIDs)
+{
+    Battlegrounds::Game game;
+    AddCombatBoards(game, cardIDs);
+
+    auto& players = game.GetGameState().players;
+
+    return Measure([&]() {
+        for (std::size_t i = 0; i < numIterations; ++i)
+        {
+            Battlegrounds::Battle battle(players[0], players[1]);
+            battle.Simulate();
+        }
+    });
+}
+
+//! Simulates battles between boards of minions without triggers.
+double CombatsWithoutTriggers(std::size_t numIterations)
+{
+    return Combats(numIterations, { "BGS_039" });
+}
+
+//! Simulates battles between boards of minions that have triggers of
+//! DEATH (Scavenging Hyena) and TURN_START (Micro Machine).
+double CombatsWithTriggers(std::size_t numIterations)
+{
+    return Combats(numIterations, { "BG_EX1_531", "GVG_103" });
+}
+
+//! Simulates the battles of a combat phase: four pairs of eight players
+//! whose boards mix minions with and without triggers. An iteration is a
+//! battle.
+double FullCombat(std::size_t numIterations)
+{
+    constexpr std::size_t NUM_PAIRS = NUM_BATTLEGROUNDS_PLAYERS / 2;
+
+    Battlegrounds::Game game;
+    AddCombatBoards(game, { "BGS_039", "BG_EX1_531", "GVG_103" },
+                    NUM_BATTLEGROUNDS_PLAYERS);
+
+    auto& players = game.GetGameState().players;
+
+    return Measure([&]() {
+        for (std::size_t i = 0; i < numIterations; i += NUM_PAIRS)
+        {
+            for (std::size_t pair = 0; pair < NUM_PAIRS; ++pair)
+            {
+                Battlegrounds::Battle battle(players[pair * 2],
+                                             players[pair * 2 + 1]);
+                battle.Simulate();
+            }
+        }
+    });
+}
+
+//! Simulates the same battles as CombatsWithoutTriggers() with the batch
+//! kernel on a single thread.
+double BatchCombats(std::size_t numIterations)
+{
+    using Battlegrounds::BatchCombat;
+    using Battlegrounds::BattleResult;
+
+    Battlegrounds::Game game;
+    AddCombatBoards(game, { "BGS_039" });
+
+    auto& players = game.GetGameState().players;
+    auto batch = std::make_unique<BatchCombat>(players[0], players[1]);
+    std::vector<std::tuple<BattleResult, int>> results(BatchCombat::NUM_LANES);
+
+    return Measure([&]() {
+        for (std::size_t i = 0; i < numIterations; i += BatchCombat::NUM_LANES)
+        {
+            batch->Run(std::min(BatchCombat::NUM_LANES, numIterations - i),
+                       static_cast<unsigned int>(i), results.data());
+        }
+    });
+}
+
+//! Estimates the outcome of a battle between boards of minions with triggers
+//! by simulating 10,000 battles per call on all hardware threads. The latency
+//! of a call and the number of battles that fit in a 10 ms budget are printed
+//! before the result. An iteration is a battle.
+double CombatSimulate(std::size_t numIterations)
+{
+    constexpr std::size_t NUM_SAMPLES = 10000;
+
+    Battlegrounds::Game game;
+    AddCombatBoards(game, { "BG_EX1_531", "GVG_103" });
+
+    auto& players = game.GetGameState().players;
+    Battlegrounds::CombatSimulator simulator;
+
+    const std::size_t numCalls =
+        std::max<std::size_t>(numIterations / NUM_SAMPLES, 1);
+    const double elapsed = Measure([&]() {
+        for (std::size_t i = 0; i < numCalls; ++i)
+        {
+            simulator.Run(players[0], players[1], NUM_SAMPLES,
+                          static_cast<unsigned int>(i));
+        }
+    });
+
+    const auto result =
+        simulator.Run(players[0], players[1], NUM_SAMPLES, 0,
+                      std::chrono::milliseconds(10));
+
+    std::cout << "latency of " << NUM_SAMPLES << " battles: "
+              << elapsed * 1000.0 / static_cast<double>(numCalls)
+              << " ms, battles in 10 ms: " << result.numSamples << '\n';
+
+    return elapsed * static_cast<double>(numIterations) /
+           static_cast<double>(numCalls * NUM_SAMPLES);
+}
+
+//! Plays full games of random agents on all hardware threads. The time of
+//! each phase is printed before the result.
+double FullGames(std::size_t numIterations)
+{
+    Battlegrounds::GameRunner runner([](std::size_t) {
+        return std::make_unique<Battlegrounds::RandomAgent>();
+    });
+
+    const auto stats = runner.Run(numIterations, 0);
+
+    std::cout << "turns: " << stats.numTurns << ", actions: "
+              << stats.numActions << ", truncated games: "
+              << stats.numTruncatedGames << '\n';
+    std::cout << "time (s): select hero " << stats.selectHeroSec
+              << ", recruit " << stats.recruitSec << ", combat "
+              << stats.combatSec << '\n';
+
+    return stats.elapsedSec;
+}
+
+//! Returns \p numGames games in the middle of play.
+std::vector<std::unique_ptr<PlayMode::Game>> MakeMidGames(
+    std::size_t numGames)
+{
+    constexpr std::size_t NUM_ACTIONS = 20;
+
+    PlayMode::GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::HUNTER;
+    config.startPlayer = PlayMode::PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.skipMulligan = true;
+    config.autoRun = true;
+
+    std::vector<std::unique_ptr<PlayMode::Game>> games;
+    for (std::size_t i = 0; i < numGames; ++i)
+    {
+        auto& game =
+            games.emplace_back(std::make_unique<PlayMode::Game>(config));
+        game->Start();
+
+        // NOTE: Playing the first legal action fills the board and the hand
+        // before the observations are encoded.
+        for (std::size_t j = 0;
+             j < NUM_ACTIONS && game->state != State::COMPLETE; ++j)
+        {
+            PlayMode::ApplyAction(*game,
+                                  PlayMode::GetLegalActions(*game).front());
+        }
+    }
+
+    return games;
+}
+
+//! Encodes the observations of a batch of games in the middle of play on
+//! all hardware threads.
+double ObservationEncode(std::size_t numIterations)
+{
+    constexpr std::size_t NUM_GAMES = 64;
+
+    const auto games = MakeMidGames(NUM_GAMES);
+    std::vector<PlayMode::Game*> gamePtrs;
+    for (const auto& game : games)
+    {
+        gamePtrs.emplace_back(game.get());
+    }
+
+    PlayMode::ObservationEncoder encoder(0);
+    std::vector<float> observations(
+        NUM_GAMES * PlayMode::ObservationEncoder::NUM_FEATURES);
+
+    return Measure([&]() {
+        for (std::size_t i = 0; i < numIterations; i += NUM_GAMES)
+        {
+            encoder.EncodeBatch(gamePtrs, observations.data());
+        }
+    });
+}
+
+//! Evaluates the observations of a batch of games in the middle of play
+//! with the default heuristic weights. The observations are encoded in
+//! advance, as the leaves of a search are.
+double HeuristicEvaluate(std::size_t numIterations)
+{
+    using PlayMode::ObservationEncoder;
+
+    constexpr std::size_t NUM_GAMES = 64;
+
+    const auto games = MakeMidGames(NUM_GAMES);
+    std::vector<float> observations(NUM_GAMES *
+                                    ObservationEncoder::NUM_FEATURES);
+    for (std::size_t i = 0; i < NUM_GAMES; ++i)
+    {
+        ObservationEncoder::Encode(
+            *games[i]->GetCurrentPlayer(),
+            &observations[i * ObservationEncoder::NUM_FEATURES]);
+    }
+
+    const PlayMode::HeuristicEvaluator evaluator;
+    std::vector<float> values(NUM_GAMES);
+    float sum = 0.0f;
+
+    const double elapsed = Measure([&]() {
+        for (std::size_t i = 0; i < numIterations; i += NUM_GAMES)
+        {
+            evaluator.EvaluateBatch(NUM_GAMES, observations.data(),
+                                    values.data());
+            sum += values[i / NUM_GAMES % NUM_GAMES];
+        }
+    });
+
+    // NOTE: Printing the sum keeps the evaluations from being optimized out.
+    std::cout << "sum of values: " << sum << '\n';
+
+    return elapsed;
+}
+
+//! Samples determinizations of records of several lengths for the first
+//! player. The iterations are split between the lengths, and the time of a
+//! sample and of the replay alone is printed for each length before the
+//! result.
+double DeterminizeSample(std::size_t numIterations)
+{
+    const std::vector<std::size_t> numActions{ 10, 40, 160 };
+
+    PlayMode::GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::HUNTER;
+    config.startPlayer = PlayMode::PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.skipMulligan = true;
+    config.autoRun = true;
+
+    const PlayMode::Determinizer determinizer(
+        PlayMode::PlayerType::PLAYER1, {},
+        PlayMode::Cards::GetDatabase().GetDiscoverCards(
+            CardClass::HUNTER, FormatType::STANDARD));
+    const std::size_t numSamples =
+        std::max<std::size_t>(numIterations / numActions.size(), 1);
+    double elapsed = 0.0;
+
+    for (const std::size_t maxActions : numActions)
+    {
+        PlayMode::GameRecorder recorder(config, 0);
+        PlayMode::Game& game = recorder.GetGame();
+
+        // NOTE: Playing the first legal action makes the records the same
+        // in each run.
+        for (std::size_t i = 0;
+             i < maxActions && game.state != State::COMPLETE; ++i)
+        {
+            recorder.Apply(PlayMode::GetLegalActions(game).front());
+        }
+
+        const PlayMode::GameRecord record = recorder.GetRecord();
+
+        const double replaySec = Measure([&]() {
+            for (std::size_t i = 0; i < numSamples; ++i)
+            {
+                PlayMode::Game::Replay(record);
+            }
+        });
+        const double sampleSec = Measure([&]() {
+            for (std::size_t i = 0; i < numSamples; ++i)
+            {
+                determinizer.Sample(record, static_cast<unsigned int>(i));
+            }
+        });
+
+        const auto toMicroseconds = [numSamples](double sec) {
+            return sec * 1e6 / static_cast<double>(numSamples);
+        };
+        std::cout << record.actions.size()
+                  << " actions: " << toMicroseconds(sampleSec)
+                  << " us/sample (replay " << toMicroseconds(replaySec)
+                  << " us)\n";
+        elapsed += sampleSec;
+    }
+
+    return elapsed;
+}
+
+//! Writes steps of self-play to a trajectory file until it is closed. The
+//! steps are recorded from random games in advance, and the compression
+//! ratio is printed before the result.
+double TrajectoryWrite(std::size_t numIterations)
+{
+    using PlayMode::ActionEncoder;
+    using PlayMode::ObservationEncoder;
+
+    constexpr std::size_t NUM_ENVS = 16;
+    constexpr std::size_t NUM_RECORDED_STEPS = 64;
+    const std::string path = "trajectory-write.bin";
+
+    PlayMode::GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::HUNTER;
+    config.startPlayer = PlayMode::PlayerType::RANDOM;
+    config.doFillDecks = true;
+
+    PlayMode::VectorEnv env(config, NUM_ENVS, 0);
+    env.Reset(0);
+
+    std::vector<std::vector<float>> observations;
+    std::vector<std::vector<std::uint8_t>> actionMasks;
+    std::vector<std::vector<std::uint8_t>> dones;
+    std::vector<std::size_t> actions(NUM_ENVS);
+
+    for (std::size_t step = 0; step < NUM_RECORDED_STEPS; ++step)
+    {
+        observations.emplace_back(env.GetObservations());
+        actionMasks.emplace_back(env.GetActionMasks());
+
+        for (std::size_t envIdx = 0; envIdx < NUM_ENVS; ++envIdx)
+        {
+            const auto& legalActions = env.GetLegalActions(envIdx);
+            actions[envIdx] = ActionEncoder::Encode(
+                legalActions[(step + envIdx) % legalActions.size()]);
+        }
+
+        env.Step(actions);
+        dones.emplace_back(env.GetDones());
+    }
+
+    const std::vector<std::int32_t> actionIndices(NUM_ENVS, 0);
+    const std::vector<float> rewards(NUM_ENVS, 0.0f);
+    std::uint64_t numBytes = 0;
+
+    const double elapsed = Measure([&]() {
+        PlayMode::TrajectoryWriter writer(path);
+
+        for (std::size_t i = 0; i < numIterations; i += NUM_ENVS)
+        {
+            const std::size_t step = i / NUM_ENVS % NUM_RECORDED_STEPS;
+            writer.AppendBatch(std::min(NUM_ENVS, numIterations - i),
+                               observations[step].data(),
+                               actionIndices.data(), actionMasks[step].data(),
+                               rewards.data(), dones[step].data());
+        }
+
+        writer.Close();
+        numBytes = writer.GetNumBytes();
+    });
+
+    const double rawBytes =
+        static_cast<double>(numIterations) *
+        (sizeof(float) * ObservationEncoder::NUM_FEATURES +
+         ActionEncoder::NUM_ACTIONS + sizeof(std::uint32_t) +
+         sizeof(std::int32_t) + sizeof(float) + 1);
+    std::cout << "bytes: " << numBytes << " (compression ratio "
+              << rawBytes / static_cast<double>(numBytes) << ")\n";
+
+    std::remove(path.c_str());
+
+    return elapsed;
+}
+
+//! Evaluates observations with the stub model through a batch evaluator
+//! for each maximum batch size. The iterations are split between the batch
+//! sizes, and the throughput of each batch size is printed before the
+//! result.
+double BatchEvaluate(std::size_t numIterations)
+{
+    using PlayMode::ActionEncoder;
+    using PlayMode::ObservationEncoder;
+
+    constexpr std::size_t NUM_THREADS = 8;
+    constexpr std::size_t NUM_IN_FLIGHT = 32;
+    constexpr std::size_t INPUT_SIZE = ObservationEncoder::NUM_FEATURES;
+    constexpr std::size_t OUTPUT_SIZE = ActionEncoder::NUM_ACTIONS + 1;
+    const std::vector<std::size_t> batchSizes{ 1, 4, 16, 64, 256 };
+
+    const PlayMode::StubModel model(INPUT_SIZE, OUTPUT_SIZE,
+                                    std::chrono::microseconds(50));
+    const std::size_t numStates =
+        std::max<std::size_t>(numIterations / batchSizes.size(), 1);
+    const std::vector<float> input(INPUT_SIZE, 1.0f);
+    double elapsed = 0.0;
+
+    for (const std::size_t batchSize : batchSizes)
+    {
+        PlayMode::BatchEvaluator evaluator(INPUT_SIZE, OUTPUT_SIZE, batchSize,
+                                           std::chrono::microseconds(200),
+                                           model);
+        std::atomic<std::size_t> nextState{ 0 };
+
+        // NOTE: Each thread keeps several states in flight, like a search
+        // with virtual loss, so the threads can fill large batches.
+        const double sec = Measure([&]() {
+            std::vector<std::thread> threads;
+
+            for (std::size_t t = 0; t < NUM_THREADS; ++t)
+            {
+                threads.emplace_back([&]() {
+                    std::vector<float> outputs(NUM_IN_FLIGHT * OUTPUT_SIZE);
+                    std::vector<std::future<void>> futures;
+
+                    while (nextState.fetch_add(NUM_IN_FLIGHT) < numStates)
+                    {
+                        for (std::size_t i = 0; i < NUM_IN_FLIGHT; ++i)
+                        {
+                            futures.emplace_back(evaluator.Submit(
+                                input.data(), &outputs[i * OUTPUT_SIZE]));
+                        }
+
+                        for (auto& future : futures)
+                        {
+                            future.get();
+                        }
+                        futures.clear();
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        });
+
+        const auto numEvaluations =
+            static_cast<double>(evaluator.GetNumEvaluations());
+        std::cout << "batch size " << batchSize << ": "
+                  << numEvaluations / sec << " evaluations/s (mean batch "
+                  << numEvaluations /
+                         static_cast<double>(evaluator.GetNumBatches())
+                  << ")\n";
+        elapsed += sec;
+    }
+
+    return elapsed;
+}
+
+const std::vector<Benchmark>& GetBenchmarks()
+{
+    static const std::vector<Benchmark> benchmarks{
+        { "tavern-refresh", "refreshes", TavernRefresh },
+        { "recruit", "iterations", Recruit },
+        { "minion-pool-initialize", "initializations",
+          MinionPoolInitialize },
+        { "full-games", "games", FullGames },
+        { "combat-no-triggers", "combats", CombatsWithoutTriggers },
+        { "combat-triggers", "combats", CombatsWithTriggers },
+        { "combat-batch", "combats", BatchCombats },
+        { "full-combat", "combats", FullCombat },
+        { "combat-simulate", "combats", CombatSimulate },
+        { "observation-encode", "observations", ObservationEncode },
+        { "determinize-sample", "samples", DeterminizeSample },
+        { "trajectory-write", "steps", TrajectoryWrite },
+        { "batch-evaluate", "evaluations", BatchEvaluate },
+        { "heuristic-evaluate", "evaluations", HeuristicEvaluate },
+    };
+
+    return benchmarks;
+}
+}  // namespace
+
+std::vector<std::string> GetBenchmarkNames()
+{
+    std::vector<std::string> names;
+
+    for (const auto& benchmark : GetBenchmarks())
+    {
+        names.emplace_back(benchmark.name);
+    }
+
+    return names;
+}
+
+bool RunBenchmark(const std::string& name, std::size_t numIterations)
+{
+    for (const auto& benchmark : GetBenchmarks())
+    {
+        if (benchmark.name != name)
+        {
+            continue;
+        }
+
+        const double elapsed = benchmark.run(numIterations);
+
+        std::cout << benchmark.name << ": " << numIterations << ' '
+                  << benchmark.unit << " in " << elapsed * 1000.0 << " ms ("
+                  << static_cast<double>(numIterations) / elapsed << ' '
+                  << benchmark.unit << "/s)\n";
+
+        return true;
+    }
+
+    return false;
+}
+}  // namespace RosettaStone
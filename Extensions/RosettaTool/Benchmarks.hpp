@@ -0,0 +1,26 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TOOL_BENCHMARKS_HPP
+#define ROSETTASTONE_TOOL_BENCHMARKS_HPP
+
+#include <string>
+#include <vector>
+
+namespace RosettaStone
+{
+//! Returns the names of benchmarks.
+//! \return The names of benchmarks.
+std::vector<std::string> GetBenchmarkNames();
+
+//! Runs the benchmark of \p name and prints the result.
+//! \param name The name of benchmark.
+//! \param numIterations The number of iterations.
+//! \return true if the benchmark exists, false otherwise.
+bool RunBenchmark(const std::string& name, std::size_t numIterations);
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_TOOL_BENCHMARKS_HPP
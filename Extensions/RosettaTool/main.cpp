@@ -4,6 +4,10 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include "Benchmarks.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Common/StartupProfiler.hpp>
 #include <Rosetta/Common/Utils.hpp>
 #include <Rosetta/PlayMode/Cards/Cards.hpp>
 
@@ -133,11 +137,43 @@ inline bool CheckCardImpl(const std::string& path, const std::string& id)
     exit(EXIT_FAILURE);
 }
 
+[[noreturn]] inline void PrintStartupProfile(std::size_t numLoaderThreads)
+{
+    Cards::SetNumLoaderThreads(numLoaderThreads);
+    Cards::GetInstance();
+    Battlegrounds::Cards::GetInstance();
+
+    std::cout << StartupProfiler::ToString();
+    exit(EXIT_SUCCESS);
+}
+
+[[noreturn]] inline void PrintBenchmark(const std::string& name,
+                                        std::size_t numIterations)
+{
+    if (!RunBenchmark(name, numIterations))
+    {
+        std::cerr << "Invalid benchmark name: " << name << '\n';
+        std::cerr << "Available benchmarks:";
+        for (const auto& benchmarkName : GetBenchmarkNames())
+        {
+            std::cerr << ' ' << benchmarkName;
+        }
+        std::cerr << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    exit(EXIT_SUCCESS);
+}
+
 int main(int argc, char* argv[])
 {
     // Parse command
     bool showHelp = false;
     bool isExportAllCard = false;
+    bool isStartupProfile = false;
+    std::size_t numLoaderThreads = 0;
+    std::size_t numIterations = 100000;
+    std::string benchmarkName;
     std::string cardSetName;
     std::string projectPath;
 
@@ -148,7 +184,18 @@ int main(int argc, char* argv[])
                         lyra::opt(cardSetName, "cardSet")["-c"]["--cardset"](
                             "Export a list of specific expansion cards") |
                         lyra::opt(projectPath, "path")["-p"]["--path"](
-                            "Specify RosettaStone project path");
+                            "Specify RosettaStone project path") |
+                        lyra::opt(isStartupProfile)["--startup-profile"](
+                            "Print wall time and allocations of loading "
+                            "cards (allocations need "
+                            "ROSETTASTONE_COUNT_ALLOCATIONS)") |
+                        lyra::opt(numLoaderThreads, "threads")
+                            ["--loader-threads"]("Specify the number of "
+                                                 "threads to load cards") |
+                        lyra::opt(benchmarkName, "name")["--benchmark"](
+                            "Run a benchmark and print its throughput") |
+                        lyra::opt(numIterations, "count")["--iterations"](
+                            "Specify the number of benchmark iterations");
 
     const auto result = parser.parse({ argc, argv });
 
@@ -164,6 +211,16 @@ int main(int argc, char* argv[])
         exit(EXIT_SUCCESS);
     }
 
+    if (isStartupProfile)
+    {
+        PrintStartupProfile(numLoaderThreads);
+    }
+
+    if (!benchmarkName.empty())
+    {
+        PrintBenchmark(benchmarkName, numIterations);
+    }
+
     if (projectPath.empty())
     {
         std::cout << "You should input RosettaStone project path\n";
@@ -14,7 +14,7 @@ namespace RosettaStone::Battlegrounds::Generic
 //! \param enchantmentCard The base card for the enchantment.
 //! \param target The target minion.
 //! \param num The number of GameTag::TAG_SCRIPT_DATA_NUM_1.
-void AddEnchantment(Card& enchantmentCard, Minion& target, int num = -1);
+void AddEnchantment(const Card& enchantmentCard, Minion& target, int num = -1);
 }  // namespace RosettaStone::Battlegrounds::Generic
 
 #endif  // ROSETTASTONE_BATTLEGROUNDS_GENERIC_HPP
@@ -0,0 +1,66 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_ACTION_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_ACTION_HPP
+
+#include <Rosetta/Common/Enums/GameEnums.hpp>
+
+#include <vector>
+
+namespace RosettaStone::Battlegrounds
+{
+class Player;
+
+//!
+//! \brief Action struct.
+//!
+//! This struct represents an action of a player in recruit phase.
+//! The meaning of the indices depends on the type of action.
+//! - PURCHASE: index is the position of a minion in Tavern.
+//! - SELL: index is the position of a minion on the field.
+//! - PLAY: index is the position of a card in hand, target is the position
+//!   of a target minion on the field or -1. A minion is placed on the right
+//!   side of the field. Spells can't be played yet, so there is no PLAY
+//!   action for them.
+//! - REARRANGE: index is the current position of a minion on the field and
+//!   target is the new position.
+//!
+struct Action
+{
+    ActionType type = ActionType::END_TURN;
+    int index = -1;
+    int target = -1;
+};
+
+//! Operator overloading: operator==.
+bool operator==(const Action& lhs, const Action& rhs);
+
+//! Operator overloading: operator!=.
+bool operator!=(const Action& lhs, const Action& rhs);
+
+//! Returns a list of actions that the player can do in recruit phase.
+//! The last action is always END_TURN.
+//! \param player The player in recruit phase.
+//! \return A list of legal actions.
+std::vector<Action> GetLegalActions(Player& player);
+
+//! Writes the actions that the player can do in recruit phase to \p actions.
+//! \p actions is cleared first, so its capacity is reused between calls.
+//! \param player The player in recruit phase.
+//! \param actions The buffer of legal actions.
+void GetLegalActions(Player& player, std::vector<Action>& actions);
+
+//! Applies the action of the player in recruit phase.
+//! It throws std::invalid_argument if a PLAY action refers to a spell.
+//! NOTE: END_TURN doesn't complete recruit. The caller completes recruit by
+//! calling Player::CompleteRecruit().
+//! \param player The player in recruit phase.
+//! \param action The action to apply.
+void ApplyAction(Player& player, const Action& action);
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_ACTION_HPP
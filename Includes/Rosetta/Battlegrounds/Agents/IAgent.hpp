@@ -0,0 +1,47 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_IAGENT_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_IAGENT_HPP
+
+#include <Rosetta/Battlegrounds/Agents/Action.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace RosettaStone::Battlegrounds
+{
+class Player;
+
+//!
+//! \brief IAgent class.
+//!
+//! This class is an interface of agent classes that play Battlegrounds.
+//! An agent makes decisions for a player. The game of the player can be
+//! accessed through Player::game.
+//!
+class IAgent
+{
+ public:
+    //! Default virtual destructor.
+    virtual ~IAgent() = default;
+
+    //! Gets an action of agent for selecting a hero.
+    //! \param player The player to select a hero.
+    //! \return The index of the hero in Player::heroChoices.
+    virtual std::size_t GetActionForSelectHero(Player& player) = 0;
+
+    //! Gets an action of agent in recruit phase.
+    //! \param player The player in recruit phase.
+    //! \param legalActions A list of legal actions. It is not empty and the
+    //! last action is always END_TURN.
+    //! \return An action in \p legalActions.
+    virtual Action GetActionForRecruit(
+        Player& player, const std::vector<Action>& legalActions) = 0;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_IAGENT_HPP
@@ -0,0 +1,41 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_RANDOM_AGENT_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_RANDOM_AGENT_HPP
+
+#include <Rosetta/Battlegrounds/Agents/IAgent.hpp>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief RandomAgent class.
+//!
+//! This class is an agent that plays an action at random. It chooses the type
+//! of action first and then one of the actions of that type, so that actions
+//! with many variations (e.g. REARRANGE) don't dominate the others.
+//!
+class RandomAgent final : public IAgent
+{
+ public:
+    //! Default virtual destructor.
+    ~RandomAgent() override = default;
+
+    //! Gets an action of agent for selecting a hero.
+    //! \param player The player to select a hero.
+    //! \return The index of the hero in Player::heroChoices.
+    std::size_t GetActionForSelectHero(Player& player) override;
+
+    //! Gets an action of agent in recruit phase.
+    //! \param player The player in recruit phase.
+    //! \param legalActions A list of legal actions.
+    //! \return An action in \p legalActions.
+    Action GetActionForRecruit(
+        Player& player, const std::vector<Action>& legalActions) override;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_RANDOM_AGENT_HPP
@@ -11,6 +11,8 @@
 #include <Rosetta/Common/Constants.hpp>
 
 #include <array>
+#include <string_view>
+#include <unordered_map>
 
 namespace RosettaStone::Battlegrounds
 {
@@ -18,6 +20,8 @@ namespace RosettaStone::Battlegrounds
 //! \brief Cards class.
 //!
 //! This class stores a list of cards and provides several search methods.
+//! Each card is stored once and shared by reference, so models such as
+//! Minion and Hero keep a pointer to the card instead of copying it.
 //!
 class Cards
 {
@@ -44,59 +48,65 @@ class Cards
 
     //! Returns a card that matches \p id.
     //! \param id The ID of the card.
-    //! \return A card that matches \p id.
-    static Card FindCardByID(const std::string_view& id);
+    //! \return A card that matches \p id, or an empty card if not found.
+    static const Card& FindCardByID(const std::string_view& id);
 
     //! Returns a card that matches \p dbfID.
     //! \param dbfID The dbfID of the card.
-    //! \return A card that matches \p dbfID.
-    static Card FindCardByDbfID(int dbfID);
+    //! \return A card that matches \p dbfID, or an empty card if not found.
+    static const Card& FindCardByDbfID(int dbfID);
 
     //! Returns a card that matches \p name.
     //! \param name The name of the card.
-    //! \return A card that matches \p name.
-    static Card FindCardByName(const std::string_view& name);
+    //! \return A card that matches \p name, or an empty card if not found.
+    static const Card& FindCardByName(const std::string_view& name);
 
     //! Returns a list of current heroes.
     //! \return A list of current heroes.
-    static const std::array<Card, NUM_BATTLEGROUNDS_HEROES>& GetCurrentHeroes();
+    static const std::array<const Card*, NUM_BATTLEGROUNDS_HEROES>&
+    GetCurrentHeroes();
 
     //! Returns a list of tier 1 minions in Battlegrounds Tavern.
     //! \return A list of tier 1 minions in Battlegrounds Tavern.
-    static const std::array<Card, NUM_TIER1_MINIONS>& GetTier1Minions();
+    static const std::array<const Card*, NUM_TIER1_MINIONS>& GetTier1Minions();
 
     //! Returns a list of tier 2 minions in Battlegrounds Tavern.
     //! \return A list of tier 2 minions in Battlegrounds Tavern.
-    static const std::array<Card, NUM_TIER2_MINIONS>& GetTier2Minions();
+    static const std::array<const Card*, NUM_TIER2_MINIONS>& GetTier2Minions();
 
     //! Returns a list of tier 3 minions in Battlegrounds Tavern.
     //! \return A list of tier 3 minions in Battlegrounds Tavern.
-    static const std::array<Card, NUM_TIER3_MINIONS>& GetTier3Minions();
+    static const std::array<const Card*, NUM_TIER3_MINIONS>& GetTier3Minions();
 
     //! Returns a list of tier 4 minions in Battlegrounds Tavern.
     //! \return A list of tier 4 minions in Battlegrounds Tavern.
-    static const std::array<Card, NUM_TIER4_MINIONS>& GetTier4Minions();
+    static const std::array<const Card*, NUM_TIER4_MINIONS>& GetTier4Minions();
 
     //! Returns a list of tier 5 minions in Battlegrounds Tavern.
     //! \return A list of tier 5 minions in Battlegrounds Tavern.
-    static const std::array<Card, NUM_TIER5_MINIONS>& GetTier5Minions();
+    static const std::array<const Card*, NUM_TIER5_MINIONS>& GetTier5Minions();
 
     //! Returns a list of tier 6 minions in Battlegrounds Tavern.
     //! \return A list of tier 6 minions in Battlegrounds Tavern.
-    static const std::array<Card, NUM_TIER6_MINIONS>& GetTier6Minions();
+    static const std::array<const Card*, NUM_TIER6_MINIONS>& GetTier6Minions();
 
  private:
     //! Constructor: Loads card data.
     Cards();
 
+    //! Builds the indices to find a card by ID and dbfID in O(1).
+    static void BuildIndices();
+
     static std::array<Card, NUM_BATTLEGROUNDS_CARDS> m_cards;
-    static std::array<Card, NUM_BATTLEGROUNDS_HEROES> m_curHeroes;
-    static std::array<Card, NUM_TIER1_MINIONS> m_tier1Minions;
-    static std::array<Card, NUM_TIER2_MINIONS> m_tier2Minions;
-    static std::array<Card, NUM_TIER3_MINIONS> m_tier3Minions;
-    static std::array<Card, NUM_TIER4_MINIONS> m_tier4Minions;
-    static std::array<Card, NUM_TIER5_MINIONS> m_tier5Minions;
-    static std::array<Card, NUM_TIER6_MINIONS> m_tier6Minions;
+    static std::unordered_map<std::string_view, const Card*> m_cardsByID;
+    static std::unordered_map<int, const Card*> m_cardsByDbfID;
+    static std::array<const Card*, NUM_BATTLEGROUNDS_HEROES> m_curHeroes;
+    static std::array<const Card*, NUM_TIER1_MINIONS> m_tier1Minions;
+    static std::array<const Card*, NUM_TIER2_MINIONS> m_tier2Minions;
+    static std::array<const Card*, NUM_TIER3_MINIONS> m_tier3Minions;
+    static std::array<const Card*, NUM_TIER4_MINIONS> m_tier4Minions;
+    static std::array<const Card*, NUM_TIER5_MINIONS> m_tier5Minions;
+    static std::array<const Card*, NUM_TIER6_MINIONS> m_tier6Minions;
 };
 }  // namespace RosettaStone::Battlegrounds
 
@@ -37,7 +37,7 @@ class Enchant
     //! Activates enchant to \p minion.
     //! \param minion A minion to which enchant is activated.
     //! \param num The number of GameTag::TAG_SCRIPT_DATA_NUM_1.
-    void ActivateTo(Minion& minion, int num = 0);
+    void ActivateTo(Minion& minion, int num = 0) const;
 
  private:
     std::vector<Effect> m_effects;
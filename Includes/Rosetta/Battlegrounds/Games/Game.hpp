@@ -8,13 +8,33 @@
 #define ROSETTASTONE_BATTLEGROUNDS_GAME_HPP
 
 #include <Rosetta/Battlegrounds/Games/GameState.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
 
 #include <atomic>
+#include <memory>
 #include <tuple>
 #include <vector>
 
 namespace RosettaStone::Battlegrounds
 {
+//!
+//! \brief GameSnapshot struct.
+//!
+//! This struct stores the state of a game including the minion pool, Taverns,
+//! hands, fields and fight pairings. It is plain data, so it can be stored
+//! and restored to any game any number of times.
+//! NOTE: The random engine isn't a part of the snapshot.
+//!
+struct GameSnapshot
+{
+    GameState gameState;
+
+    Race excludeRace = Race::INVALID;
+    std::vector<std::tuple<std::size_t, std::size_t>> playerFightPair;
+    int playerCount = 0;
+    int cardIndex = 0;
+};
+
 //!
 //! \brief Game class.
 //!
@@ -25,6 +45,42 @@ namespace RosettaStone::Battlegrounds
 class Game
 {
  public:
+    //! Default constructor.
+    Game() = default;
+
+    //! Default destructor.
+    ~Game() = default;
+
+    //! Deleted copy constructor.
+    //! NOTE: Players and minions refer to their game and owners, so a game
+    //! must be copied by Clone() or Snapshot()/Restore().
+    Game(const Game&) = delete;
+
+    //! Deleted move constructor.
+    Game(Game&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    Game& operator=(const Game&) = delete;
+
+    //! Deleted move assignment operator.
+    Game& operator=(Game&&) noexcept = delete;
+
+    //! Creates an independent copy of the game. The copy has the same state,
+    //! and players and minions of the copy refer to the copy.
+    //! NOTE: A search may create many clones, so the copy doesn't inherit the
+    //! thread pool of this game and runs battles on the calling thread.
+    //! \return The copy of the game.
+    std::unique_ptr<Game> Clone() const;
+
+    //! Takes a snapshot of the game.
+    //! NOTE: It must not be called while a battle or a task is in progress.
+    //! \return The snapshot of the game.
+    GameSnapshot Snapshot() const;
+
+    //! Restores the game to the state of the snapshot.
+    //! \param snapshot The snapshot of this game or another game.
+    void Restore(const GameSnapshot& snapshot);
+
     //! Gets the game state.
     //! \return The game state.
     GameState& GetGameState();
@@ -39,8 +95,43 @@ class Game
     void Recruit();
 
     //! Processes the combat phase.
+    //! NOTE: Battles of each pair can run in parallel (see
+    //! SetNumCombatThreads()). Each battle has its own seed drawn in the order
+    //! of pairs, and damage is dealt in that order, so the result doesn't
+    //! depend on the number of threads.
     void Combat();
 
+    //! Sets the number of threads that run battles in the combat phase.
+    //! A battle takes only microseconds, so battles run on the calling thread
+    //! by default, and a pool of threads pays off only for heavy boards.
+    //! \param numThreads The number of threads. If it is 0, the number of
+    //! hardware threads is used. If it is 1 (default), battles run on the
+    //! calling thread.
+    void SetNumCombatThreads(std::size_t numThreads);
+
+    //! Returns the number of threads that run battles in the combat phase.
+    //! \return The number of threads that run battles in the combat phase.
+    std::size_t GetNumCombatThreads() const;
+
+    //! Processes the tasks after a player selects a hero.
+    void ProcessSelectHero();
+
+    //! Processes the tasks after a player completes recruit.
+    void ProcessCompleteRecruit();
+
+    //! Processes the tasks related to defeat.
+    //! \param player The player who is defeated.
+    void ProcessDefeat(Player& player);
+
+    //! Returns the next card index.
+    //! \return The next card index.
+    int GetNextCardIndex();
+
+    //! Returns the opponent player to fight next.
+    //! \param player The player to find opponent.
+    //! \return The opponent player to fight next.
+    Player& GetOpponentPlayer(const Player& player);
+
     //! Processes the game over phase.
     void GameOver();
 
@@ -78,6 +169,9 @@ class Game
     std::vector<std::tuple<std::size_t, std::size_t>> m_playerFightPair;
     std::atomic<int> m_playerCount = 0;
     std::atomic<int> m_cardIndex = 0;
+
+    std::size_t m_numCombatThreads = 1;
+    std::unique_ptr<ThreadPool> m_combatPool;
 };
 }  // namespace RosettaStone::Battlegrounds
 
@@ -0,0 +1,197 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_GAME_ENV_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_GAME_ENV_HPP
+
+#include <Rosetta/Battlegrounds/Agents/Action.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Common/Constants.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief GameEnv class.
+//!
+//! This class is an environment for reinforcement learning that steps a game
+//! of Battlegrounds one recruit action at a time. Heroes are selected at
+//! random, and players of the recruit phase act in the order of seats: the
+//! current player acts until it ends its turn, then the next player alive
+//! acts. When the last player ends its turn, the combat phase runs and the
+//! next recruit phase starts.
+//!
+//! Actions are encoded in a fixed discrete space of NUM_ACTIONS indices:
+//! - [0, 7): PURCHASE of a minion in Tavern.
+//! - [7, 14): SELL of a minion on the field.
+//! - [14, 94): PLAY of a card in hand, (hand index) * 8 + (target + 1).
+//! - 94: UPGRADE, 95: REFRESH, 96: FREEZE.
+//! - [97, 146): REARRANGE, (current index) * 7 + (new index).
+//! - 146: END_TURN.
+//!
+//! An observation of a player is NUM_OBSERVATIONS floats:
+//! - NUM_PLAYER_FEATURES features of the player: hero health, remaining coin,
+//!   total coin, Tavern tier, coin to upgrade Tavern, Tavern is frozen, number
+//!   of players alive, turn, hero health and Tavern tier of the next opponent.
+//! - NUM_CARD_FEATURES features of each slot of the field, Tavern and hand
+//!   in that order: type (0: empty, 1: minion, 2: spell), dbfID, attack,
+//!   health, tier, taunt and divine shield.
+//!
+//! The random engine of the calling thread is seeded before each step from
+//! the seed of the episode, so an episode only depends on its seed and
+//! actions, not on the thread that steps it.
+//!
+class GameEnv
+{
+ public:
+    static constexpr std::size_t NUM_PLAY_TARGETS = MAX_FIELD_SIZE + 1;
+
+    static constexpr std::size_t PURCHASE_OFFSET = 0;
+    static constexpr std::size_t SELL_OFFSET =
+        PURCHASE_OFFSET + MAX_FIELD_SIZE;
+    static constexpr std::size_t PLAY_OFFSET = SELL_OFFSET + MAX_FIELD_SIZE;
+    static constexpr std::size_t UPGRADE_INDEX =
+        PLAY_OFFSET + MAX_HAND_SIZE * NUM_PLAY_TARGETS;
+    static constexpr std::size_t REFRESH_INDEX = UPGRADE_INDEX + 1;
+    static constexpr std::size_t FREEZE_INDEX = REFRESH_INDEX + 1;
+    static constexpr std::size_t REARRANGE_OFFSET = FREEZE_INDEX + 1;
+    static constexpr std::size_t END_TURN_INDEX =
+        REARRANGE_OFFSET + MAX_FIELD_SIZE * MAX_FIELD_SIZE;
+    static constexpr std::size_t NUM_ACTIONS = END_TURN_INDEX + 1;
+
+    static constexpr std::size_t NUM_PLAYER_FEATURES = 10;
+    static constexpr std::size_t NUM_CARD_FEATURES = 7;
+    static constexpr std::size_t NUM_CARD_SLOTS =
+        MAX_FIELD_SIZE * 2 + MAX_HAND_SIZE;
+    static constexpr std::size_t NUM_OBSERVATIONS =
+        NUM_PLAYER_FEATURES + NUM_CARD_SLOTS * NUM_CARD_FEATURES;
+
+    //! Returns the index of the action in the fixed action space.
+    //! \param action The action to encode.
+    //! \return The index of the action.
+    static std::size_t EncodeAction(const Action& action);
+
+    //! Returns the action at the index of the fixed action space.
+    //! \param actionIdx The index of the action.
+    //! \return The action at the index.
+    static Action DecodeAction(std::size_t actionIdx);
+
+    //! Sets the maximum number of turns of an episode. An episode that doesn't
+    //! end in this number of turns is done and truncated.
+    //! \param maxTurns The maximum number of turns.
+    void SetMaxTurns(std::size_t maxTurns);
+
+    //! Sets the maximum number of actions of a player in a turn. The turn of
+    //! the player ends when the player reaches this number.
+    //! \param maxActions The maximum number of actions.
+    void SetMaxActionsPerTurn(std::size_t maxActions);
+
+    //! Starts a new episode and steps until the first recruit phase.
+    //! \param seed The seed of the episode.
+    void Reset(unsigned int seed);
+
+    //! Returns the legal actions of the current player.
+    //! NOTE: This is not const because checking the requirements of cards
+    //! needs a mutable player.
+    //! \return A list of legal actions. It is empty if the episode is done.
+    std::vector<Action> GetLegalActions();
+
+    //! Writes the mask of legal actions of the current player. The legal
+    //! actions are written to a buffer of the environment, so no memory is
+    //! allocated once the buffer has grown.
+    //! \param mask The buffer of NUM_ACTIONS elements. An element is 1 if the
+    //! action at its index is legal, 0 otherwise.
+    void WriteLegalMask(std::uint8_t* mask);
+
+    //! Applies the action of the current player. END_TURN ends the turn of
+    //! the current player, and the combat phase runs when the last player
+    //! ends its turn.
+    //! \param action The action that is one of GetLegalActions(). An illegal
+    //! action throws std::invalid_argument without changing the game.
+    //! \return true if the episode is done, false otherwise.
+    bool Step(const Action& action);
+
+    //! Ends the turns of the current player and the players after it, then
+    //! runs the combat phase.
+    //! \return true if the episode is done, false otherwise.
+    bool AdvancePhase();
+
+    //! Writes the observation of the player in the given seat.
+    //! \param seatIdx The index of the player in the game.
+    //! \param observation The buffer of NUM_OBSERVATIONS elements.
+    void WriteObservation(std::size_t seatIdx, float* observation) const;
+
+    //! Returns the reward of the player in the given seat. It is 0 until the
+    //! episode is complete, and it is linear in the placement from 1 (first)
+    //! to -1 (last) after that. A truncated episode has no reward.
+    //! \param seatIdx The index of the player in the game.
+    //! \return The reward of the player.
+    float GetReward(std::size_t seatIdx) const;
+
+    //! Returns the index of the player to act.
+    //! \return The index of the player to act.
+    std::size_t GetCurrentPlayerIdx() const;
+
+    //! Returns the number of recruit phases of the episode.
+    //! \return The number of recruit phases of the episode.
+    std::size_t GetNumTurns() const;
+
+    //! Returns a value indicating whether the episode is done.
+    //! \return true if the episode is done, false otherwise.
+    bool IsDone() const;
+
+    //! Returns a value indicating whether the episode is done because it
+    //! reached the maximum number of turns.
+    //! \return true if the episode is truncated, false otherwise.
+    bool IsTruncated() const;
+
+    //! Returns the game of the episode.
+    //! \return The game of the episode.
+    Game& GetGame();
+
+ private:
+    //! Seeds the random engine of the calling thread for the next step.
+    void SeedNextStep();
+
+    //! Ends the turn of the current player and moves to the next player.
+    void EndTurn();
+
+    //! Starts the turn of the first player alive, or finishes the episode.
+    void StartRecruit();
+
+    //! Writes the legal actions of the current player to m_legalActions.
+    void UpdateLegalActions();
+
+    //! Returns the current player.
+    //! \return The current player.
+    Player& GetCurrentPlayer();
+
+    //! Returns the current player.
+    //! \return The current player.
+    const Player& GetCurrentPlayer() const;
+
+    std::unique_ptr<Game> m_game;
+    std::vector<Action> m_legalActions;
+
+    unsigned int m_seed = 0;
+    std::size_t m_numSteps = 0;
+
+    std::size_t m_currentPlayerIdx = 0;
+    std::size_t m_numTurns = 0;
+    std::size_t m_numActions = 0;
+
+    std::size_t m_maxTurns = 100;
+    std::size_t m_maxActionsPerTurn = 50;
+
+    bool m_isDone = true;
+    bool m_isTruncated = false;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_GAME_ENV_HPP
@@ -0,0 +1,124 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_GAME_RUNNER_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_GAME_RUNNER_HPP
+
+#include <Rosetta/Battlegrounds/Agents/IAgent.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <array>
+#include <functional>
+#include <memory>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief GameStats struct.
+//!
+//! This struct stores the statistics of games played by GameRunner.
+//! The time of each phase is the sum over all games, so it can be larger than
+//! the wall time when games run in parallel.
+//!
+struct GameStats
+{
+    //! Returns the number of games played per second of wall time.
+    //! \return The number of games played per second.
+    double GetGamesPerSecond() const;
+
+    //! Returns the average placement of the player in the given seat.
+    //! \param seatIdx The index of the player in the game.
+    //! \return The average placement, or 0 if no game is complete.
+    double GetAveragePlacement(std::size_t seatIdx) const;
+
+    //! Adds the statistics of other games.
+    //! \param other The statistics of other games.
+    void Merge(const GameStats& other);
+
+    std::size_t numGames = 0;
+    std::size_t numTruncatedGames = 0;
+    std::size_t numTurns = 0;
+    std::size_t numActions = 0;
+
+    double elapsedSec = 0.0;
+
+    //! The time of agents selecting heroes including the preparation of the
+    //! first recruit phase.
+    double selectHeroSec = 0.0;
+
+    //! The time of agents choosing and applying actions in recruit phase.
+    double recruitSec = 0.0;
+
+    //! The time of combat phase including the preparation of next recruit
+    //! phase (e.g. pairing players and filling Taverns).
+    double combatSec = 0.0;
+
+    //! The number of complete games indexed by the seat and the placement - 1.
+    std::array<std::array<std::size_t, NUM_BATTLEGROUNDS_PLAYERS>,
+               NUM_BATTLEGROUNDS_PLAYERS>
+        placements{};
+};
+
+//!
+//! \brief GameRunner class.
+//!
+//! This class plays full games of Battlegrounds without user interaction.
+//! Each player is controlled by an agent, and a batch of games runs on a
+//! thread pool. Each game runs on one thread with the random engine of that
+//! thread seeded from the seed of the batch, so the statistics (except the
+//! time) only depend on the seed, not on the number of threads.
+//!
+class GameRunner
+{
+ public:
+    //! A function that creates an agent for the player in the given seat.
+    //! NOTE: It is called from worker threads at the same time.
+    using AgentFactory =
+        std::function<std::unique_ptr<IAgent>(std::size_t seatIdx)>;
+
+    //! Constructs game runner with given \p agentFactory and \p numThreads.
+    //! \param agentFactory The function that creates an agent.
+    //! \param numThreads The number of worker threads. If it is 0, the number
+    //! of hardware threads is used.
+    explicit GameRunner(AgentFactory agentFactory, std::size_t numThreads = 0);
+
+    //! Sets the maximum number of turns of a game. A game that doesn't end in
+    //! this number of turns is stopped and counted as a truncated game.
+    //! \param maxTurns The maximum number of turns.
+    void SetMaxTurns(std::size_t maxTurns);
+
+    //! Sets the maximum number of actions of a player in a turn. The recruit
+    //! phase of the player is completed when the player reaches this number.
+    //! \param maxActions The maximum number of actions.
+    void SetMaxActionsPerTurn(std::size_t maxActions);
+
+    //! Plays a batch of games.
+    //! \param numGames The number of games to play.
+    //! \param seed The seed that the seed of each game is derived from.
+    //! \return The statistics of games.
+    GameStats Run(std::size_t numGames, unsigned int seed);
+
+    //! Plays a game from the start to the end on the calling thread.
+    //! \param game The game to play. It must not be started.
+    //! \param agents The agents of players in the order of seats.
+    //! \param stats The statistics that the result of the game is added to.
+    //! \return true if the game is complete, false if it is truncated.
+    bool Play(Game& game,
+              const std::array<IAgent*, NUM_BATTLEGROUNDS_PLAYERS>& agents,
+              GameStats& stats) const;
+
+ private:
+    AgentFactory m_agentFactory;
+    ThreadPool m_pool;
+
+    std::size_t m_maxTurns = 100;
+    std::size_t m_maxActionsPerTurn = 50;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_GAME_RUNNER_HPP
@@ -0,0 +1,157 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_VECTOR_ENV_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_VECTOR_ENV_HPP
+
+#include <Rosetta/Battlegrounds/Managers/GameEnv.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief VectorEnvOutputs struct.
+//!
+//! This struct holds the buffers that VectorEnv::Reset() and VectorEnv::Step()
+//! copy the outputs to. The sizes are the same as the getters of VectorEnv,
+//! and a null buffer is skipped.
+//!
+struct VectorEnvOutputs
+{
+    float* observations = nullptr;
+    std::uint8_t* legalMasks = nullptr;
+    std::int32_t* currentPlayers = nullptr;
+    float* rewards = nullptr;
+    std::uint8_t* dones = nullptr;
+};
+
+//!
+//! \brief VectorEnv class.
+//!
+//! This class steps a number of GameEnv at once on a thread pool. Actions are
+//! indices of the fixed action space of GameEnv, and the outputs of all
+//! environments are stored in contiguous buffers in the order of
+//! environments: the observation of the current player, the mask of legal
+//! actions, the index of the current player, the rewards of all seats and
+//! whether the episode is done. An environment whose episode is done is reset
+//! in the same step, so the observation and the mask belong to the new
+//! episode while the rewards and the flag belong to the finished one.
+//!
+//! Reset() and Step() are serialized. The getters return the buffers that
+//! the next call overwrites, so a caller that steps from several threads
+//! passes VectorEnvOutputs to have the outputs copied before the lock is
+//! released.
+//!
+//! An illegal action throws before any environment is changed. If Reset() or
+//! Step() throws after that, some environments may already be stepped or
+//! reset and the outputs no longer match them, so the environment becomes
+//! invalid: Step() throws std::logic_error until Reset() succeeds. Step()
+//! also throws before the first Reset().
+//!
+//! The k-th episode of the i-th environment is seeded from the seed of Reset()
+//! and (i, k), so the outputs don't depend on the number of threads.
+//!
+class VectorEnv
+{
+ public:
+    //! Constructs vector environment with given \p numEnvs and \p numThreads.
+    //! \param numEnvs The number of environments.
+    //! \param numThreads The number of worker threads. If it is 0, the number
+    //! of hardware threads is used. If it is 1, environments are stepped on
+    //! the calling thread.
+    explicit VectorEnv(std::size_t numEnvs, std::size_t numThreads = 1);
+
+    //! Sets the maximum number of turns of an episode.
+    //! \param maxTurns The maximum number of turns.
+    void SetMaxTurns(std::size_t maxTurns);
+
+    //! Sets the maximum number of actions of a player in a turn.
+    //! \param maxActions The maximum number of actions.
+    void SetMaxActionsPerTurn(std::size_t maxActions);
+
+    //! Starts new episodes of all environments.
+    //! \param seed The seed that the seeds of episodes are derived from.
+    //! \param outputs The buffers to copy the outputs to.
+    void Reset(unsigned int seed, const VectorEnvOutputs& outputs = {});
+
+    //! Applies an action to each environment.
+    //! \param actions The indices of actions of NumEnvs() elements. Each one
+    //! must be legal in the current mask of its environment.
+    //! \param outputs The buffers to copy the outputs to.
+    void Step(const std::int32_t* actions,
+              const VectorEnvOutputs& outputs = {});
+
+    //! Returns the number of environments.
+    //! \return The number of environments.
+    std::size_t GetNumEnvs() const;
+
+    //! Returns the environment at \p envIdx.
+    //! \param envIdx The index of environment.
+    //! \return The environment at \p envIdx.
+    GameEnv& GetEnv(std::size_t envIdx);
+
+    //! Returns the observations of (NumEnvs(), NUM_OBSERVATIONS).
+    //! \return The observations of current players.
+    const std::vector<float>& GetObservations() const;
+
+    //! Returns the masks of legal actions of (NumEnvs(), NUM_ACTIONS).
+    //! \return The masks of legal actions.
+    const std::vector<std::uint8_t>& GetLegalMasks() const;
+
+    //! Returns the indices of current players of (NumEnvs()).
+    //! \return The indices of current players.
+    const std::vector<std::int32_t>& GetCurrentPlayers() const;
+
+    //! Returns the rewards of the last step of (NumEnvs(), 8).
+    //! \return The rewards of all seats.
+    const std::vector<float>& GetRewards() const;
+
+    //! Returns the flags of the last step of (NumEnvs()). A flag is 1 if the
+    //! episode was done in the last step and the environment was reset.
+    //! \return The flags that indicate whether episodes were done.
+    const std::vector<std::uint8_t>& GetDones() const;
+
+ private:
+    //! Runs \p func for the index of each environment.
+    template <typename F>
+    void ForEachEnv(F&& func);
+
+    //! Throws std::logic_error if the environment is invalid.
+    void CheckValid() const;
+
+    //! Copies the outputs to non-null buffers of \p outputs.
+    //! \param outputs The buffers to copy the outputs to.
+    void CopyOutputs(const VectorEnvOutputs& outputs) const;
+
+    //! Starts the next episode of the environment.
+    //! \param envIdx The index of environment.
+    void ResetEnv(std::size_t envIdx);
+
+    //! Writes the observation, the mask and the current player.
+    //! \param envIdx The index of environment.
+    void WriteOutputs(std::size_t envIdx);
+
+    std::vector<GameEnv> m_envs;
+    std::vector<std::size_t> m_numEpisodes;
+    ThreadPool m_pool;
+    unsigned int m_seed = 0;
+
+    std::vector<float> m_observations;
+    std::vector<std::uint8_t> m_legalMasks;
+    std::vector<std::int32_t> m_currentPlayers;
+    std::vector<float> m_rewards;
+    std::vector<std::uint8_t> m_dones;
+
+    std::mutex m_stepMutex;
+    bool m_isValid = false;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_VECTOR_ENV_HPP
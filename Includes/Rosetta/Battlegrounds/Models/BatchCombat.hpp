@@ -0,0 +1,135 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_BATCH_COMBAT_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_BATCH_COMBAT_HPP
+
+#include <Rosetta/Battlegrounds/Models/Player.hpp>
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/Common/Enums/GameEnums.hpp>
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief BatchCombat class.
+//!
+//! This class simulates up to NUM_LANES battles between the same two boards
+//! at once. The boards of all battles are packed in structure-of-arrays form
+//! (an array of lanes for each side, slot and stat), so damage and death
+//! resolution of all battles run as loops over lanes that compilers can
+//! vectorize. Only minions without powers in combat (triggers, deathrattles
+//! and start of combat effects) are supported, and the keywords are limited
+//! to taunt and divine shield. It follows the rules of Battle including the
+//! order of attackers, but each lane has its own random engine, so results
+//! match Battle statistically, not battle by battle.
+//!
+class BatchCombat
+{
+ public:
+    //! The maximum number of battles to simulate at once.
+    static constexpr std::size_t NUM_LANES = 64;
+
+    //! Returns a value indicating whether battles between the recruit fields
+    //! of two players can be simulated by this class.
+    //! \param player1 The first player.
+    //! \param player2 The second player.
+    //! \return true if the battles can be simulated, false otherwise.
+    static bool IsSupported(const Player& player1, const Player& player2);
+
+    //! Constructs batch combat with the recruit fields of given players.
+    //! \param player1 The first player.
+    //! \param player2 The second player.
+    BatchCombat(const Player& player1, const Player& player2);
+
+    //! Simulates battles between the boards.
+    //! \param numBattles The number of battles, at most NUM_LANES.
+    //! \param seed The seed of the random engines of lanes.
+    //! \param results The array to store the result of each battle and the
+    //! damage to the hero of loser. It must have \p numBattles elements.
+    void Run(std::size_t numBattles, unsigned int seed,
+             std::tuple<BattleResult, int>* results);
+
+ private:
+    static constexpr std::size_t NUM_SIDES = 2;
+    static constexpr std::size_t NUM_SLOTS = MAX_FIELD_SIZE;
+
+    template <typename T>
+    using LaneArray = std::array<T, NUM_LANES>;
+
+    template <typename T>
+    using SlotArray =
+        std::array<std::array<LaneArray<T>, NUM_SLOTS>, NUM_SIDES>;
+
+    //! Resets lanes to the initial boards.
+    //! \param numBattles The number of lanes to activate.
+    //! \param seed The seed of the random engines of lanes.
+    void Reset(std::size_t numBattles, unsigned int seed);
+
+    //! Returns a random integer in [0, \p count) from the engine of the lane.
+    //! \param lane The index of lane.
+    //! \param count The number of possible values.
+    //! \return A random integer in [0, \p count).
+    int GetRandom(std::size_t lane, int count);
+
+    //! Finds the attacker and the target of each active lane.
+    void SelectAttacks();
+
+    //! Applies damage between the attacker and the target of each lane.
+    void ResolveDamage();
+
+    //! Removes destroyed minions and updates the next attackers.
+    void ResolveDeath();
+
+    //! Switches the turn and checks whether each lane is done.
+    void FinishTurn();
+
+    //! Removes a minion at the given position of each lane.
+    //! \param side The side of minions.
+    //! \param values The stat to shift.
+    template <typename T>
+    void ShiftSlots(std::size_t side, SlotArray<T>& values);
+
+    // Initial boards
+    std::array<std::array<int, NUM_SLOTS>, NUM_SIDES> m_initAttack{};
+    std::array<std::array<int, NUM_SLOTS>, NUM_SIDES> m_initHealth{};
+    std::array<std::array<int, NUM_SLOTS>, NUM_SIDES> m_initTier{};
+    std::array<std::array<std::uint8_t, NUM_SLOTS>, NUM_SIDES>
+        m_initTaunt{};
+    std::array<std::array<std::uint8_t, NUM_SLOTS>, NUM_SIDES>
+        m_initShield{};
+    std::array<int, NUM_SIDES> m_initCount{};
+    std::array<int, NUM_SIDES> m_playerTier{};
+
+    // Boards of lanes
+    SlotArray<int> m_attack{};
+    SlotArray<int> m_health{};
+    SlotArray<int> m_tier{};
+    SlotArray<std::uint8_t> m_taunt{};
+    SlotArray<std::uint8_t> m_shield{};
+    std::array<LaneArray<int>, NUM_SIDES> m_count{};
+    std::array<LaneArray<int>, NUM_SIDES> m_nextAttacker{};
+
+    // States of lanes
+    LaneArray<int> m_turn{};
+    LaneArray<std::uint8_t> m_isActive{};
+    LaneArray<std::uint8_t> m_prevAttackSuccess{};
+    LaneArray<std::uint8_t> m_curAttackSuccess{};
+    LaneArray<std::uint64_t> m_randomState{};
+
+    // Attacks of lanes
+    LaneArray<int> m_attackerIdx{};
+    LaneArray<int> m_targetIdx{};
+    LaneArray<std::uint8_t> m_isAttackerDestroyed{};
+    LaneArray<std::uint8_t> m_isTargetDestroyed{};
+    std::array<LaneArray<int>, NUM_SIDES> m_deadPos{};
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_BATCH_COMBAT_HPP
@@ -25,15 +25,41 @@ class Battle
     //! Constructs Battle instance with given game context and players.
     //! \param player1 The first player.
     //! \param player2 The second player.
+    //! The players refer to this battle until it is destroyed.
     Battle(Player& player1, Player& player2);
 
+    //! Destructor.
+    ~Battle();
+
+    //! Deleted copy constructor.
+    Battle(const Battle&) = delete;
+
+    //! Deleted move constructor.
+    Battle(Battle&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    Battle& operator=(const Battle&) = delete;
+
+    //! Deleted move assignment operator.
+    Battle& operator=(Battle&&) noexcept = delete;
+
     //! Initializes something before simulating a battle.
     //! i.e. decide who goes first, run hero powers
     void Initialize();
 
-    //! Simulates a battle.
+    //! Simulates a battle and deals damage to the hero of the loser.
     void Run();
 
+    //! Simulates a battle without dealing damage to the heroes.
+    void Simulate();
+
+    //! Deals damage to the hero of the loser.
+    void DealDamage();
+
+    //! Seeds the random engine that battles on the calling thread use.
+    //! \param seed The seed of the random engine.
+    static void Seed(unsigned int seed);
+
     //! Attacks one of the opponent minions.
     //! \return The flag that indicates the attacker does attack.
     bool Attack();
@@ -51,6 +77,14 @@ class Battle
     //! \param beforeAttack The flag that indicates it is called before attack.
     void ProcessDestroy(bool beforeAttack);
 
+    //! Activates triggers of TURN_START of the minions on the field.
+    //! \param fieldZone The field zone whose turn starts.
+    void ProcessTurnStart(FieldZone& fieldZone);
+
+    //! Activates triggers of DEATH of the alive minions on both fields.
+    //! \param deadMinion The minion that is destroyed.
+    void ProcessDeathTrigger(Minion& deadMinion);
+
     //! Checks it is done.
     //! \return true if it is done, false otherwise.
     bool IsDone() const;
@@ -62,6 +96,11 @@ class Battle
     //! \return The total damage according to the result.
     int CalculateDamage();
 
+    //! Returns the opponent of \p player in this battle.
+    //! \param player The player in this battle.
+    //! \return The opponent of \p player.
+    Player& GetOpponentPlayer(const Player& player);
+
     //! Returns the field zone of player 1.
     //! \return The field zone of player 1.
     const FieldZone& GetPlayer1Field() const;
@@ -0,0 +1,160 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_COMBAT_CACHE_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_COMBAT_CACHE_HPP
+
+#include <Rosetta/Battlegrounds/Models/CombatSimulator.hpp>
+#include <Rosetta/Battlegrounds/Zones/FieldZone.hpp>
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace RosettaStone::Battlegrounds
+{
+//! Encodes two field zones into a canonical list of values. Each minion is
+//! encoded by its card, attack, health, taunt, divine shield and deathrattle
+//! in the order of zone positions.
+//! NOTE: Only the board state is encoded. State outside it (e.g. enchantments
+//! that grant other keywords, or the heroes) is not, so two combats that
+//! differ only in such state have the same encoding.
+//! \param field1 The field zone of the first player.
+//! \param field2 The field zone of the second player.
+//! \return The canonical encoding of two field zones.
+std::vector<int> EncodeBoards(const FieldZone& field1, const FieldZone& field2);
+
+//! Calculates the canonical hash of two field zones. It covers the same
+//! values as EncodeBoards().
+//! \param field1 The field zone of the first player.
+//! \param field2 The field zone of the second player.
+//! \return The canonical hash of two field zones.
+std::size_t CalculateBoardHash(const FieldZone& field1,
+                               const FieldZone& field2);
+
+//!
+//! \brief CombatKey struct.
+//!
+//! This struct is the key of a combat in CombatCache. It stores the canonical
+//! encoding of both boards, the tiers of both players that the damage depends
+//! on and the number of battles to simulate.
+//!
+struct CombatKey
+{
+    //! Constructs combat key with given players and \p sampleCount.
+    //! \param player1 The first player.
+    //! \param player2 The second player.
+    //! \param sampleCount The number of battles to simulate.
+    CombatKey(const Player& player1, const Player& player2,
+              std::size_t sampleCount);
+
+    //! Operator overloading: operator==.
+    bool operator==(const CombatKey& rhs) const;
+
+    std::vector<int> values;
+    std::size_t numSamples = 0;
+    std::size_t hash = 0;
+};
+
+//!
+//! \brief CombatKeyHash struct.
+//!
+//! This struct returns the precomputed hash of CombatKey.
+//!
+struct CombatKeyHash
+{
+    std::size_t operator()(const CombatKey& key) const noexcept
+    {
+        return key.hash;
+    }
+};
+
+//!
+//! \brief CombatCacheStats struct.
+//!
+//! This struct stores the statistics of CombatCache.
+//!
+struct CombatCacheStats
+{
+    //! Returns the ratio of hits to lookups.
+    //! \return The ratio of hits to lookups, or 0 if there is no lookup.
+    double GetHitRate() const;
+
+    std::size_t numHits = 0;
+    std::size_t numMisses = 0;
+    std::size_t numEvictions = 0;
+};
+
+//!
+//! \brief CombatCache class.
+//!
+//! This class is a bounded LRU cache of combat outcomes in front of
+//! CombatSimulator. Boards that have the same encoding (see EncodeBoards())
+//! share an outcome, so the simulator runs once for them.
+//! All methods can be called from several threads at the same time.
+//! NOTE: The outcome of the first seed is reused for later seeds, and two
+//! threads that miss the same key at the same time both run the simulator.
+//!
+class CombatCache
+{
+ public:
+    //! Constructs combat cache with given \p simulator and \p capacity.
+    //! \param simulator The simulator that runs on a cache miss.
+    //! \param capacity The maximum number of outcomes to store.
+    CombatCache(CombatSimulator& simulator, std::size_t capacity);
+
+    //! Returns the outcome of battles between two players. It runs the
+    //! simulator only if the outcome isn't in the cache.
+    //! \param player1 The first player.
+    //! \param player2 The second player.
+    //! \param numSamples The number of battles to simulate.
+    //! \param seed The seed of the simulator on a cache miss.
+    //! \return The outcome of battles from the point of view of \p player1.
+    CombatResult Run(const Player& player1, const Player& player2,
+                     std::size_t numSamples, unsigned int seed);
+
+    //! Finds the outcome of \p key and marks it as the most recently used.
+    //! \param key The key of a combat.
+    //! \return The outcome if it is in the cache, std::nullopt otherwise.
+    std::optional<CombatResult> Find(const CombatKey& key);
+
+    //! Stores the outcome of \p key. The least recently used outcome is
+    //! evicted if the cache is full.
+    //! \param key The key of a combat.
+    //! \param result The outcome of the combat.
+    void Insert(const CombatKey& key, const CombatResult& result);
+
+    //! Removes all outcomes. The statistics are kept.
+    void Clear();
+
+    //! Returns the number of outcomes in the cache.
+    //! \return The number of outcomes in the cache.
+    std::size_t GetSize() const;
+
+    //! Returns the statistics of the cache.
+    //! \return The statistics of the cache.
+    CombatCacheStats GetStats() const;
+
+ private:
+    using Entry = std::pair<CombatKey, CombatResult>;
+
+    CombatSimulator& m_simulator;
+    std::size_t m_capacity = 0;
+
+    //! Entries in the order of use, the most recently used first.
+    std::list<Entry> m_entries;
+    std::unordered_map<CombatKey, std::list<Entry>::iterator, CombatKeyHash>
+        m_index;
+
+    CombatCacheStats m_stats;
+    mutable std::mutex m_mutex;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_COMBAT_CACHE_HPP
@@ -0,0 +1,143 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATTLEGROUNDS_COMBAT_SIMULATOR_HPP
+#define ROSETTASTONE_BATTLEGROUNDS_COMBAT_SIMULATOR_HPP
+
+#include <Rosetta/Battlegrounds/Models/Player.hpp>
+#include <Rosetta/Common/Enums/GameEnums.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <chrono>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace RosettaStone::Battlegrounds
+{
+//!
+//! \brief CombatResult struct.
+//!
+//! This struct stores the outcome of a number of simulated battles from the
+//! point of view of player 1.
+//!
+struct CombatResult
+{
+    //! Returns the probability that player 1 wins.
+    //! \return The probability that player 1 wins.
+    double GetWinProbability() const;
+
+    //! Returns the probability that the battle ends in a draw.
+    //! \return The probability that the battle ends in a draw.
+    double GetTieProbability() const;
+
+    //! Returns the probability that player 1 loses.
+    //! \return The probability that player 1 loses.
+    double GetLossProbability() const;
+
+    //! Returns the expected damage, positive if player 1 deals it and
+    //! negative if player 1 takes it.
+    //! \return The expected damage.
+    double GetAverageDamage() const;
+
+    std::size_t numSamples = 0;
+    std::size_t numWins = 0;
+    std::size_t numTies = 0;
+    std::size_t numLosses = 0;
+
+    //! The number of wins of player 1 indexed by the damage dealt.
+    std::vector<std::size_t> damageDealt;
+
+    //! The number of losses of player 1 indexed by the damage taken.
+    std::vector<std::size_t> damageTaken;
+};
+
+//!
+//! \brief CombatSimulator class.
+//!
+//! This class estimates the outcome of a battle between two boards by running
+//! a number of independent battles on a thread pool. Each battle runs on
+//! copies of the boards with its own seed, so the given players are never
+//! changed and the result only depends on the seed, not on the number of
+//! threads. Boards without powers in combat are simulated by BatchCombat
+//! in batches of battles unless the batch kernel is disabled. Run() restores
+//! the state of the engine (Random) of the calling thread, so it doesn't
+//! change the random sequence of the caller.
+//!
+class CombatSimulator
+{
+ public:
+    //! Constructs combat simulator with given \p numThreads.
+    //! \param numThreads The number of worker threads. If it is 0, the number
+    //! of hardware threads is used.
+    explicit CombatSimulator(std::size_t numThreads = 0);
+
+    //! Simulates battles between the recruit fields of two players.
+    //! \param player1 The first player.
+    //! \param player2 The second player.
+    //! \param numSamples The number of battles to simulate.
+    //! \param seed The seed that the seed of each battle is derived from.
+    //! \return The outcome of battles from the point of view of \p player1.
+    CombatResult Run(const Player& player1, const Player& player2,
+                     std::size_t numSamples, unsigned int seed);
+
+    //! Simulates battles between the recruit fields of two players until
+    //! \p numSamples battles are simulated or \p timeBudget elapses.
+    //! Battles run in rounds and the time is checked between rounds, so the
+    //! battles that ran are the first battles of Run() with the same seed,
+    //! and at least one round runs.
+    //! \param player1 The first player.
+    //! \param player2 The second player.
+    //! \param numSamples The maximum number of battles to simulate.
+    //! \param seed The seed that the seed of each battle is derived from.
+    //! \param timeBudget The time to stop starting new rounds after.
+    //! \return The outcome of battles from the point of view of \p player1.
+    //! Its numSamples is the number of battles that actually ran.
+    CombatResult Run(const Player& player1, const Player& player2,
+                     std::size_t numSamples, unsigned int seed,
+                     std::chrono::microseconds timeBudget);
+
+    //! Enables or disables the batch kernel for boards that support it.
+    //! \param isEnabled The flag indicates the batch kernel is enabled.
+    void SetBatchKernelEnabled(bool isEnabled);
+
+    //! Returns the seed of the battle at \p sampleIdx.
+    //! \param seed The seed that is passed to Run().
+    //! \param sampleIdx The index of battle.
+    //! \return The seed of the battle.
+    static unsigned int GetSampleSeed(unsigned int seed,
+                                      std::size_t sampleIdx);
+
+ private:
+    //! Simulates battles until \p numSamples battles are simulated or
+    //! \p deadline passes.
+    //! \param player1 The first player.
+    //! \param player2 The second player.
+    //! \param numSamples The maximum number of battles to simulate.
+    //! \param seed The seed that the seed of each battle is derived from.
+    //! \param deadline The time to stop starting new rounds after, or
+    //! std::nullopt to simulate all battles.
+    //! \return The outcome of battles from the point of view of \p player1.
+    CombatResult RunUntil(
+        const Player& player1, const Player& player2, std::size_t numSamples,
+        unsigned int seed,
+        std::optional<std::chrono::steady_clock::time_point> deadline);
+
+    //! Simulates a battle on copies of two players.
+    //! \param player1 The first player.
+    //! \param player2 The second player.
+    //! \param seed The seed of the battle.
+    //! \return The result of battle and the damage to the hero of loser.
+    static std::tuple<BattleResult, int> RunSample(const Player& player1,
+                                                   const Player& player2,
+                                                   unsigned int seed);
+
+    ThreadPool m_pool;
+    bool m_isBatchKernelEnabled = true;
+};
+}  // namespace RosettaStone::Battlegrounds
+
+#endif  // ROSETTASTONE_BATTLEGROUNDS_COMBAT_SIMULATOR_HPP
@@ -20,7 +20,7 @@ class Hero
 {
  public:
     //! Initializes a Hero instance and assigns the information.
-    //! \param heroCard The card of a Hero instance.
+    //! \param heroCard The card of a Hero instance. It is shared, not copied.
     void Initialize(const Card& heroCard);
 
     //! Takes damage to the hero.
@@ -28,7 +28,7 @@ class Hero
     //! \param amount The amount of damage.
     void TakeDamage(Player& player, int amount);
 
-    Card card;
+    const Card* card = nullptr;
     int health = 0;
 };
 }  // namespace RosettaStone::Battlegrounds
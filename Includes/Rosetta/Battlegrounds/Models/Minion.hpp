@@ -29,9 +29,14 @@ class Minion
     Minion() = default;
 
     //! Constructs Minion instance with given \p card and \p poolIdx.
-    //! \param card A card that contains the minion data.
+    //! \param card A card that contains the minion data. It is shared, not
+    //! copied, so it must outlive the minion (e.g. a card of Cards).
     //! \param poolIdx The index of minion pool.
-    explicit Minion(Card card, int poolIdx = -1);
+    explicit Minion(const Card& card, int poolIdx = -1);
+
+    //! Returns the card of the minion.
+    //! \return The card of the minion.
+    const Card& GetCard() const;
 
     //! Returns the value of index.
     //! \return The value of index.
@@ -107,6 +112,10 @@ class Minion
     //! \param val The value of health to set.
     void SetHealth(int val);
 
+    //! Returns the type of trigger that the minion has.
+    //! \return The type of trigger, or TriggerType::NONE if it has no trigger.
+    TriggerType GetTriggerType() const;
+
     //! Returns the flag that indicates whether it has deathrattle.
     //! \return The flag that indicates whether it has deathrattle.
     bool HasDeathrattle() const;
@@ -173,15 +182,16 @@ class Minion
 
     Trigger activatedTrigger;
 
-    std::function<Player&()> getPlayerCallback;
+    //! The player that owns the minion.
+    Player* owner = nullptr;
 
  private:
     //! Gets a list of tasks according to the power type.
     //! \param type The type of power.
     //! \return A list of tasks according to the power type.
-    std::vector<TaskType> GetTasks(PowerType type);
+    std::vector<TaskType> GetTasks(PowerType type) const;
 
-    Card m_card;
+    const Card* m_card = nullptr;
     int m_index = -1;
     int m_poolIdx = -1;
 
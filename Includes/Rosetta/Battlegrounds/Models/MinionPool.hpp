@@ -13,15 +13,17 @@
 #include <Rosetta/Common/Constants.hpp>
 
 #include <array>
+#include <vector>
 
 namespace RosettaStone::Battlegrounds
 {
-using MinionPoolData = std::tuple<Minion, int, bool>;
-
 //!
 //! \brief MinionPool class.
 //!
 //! This class stores a list of minion in pool for Hearthstone: Battlegrounds.
+//! The indices of minions in the pool are kept in a list per tier, so a minion
+//! is removed from or returned to the pool in O(1) and minions for Tavern are
+//! picked without copying or shuffling the whole pool.
 //!
 class MinionPool
 {
@@ -39,7 +41,8 @@ class MinionPool
     //! \param tavern The tavern to add minions.
     void AddMinionsToTavern(Player& player, Tavern& tavern);
 
-    //! Returns a minion to the pool.
+    //! Returns a minion to the pool. It does nothing if the minion is already
+    //! in the pool.
     //! \param idx The pool index of a minion.
     void ReturnMinion(int idx);
 
@@ -52,8 +55,22 @@ class MinionPool
     std::vector<Minion> GetMinions(int minTier, int maxTier, bool isInPoolOnly);
 
  private:
-    std::array<MinionPoolData, NUM_TOTAL_TAVERN_MINIONS> m_minions;
+    //! Adds the minion at \p idx to the list of its tier.
+    //! \param idx The pool index of a minion.
+    void AddAvailable(int idx);
+
+    //! Removes the minion at \p idx from the list of its tier.
+    //! \param idx The pool index of a minion.
+    void RemoveAvailable(int idx);
+
+    std::array<Minion, NUM_TOTAL_TAVERN_MINIONS> m_minions;
     std::size_t m_count = 0;
+
+    //! The pool indices of minions in the pool for each tier.
+    std::array<std::vector<int>, TIER_UPPER_LIMIT> m_availableIdx;
+
+    //! The position of each minion in its list, -1 if not in the pool.
+    std::array<int, NUM_TOTAL_TAVERN_MINIONS> m_availablePos{};
 };
 }  // namespace RosettaStone::Battlegrounds
 
@@ -14,12 +14,12 @@
 #include <Rosetta/Battlegrounds/Zones/HandZone.hpp>
 
 #include <array>
-#include <functional>
 #include <limits>
 
 namespace RosettaStone::Battlegrounds
 {
 class Battle;
+class Game;
 
 //!
 //! \brief Player class.
@@ -33,6 +33,11 @@ class Player
     //! \return The field according the status.
     FieldZone& GetField();
 
+    //! Returns the opponent player. It is the opponent of the current battle
+    //! if the player is in a battle, the player to fight next otherwise.
+    //! \return The opponent player.
+    Player& GetOpponentPlayer();
+
     //! Initializes a Hero instance.
     //! \param idx The index of hero choices.
     void SelectHero(std::size_t idx);
@@ -61,6 +66,9 @@ class Player
     //! Refreshes a list of minions in Tavern's field.
     void RefreshTavern();
 
+    //! Returns a list of minions in Tavern's field to the minion pool.
+    void ClearTavern();
+
     //! Freezes a list of minions in Tavern's field.
     void FreezeTavern();
 
@@ -93,17 +101,12 @@ class Player
 
     TaskStack taskStack;
 
-    std::function<void(Player&)> selectHeroCallback;
-    std::function<void(Player&)> prepareTavernMinionsCallback;
-    std::function<void(Player&, std::size_t)> purchaseMinionCallback;
-    std::function<int()> getNextCardIndexCallback;
-    std::function<void(int)> returnMinionCallback;
-    std::function<void(Player&)> clearTavernMinionsCallback;
-    std::function<void(Player&)> upgradeTavernCallback;
-    std::function<void()> completeRecruitCallback;
-    std::function<Player&(Player&)> getOpponentPlayerCallback;
-    std::function<Battle&()> getBattleCallback;
-    std::function<void(Player&)> processDefeatCallback;
+    //! The game that the player belongs to. A player without a game (e.g. a
+    //! copy that CombatSimulator makes) can only fight a battle.
+    Game* game = nullptr;
+
+    //! The battle that the player is fighting, nullptr if not in a battle.
+    Battle* battle = nullptr;
 
     std::array<int, 4> heroChoices{ 0, 0, 0, 0 };
 
@@ -28,8 +28,9 @@ class Spell
     Spell() = default;
 
     //! Constructs Minion instance with given \p card.
-    //! \param card A card that contains the spell data.
-    explicit Spell(Card card);
+    //! \param card A card that contains the spell data. It is shared, not
+    //! copied, so it must outlive the spell (e.g. a card of Cards).
+    explicit Spell(const Card& card);
 
     //! Returns the value of zone type.
     //! \return The value of zone type.
@@ -48,7 +49,7 @@ class Spell
     void SetZonePosition(int pos);
 
  private:
-    Card m_card;
+    const Card* m_card = nullptr;
 
     ZoneType m_zoneType = ZoneType::INVALID;
     int m_zonePos = -1;
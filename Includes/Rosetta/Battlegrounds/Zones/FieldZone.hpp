@@ -11,6 +11,7 @@
 #include <Rosetta/Common/Constants.hpp>
 
 #include <array>
+#include <cstdint>
 #include <optional>
 
 namespace RosettaStone::Battlegrounds
@@ -90,6 +91,12 @@ class FieldZone
     //! \return true if this zone is full, false otherwise.
     bool IsFull() const;
 
+    //! Returns a value indicating whether any minion in this zone has a
+    //! trigger of \p type.
+    //! \param type The type of trigger.
+    //! \return true if any minion has a trigger of \p type, false otherwise.
+    bool HasTrigger(TriggerType type) const;
+
     //! Returns all minions in this zone.
     //! \return All minions in this zone.
     std::vector<std::reference_wrapper<Minion>> GetAll();
@@ -150,11 +157,48 @@ class FieldZone
         }
     }
 
+    //! Runs \p functor on each minion that is alive and has a trigger of
+    //! \p type. It visits minions in the same order as ForEachAlive(), so
+    //! it can replace ForEachAlive() that activates triggers of \p type.
+    //! \param type The type of trigger.
+    //! \param functor A function to run for each minion.
+    template <typename Functor>
+    void ForEachAliveWithTrigger(TriggerType type, Functor&& functor)
+    {
+        const auto typeIdx = static_cast<std::size_t>(type);
+
+        // NOTE: The mask is read again for each position because the functor
+        // can add or remove minions.
+        for (std::size_t i = 0; i < m_minions.size(); ++i)
+        {
+            if ((m_triggerMasks[typeIdx] >> i & 1) == 0)
+            {
+                continue;
+            }
+
+            auto& minion = m_minions[i];
+            if (minion.has_value() && !minion.value().IsDestroyed())
+            {
+                functor(minion);
+            }
+        }
+    }
+
  private:
+    //! Updates the positions of minions that have a trigger of each type.
+    void UpdateTriggerMasks();
+
+    static constexpr std::size_t NUM_TRIGGER_TYPES =
+        static_cast<std::size_t>(TriggerType::MULTI_TRIGGER) + 1;
+
     const ZoneType m_type = ZoneType::PLAY;
 
     std::array<MinionData, MAX_FIELD_SIZE> m_minions;
     int m_count = 0;
+
+    //! The bit i of each mask is set if the minion at position i has a
+    //! trigger of that type.
+    std::array<std::uint8_t, NUM_TRIGGER_TYPES> m_triggerMasks{};
 };
 }  // namespace RosettaStone::Battlegrounds
 
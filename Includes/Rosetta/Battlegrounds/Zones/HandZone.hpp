@@ -29,6 +29,24 @@ using CardData = std::variant<Minion, Spell>;
 class HandZone
 {
  public:
+    //! Default constructor.
+    HandZone() = default;
+
+    //! Default destructor.
+    ~HandZone() = default;
+
+    //! Default copy constructor.
+    HandZone(const HandZone& rhs) = default;
+
+    //! Deleted move constructor.
+    HandZone(HandZone&& rhs) noexcept = delete;
+
+    //! Copy assignment operator.
+    HandZone& operator=(const HandZone& rhs);
+
+    //! Deleted move assignment operator.
+    HandZone& operator=(HandZone&& rhs) noexcept = delete;
+
     //! Operator overloading for operator[].
     //! \param zonePos The zone position of card.
     //! \return The card at \p zonePos.
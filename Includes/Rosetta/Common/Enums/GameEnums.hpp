@@ -19,6 +19,17 @@ enum class PlayerType
     PLAYER1,  //!< The first player.
     PLAYER2,  //!< The second player.
 };
+
+//! \brief An enumerator for identifying the action of a player.
+enum class ActionType
+{
+    PLAY_CARD,   //!< Play a card in hand.
+    ATTACK,      //!< Attack with a character.
+    HERO_POWER,  //!< Use hero power.
+    TRADE_CARD,  //!< Trade a card in hand.
+    CHOOSE,      //!< Choose a card of the current choice.
+    END_TURN,    //!< End the turn.
+};
 }  // namespace PlayMode
 
 namespace Battlegrounds
@@ -49,6 +60,19 @@ enum class BattleResult
     PLAYER2_WIN,  //!< Player 2 win.
     DRAW,         //!< Draw.
 };
+
+//! \brief An enumerator for identifying the action in recruit phase.
+enum class ActionType
+{
+    PURCHASE,   //!< Purchase a minion in Tavern.
+    SELL,       //!< Sell a minion on the field.
+    PLAY,       //!< Play a card in hand.
+    UPGRADE,    //!< Upgrade Tavern.
+    REFRESH,    //!< Refresh Tavern.
+    FREEZE,     //!< Freeze Tavern.
+    REARRANGE,  //!< Rearrange a minion on the field.
+    END_TURN,   //!< Complete recruit.
+};
 }  // namespace Battlegrounds
 }  // namespace RosettaStone
 
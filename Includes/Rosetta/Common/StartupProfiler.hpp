@@ -0,0 +1,165 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_STARTUP_PROFILER_HPP
+#define ROSETTASTONE_STARTUP_PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief StartupPhase struct.
+//!
+//! This struct stores the wall time and the allocations of a startup phase.
+//! The name of a nested phase is joined to the name of its parent phase with
+//! '/' (e.g. "PlayMode::Cards/CardLoader::Load/JSON parse"). The values of
+//! a phase include the values of its nested phases.
+//!
+struct StartupPhase
+{
+    std::string name;
+    std::size_t depth = 0;
+    std::size_t numCalls = 0;
+    double elapsedMs = 0.0;
+    std::size_t numAllocations = 0;
+    std::size_t allocatedBytes = 0;
+};
+
+//!
+//! \brief StartupProfiler class.
+//!
+//! This class records the startup phases such as loading cards.json and
+//! creating card definitions. A phase is recorded by ScopedPhase, and a phase
+//! that is entered several times (e.g. scanning the text of each card)
+//! accumulates its values.
+//!
+//! Allocations are counted only if the library is built with the CMake option
+//! ROSETTASTONE_COUNT_ALLOCATIONS, which replaces the global operator new.
+//! Otherwise the allocation values of all phases are 0.
+//!
+//! Allocations are counted per thread, so a phase counts only the allocations
+//! of the thread that entered it. The allocations of worker threads are added
+//! to the phase explicitly by WorkerAllocations.
+//!
+class StartupProfiler
+{
+ public:
+    //!
+    //! \brief ScopedPhase class.
+    //!
+    //! This class records a startup phase from its construction to its
+    //! destruction.
+    //!
+    class ScopedPhase
+    {
+     public:
+        //! Constructs scoped phase with given \p name and starts recording.
+        //! \param name The name of the phase.
+        explicit ScopedPhase(std::string_view name);
+
+        //! Destructor: Stops recording and adds the values to the phase.
+        ~ScopedPhase();
+
+        //! Deleted copy constructor.
+        ScopedPhase(const ScopedPhase&) = delete;
+
+        //! Deleted move constructor.
+        ScopedPhase(ScopedPhase&&) noexcept = delete;
+
+        //! Deleted copy assignment operator.
+        ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+        //! Deleted move assignment operator.
+        ScopedPhase& operator=(ScopedPhase&&) noexcept = delete;
+
+     private:
+        std::string m_name;
+        std::size_t m_phaseIdx = 0;
+        std::chrono::steady_clock::time_point m_startTime;
+        std::size_t m_startNumAllocations = 0;
+        std::size_t m_startAllocatedBytes = 0;
+    };
+
+    //!
+    //! \brief WorkerAllocations class.
+    //!
+    //! This class sums the allocations of tasks that run on worker threads
+    //! (e.g. ThreadPool::ParallelFor), so that the thread that waits for them
+    //! can add them to its open phase.
+    //!
+    class WorkerAllocations
+    {
+     public:
+        //! Calls \p func and adds the allocations of the current thread during
+        //! the call to the sum. It can be called from several threads.
+        //! \param func The function to call.
+        template <typename F>
+        void Run(F&& func)
+        {
+            const std::size_t startNumAllocations = GetNumThreadAllocations();
+            const std::size_t startAllocatedBytes = GetThreadAllocatedBytes();
+
+            func();
+
+            m_numAllocations.fetch_add(
+                GetNumThreadAllocations() - startNumAllocations,
+                std::memory_order_relaxed);
+            m_allocatedBytes.fetch_add(
+                GetThreadAllocatedBytes() - startAllocatedBytes,
+                std::memory_order_relaxed);
+        }
+
+        //! Adds the sum to the allocations of the current thread and clears it.
+        void AddToCurrentThread();
+
+     private:
+        std::atomic<std::size_t> m_numAllocations{ 0 };
+        std::atomic<std::size_t> m_allocatedBytes{ 0 };
+    };
+
+    //! Returns a list of recorded phases in the order they were entered.
+    //! \return A list of recorded phases.
+    static std::vector<StartupPhase> GetPhases();
+
+    //! Returns a phase that matches \p name.
+    //! \param name The name of the phase.
+    //! \return A phase that matches \p name, or an empty phase if not found.
+    static StartupPhase FindPhase(std::string_view name);
+
+    //! Clears all recorded phases.
+    static void Reset();
+
+    //! Returns the recorded phases as a human-readable table.
+    //! \return The recorded phases as a human-readable table.
+    static std::string ToString();
+
+    //! Returns whether allocations of phases are counted.
+    //! \return true if the library is built with
+    //! ROSETTASTONE_COUNT_ALLOCATIONS, false otherwise.
+    static bool IsCountingAllocations();
+
+    //! Returns the number of allocations of the current thread.
+    //! \return The number of allocations of the current thread.
+    static std::size_t GetNumThreadAllocations() noexcept;
+
+    //! Returns the allocated bytes of the current thread.
+    //! \return The allocated bytes of the current thread.
+    static std::size_t GetThreadAllocatedBytes() noexcept;
+
+    //! Counts an allocation of \p size bytes on the current thread.
+    //! It is called by the global operator new if allocations are counted.
+    //! \param size The size of the allocation.
+    static void CountAllocation(std::size_t size) noexcept;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_STARTUP_PROFILER_HPP
@@ -0,0 +1,149 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_THREAD_POOL_HPP
+#define ROSETTASTONE_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief ThreadPool class.
+//!
+//! This class runs tasks on a fixed number of worker threads. A task is added
+//! by Enqueue() and its result is returned through std::future. ParallelFor()
+//! splits an index range into chunks and waits until all of them are done.
+//!
+class ThreadPool
+{
+ public:
+    //! Constructs thread pool with given \p numThreads.
+    //! \param numThreads The number of worker threads. If it is 0, the number
+    //! of hardware threads is used.
+    explicit ThreadPool(std::size_t numThreads = 0);
+
+    //! Destructor: Runs the remaining tasks and joins worker threads.
+    ~ThreadPool();
+
+    //! Deleted copy constructor.
+    ThreadPool(const ThreadPool&) = delete;
+
+    //! Deleted move constructor.
+    ThreadPool(ThreadPool&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Deleted move assignment operator.
+    ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+    //! Returns the number of hardware threads (at least 1).
+    //! \return The number of hardware threads.
+    static std::size_t GetHardwareConcurrency();
+
+    //! Returns the number of worker threads.
+    //! \return The number of worker threads.
+    std::size_t GetNumThreads() const;
+
+    //! Adds a task to the queue.
+    //! \param func The task to run on a worker thread.
+    //! \return The future that stores the result of the task.
+    template <typename F>
+    std::future<std::invoke_result_t<F>> Enqueue(F&& func)
+    {
+        using ResultType = std::invoke_result_t<F>;
+
+        auto task = std::make_shared<std::packaged_task<ResultType()>>(
+            std::forward<F>(func));
+        std::future<ResultType> result = task->get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_stop)
+            {
+                throw std::runtime_error("Enqueue on stopped ThreadPool");
+            }
+
+            m_tasks.emplace([task]() { (*task)(); });
+        }
+
+        m_condition.notify_one();
+        return result;
+    }
+
+    //! Calls \p func for each index in [0, \p count) on worker threads and
+    //! waits until all calls are done. If any call throws an exception, the
+    //! first one is rethrown after all calls are done. It must not be called
+    //! from a task of the same pool.
+    //! \param count The number of indices.
+    //! \param func The function that takes an index.
+    template <typename F>
+    void ParallelFor(std::size_t count, F&& func)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // NOTE: Several chunks per thread balance the load when the cost of
+        // each index varies.
+        const std::size_t numChunks =
+            std::min(count, m_workers.size() * 4);
+        const std::size_t chunkSize = (count + numChunks - 1) / numChunks;
+
+        std::vector<std::future<void>> futures;
+        futures.reserve(numChunks);
+
+        for (std::size_t begin = 0; begin < count; begin += chunkSize)
+        {
+            const std::size_t end = std::min(count, begin + chunkSize);
+
+            futures.emplace_back(Enqueue([&func, begin, end]() {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    func(i);
+                }
+            }));
+        }
+
+        for (auto& future : futures)
+        {
+            future.wait();
+        }
+
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+    }
+
+ private:
+    //! Runs tasks in the queue until the pool is stopped.
+    void Run();
+
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_tasks;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stop = false;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_THREAD_POOL_HPP
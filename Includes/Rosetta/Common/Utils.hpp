@@ -10,11 +10,13 @@
 #include <effolkronium/random.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 //! Checks all conditions are true.
 //! \param t A value to check that it is true.
@@ -147,6 +149,94 @@ std::vector<T*> ChooseNElements(const std::vector<T*>& list, std::size_t amount)
     return results;
 }
 
+//! Derives the seed of the \p idx-th stream from \p seed. The index is
+//! mixed into the seed (splitmix64) so that consecutive streams don't start
+//! from similar engine states.
+//! \param seed The base seed.
+//! \param idx The index of stream.
+//! \return The seed of the stream.
+inline unsigned int MixSeed(unsigned int seed, std::size_t idx)
+{
+    auto z = static_cast<std::uint64_t>(seed) +
+             (static_cast<std::uint64_t>(idx) + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+
+    return static_cast<unsigned int>(z);
+}
+
+//!
+//! \brief RandomStateGuard class.
+//!
+//! This class saves the state of the engine (Random) of the calling thread
+//! and restores it when it goes out of scope, so that code that reseeds the
+//! engine doesn't change the random sequence of its caller.
+//!
+class RandomStateGuard
+{
+ public:
+    //! Constructs random state guard that saves the state of the engine.
+    RandomStateGuard() : m_engine(Random::get_engine())
+    {
+        // Do nothing
+    }
+
+    //! Destructor: Restores the state of the engine.
+    ~RandomStateGuard()
+    {
+        Random::get_engine() = m_engine;
+    }
+
+    //! Deleted copy constructor.
+    RandomStateGuard(const RandomStateGuard&) = delete;
+
+    //! Deleted move constructor.
+    RandomStateGuard(RandomStateGuard&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    RandomStateGuard& operator=(const RandomStateGuard&) = delete;
+
+    //! Deleted move assignment operator.
+    RandomStateGuard& operator=(RandomStateGuard&&) noexcept = delete;
+
+ private:
+    Random::engine_type m_engine;
+};
+
+//! The initial value of hashes of HashCombine() (the offset basis of FNV-1a).
+constexpr std::uint64_t HASH_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+
+//! Mixes the bytes of \p value into \p hash (FNV-1a). The hash doesn't
+//! depend on the platform, so it can be stored in files.
+//! \param hash The hash to mix into.
+//! \param value The value to mix.
+//! \return The mixed hash.
+inline std::uint64_t HashCombine(std::uint64_t hash, std::uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        hash = (hash ^ ((value >> (i * 8)) & 0xFF)) * 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+//! Mixes the length and the characters of \p str into \p hash (FNV-1a).
+//! \param hash The hash to mix into.
+//! \param str The string to mix.
+//! \return The mixed hash.
+inline std::uint64_t HashCombine(std::uint64_t hash, std::string_view str)
+{
+    hash = HashCombine(hash, static_cast<std::uint64_t>(str.size()));
+    for (const char c : str)
+    {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
 //! Splits a string \p str using \p delim.
 //! \param str An original string.
 //! \param delim A string delimiter to split.
@@ -0,0 +1,94 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_ACTION_HPP
+#define ROSETTASTONE_PLAYMODE_ACTION_HPP
+
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/Common/Enums/CardEnums.hpp>
+#include <Rosetta/Common/Enums/GameEnums.hpp>
+
+#include <functional>
+#include <tuple>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+class Character;
+class Game;
+class Player;
+
+//! The number of characters that an action can refer to.
+constexpr int NUM_CHARACTERS = 2 * (MAX_FIELD_SIZE + 1);
+
+//!
+//! \brief Action struct.
+//!
+//! This struct represents an action of the current player. Characters are
+//! referred to by the index from the view of the current player: 0 is the
+//! hero, 1 to 7 are the minions on the field, 8 is the opponent hero and
+//! 9 to 15 are the opponent minions on the field.
+//! - PLAY_CARD: index is the position of a card in hand, target is the
+//!   index of a target character or -1, position is the field position of a
+//!   minion or -1 (the rightmost) and chooseOne is the option of a choose one
+//!   card or 0.
+//! - ATTACK: index is the index of an attacker and target is the index of a
+//!   defender.
+//! - HERO_POWER: target is the index of a target character or -1.
+//! - TRADE_CARD: index is the position of a card in hand.
+//! - CHOOSE: index is the position of a card in the current choice.
+//!
+struct Action
+{
+    ActionType type = ActionType::END_TURN;
+    int index = -1;
+    int target = -1;
+    int position = -1;
+    int chooseOne = 0;
+};
+
+//! Operator overloading: operator==.
+bool operator==(const Action& lhs, const Action& rhs);
+
+//! Operator overloading: operator!=.
+bool operator!=(const Action& lhs, const Action& rhs);
+
+//! Returns the character at \p charIdx from the view of \p player.
+//! \param player The player who refers to the character.
+//! \param charIdx The index of character.
+//! \return The character at \p charIdx or nullptr if there is no character.
+Character* GetCharacter(Player* player, int charIdx);
+
+//! Returns the index of \p character from the view of \p player.
+//! \param player The player who refers to the character.
+//! \param character The character.
+//! \return The index of \p character.
+int GetCharacterIndex(const Player* player, const Character* character);
+
+//! Calls \p func for each action that the current player can do in the order
+//! of GetLegalActions(). No list of actions or targets is built.
+//! \param game The game in main action step.
+//! \param func The function to call with each legal action.
+void ForEachLegalAction(Game& game,
+                        const std::function<void(const Action&)>& func);
+
+//! Returns a list of actions that the current player can do.
+//! If the current player has a choice, only CHOOSE actions are returned.
+//! Otherwise the last action is always END_TURN.
+//! \param game The game in main action step.
+//! \return A list of legal actions.
+std::vector<Action> GetLegalActions(Game& game);
+
+//! Applies the action of the current player. The game must be created with
+//! autoRun so that END_TURN runs until the next main action step.
+//! \param game The game in main action step.
+//! \param action The action to apply.
+//! \return The play states of the first and the second player.
+std::tuple<PlayState, PlayState> ApplyAction(Game& game,
+                                             const Action& action);
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_ACTION_HPP
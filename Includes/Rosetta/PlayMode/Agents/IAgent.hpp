@@ -7,6 +7,7 @@
 #define ROSETTASTONE_PLAYMODE_IAGENT_HPP
 
 #include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Views/ObservationView.hpp>
 
 namespace RosettaStone::PlayMode
 {
@@ -26,9 +27,10 @@ class IAgent
     virtual void SetPlayerType(PlayerType playerType) = 0;
 
     //! Gets an action of agent for mulligan cards.
-    //! \param state The current game state.
+    //! \param view The view of the player of the agent.
     //! \return An action of agent for mulligan cards.
-    virtual std::vector<int> GetActionForMulligan(Game& state) const = 0;
+    virtual std::vector<int> GetActionForMulligan(
+        const ObservationView& view) const = 0;
 };
 }  // namespace RosettaStone::PlayMode
 
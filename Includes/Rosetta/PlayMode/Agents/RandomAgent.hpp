@@ -26,9 +26,10 @@ class RandomAgent final : public IAgent
     void SetPlayerType(PlayerType playerType) override;
 
     //! Gets an action of agent for mulligan cards.
-    //! \param state The current game state.
+    //! \param view The view of the player of the agent.
     //! \return An action of agent for mulligan cards.
-    std::vector<int> GetActionForMulligan(Game& state) const override;
+    std::vector<int> GetActionForMulligan(
+        const ObservationView& view) const override;
 
  private:
     PlayerType m_playerType = PlayerType::INVALID;
@@ -166,6 +166,19 @@ class Card
     //! \return A list of valid play targets.
     std::vector<Character*> GetValidPlayTargets(Player* player);
 
+    //! Checks whether \p target is in the valid play targets without building
+    //! the list of them.
+    //! \param player The player of the source.
+    //! \param target The proposed target that is a hero or a minion on the
+    //! field.
+    //! \return true if \p target is in GetValidPlayTargets(), false otherwise.
+    bool IsInValidPlayTargets(Player* player, Character* target);
+
+    //! Checks the targeting availability predicates of this card.
+    //! \param player The player of the source.
+    //! \return true if all predicates are satisfied, false otherwise.
+    bool IsTargetingAvailable(Player* player);
+
     std::string id;
     int dbfID;
     std::string name;
@@ -0,0 +1,241 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_CARD_DATABASE_HPP
+#define ROSETTASTONE_PLAYMODE_CARD_DATABASE_HPP
+
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/PlayMode/Cards/Card.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+class CardImage;
+
+//!
+//! \brief CardDatabase class.
+//!
+//! This class stores a list of cards loaded from a version of cards.json and
+//! provides several search methods. Several databases (e.g. cards of several
+//! patches) can be loaded side by side, and a game chooses one of them through
+//! GameConfig. A database can be loaded on top of a base database, and then
+//! the cards whose records are unchanged are shared with the base database.
+//!
+//! NOTE: Powers are code, so all databases share the powers of CardDefs.
+//! Tasks that find a card when the powers are created (e.g. SummonTask with
+//! a card ID) look it up again in the database of the game when they run
+//! (see Game::FindCard). Enchants parsed from card text when the powers are
+//! created keep the text of the default database (Cards).
+//!
+class CardDatabase
+{
+ public:
+    //! Default constructor.
+    CardDatabase() = default;
+
+    //! Deleted copy constructor.
+    CardDatabase(const CardDatabase&) = delete;
+
+    //! Deleted move constructor.
+    CardDatabase(CardDatabase&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    CardDatabase& operator=(const CardDatabase&) = delete;
+
+    //! Deleted move assignment operator.
+    CardDatabase& operator=(CardDatabase&&) noexcept = delete;
+
+    //! Loads card data from the cards.json file at \p path.
+    //! \param path The path of cards.json.
+    //! \param base The database to share unchanged cards with, or nullptr.
+    //! \param pool The thread pool to load cards in parallel, or nullptr.
+    void Load(const std::string& path, const CardDatabase* base = nullptr,
+              ThreadPool* pool = nullptr);
+
+    //! Loads card data from \p image.
+    //! \param image The card image to load card data from.
+    //! \param base The database to share unchanged cards with, or nullptr.
+    //! \param pool The thread pool to load cards in parallel, or nullptr.
+    void Load(const CardImage& image, const CardDatabase* base = nullptr,
+              ThreadPool* pool = nullptr);
+
+    //! Returns the number of cards shared with the base database.
+    //! \return The number of cards shared with the base database.
+    std::size_t GetNumSharedCards() const;
+
+    //! Returns the version of the database. It is a hash of the IDs, the
+    //! dbfIDs and the game tags of all cards, so it changes whenever a card
+    //! is changed. Game records store it to detect replays with other cards.
+    //! \return The version of the database.
+    std::uint64_t GetVersion() const;
+
+    //! Returns a list of all cards.
+    //! \return A list of all cards.
+    const std::vector<Card*>& GetAllCards() const;
+
+    //! Returns a list of standard cards that matches specific card class.
+    //! \param cardClass The card class to match.
+    //! \return A list of standard cards that matches specific card class.
+    const std::vector<Card*>& GetStandardCards(CardClass cardClass) const;
+
+    //! Returns a list of wild cards that matches specific card class.
+    //! \param cardClass The card class to match.
+    //! \return A list of wild cards that matches specific card class.
+    const std::vector<Card*>& GetWildCards(CardClass cardClass) const;
+
+    //! Returns a list of all standard cards.
+    //! \return A list of all standard cards.
+    const std::vector<Card*>& GetAllStandardCards() const;
+
+    //! Returns a list of all wild cards.
+    //! \return A list of all wild cards.
+    const std::vector<Card*>& GetAllWildCards() const;
+
+    //! Returns a list of discover cards.
+    //! \param baseClass The base class of the player.
+    //! \param format The format type of the game.
+    //! \return A list of discover cards.
+    const std::vector<Card*> GetDiscoverCards(CardClass baseClass,
+                                              FormatType format) const;
+
+    //! Returns a list of basic Totem cards.
+    //! \return A list of basic Totem cards.
+    std::vector<Card*> GetBasicTotems() const;
+
+    //! Returns a list of Lackey cards.
+    //! \return A list of Lackey cards.
+    std::vector<Card*> GetLackeys() const;
+
+    //! Returns a list of Poison cards.
+    //! \return A list of Poison cards.
+    std::vector<Card*> GetPoisons() const;
+
+    //! Returns a card that matches \p id.
+    //! \param id The ID of the card.
+    //! \return A card that matches \p id.
+    Card* FindCardByID(const std::string_view& id) const;
+
+    //! Returns a card that matches \p dbfID.
+    //! \param dbfID The dbfID of the card.
+    //! \return A card that matches \p dbfID.
+    Card* FindCardByDbfID(int dbfID) const;
+
+    //! Returns a list of cards that matches \p rarity.
+    //! \param rarity The rarity of the card.
+    //! \return A list of cards that matches condition.
+    std::vector<Card*> FindCardByRarity(Rarity rarity) const;
+
+    //! Returns a list of cards that matches \p cardClass.
+    //! \param cardClass The class of the card.
+    //! \return A list of cards that matches condition.
+    std::vector<Card*> FindCardByClass(CardClass cardClass) const;
+
+    //! Returns a list of cards that matches \p cardSet.
+    //! \param cardSet The set of the card.
+    //! \return A list of cards that matches condition.
+    std::vector<Card*> FindCardBySet(CardSet cardSet) const;
+
+    //! Returns a list of cards that matches \p cardType.
+    //! \param cardType The type of the card.
+    //! \return A list of cards that matches condition.
+    std::vector<Card*> FindCardByType(CardType cardType) const;
+
+    //! Returns a list of cards that matches \p race.
+    //! \param race The race of the card.
+    //! \return A list of cards that matches condition.
+    std::vector<Card*> FindCardByRace(Race race) const;
+
+    //! Returns a card that matches \p name and \p format.
+    //! \param name The name of the card.
+    //! \param format The format type of the game.
+    //! \return A card that matches condition.
+    Card* FindCardByName(const std::string_view& name,
+                         FormatType format = FormatType::WILD) const;
+
+    //! Returns a list of cards whose cost is between \p minVal and \p maxVal.
+    //! \param minVal The minimum cost value of the card.
+    //! \param maxVal The maximum cost value of the card.
+    //! \return A list of cards that matches condition.
+    std::vector<Card*> FindCardByCost(int minVal, int maxVal) const;
+
+    //! Returns a list of cards whose attack is between \p minVal and \p maxVal.
+    //! \param minVal The minimum attack value of the card.
+    //! \param maxVal The maximum attack value of the card.
+    //! \return A list of cards that matches condition.
+    std::vector<Card*> FindCardByAttack(int minVal, int maxVal) const;
+
+    //! Returns a list of cards whose health is between \p minVal and \p maxVal.
+    //! \param minVal The minimum health value of the card.
+    //! \param maxVal The maximum health value of the card.
+    //! \return A list of cards that matches condition.
+    std::vector<Card*> FindCardByHealth(int minVal, int maxVal) const;
+
+    //! Returns a list of cards whose spell power is between
+    //! \p minVal and \p maxVal.
+    //! \param minVal The minimum spell power value of the card.
+    //! \param maxVal The maximum spell power value of the card.
+    //! \return A list of cards that matches condition.
+    std::vector<Card*> FindCardBySpellPower(int minVal, int maxVal) const;
+
+    //! Returns a list of cards that has \p gameTags.
+    //! \param gameTags A list of game tag of the card.
+    //! \return A list of cards that matches condition.
+    std::vector<Card*> FindCardByGameTag(std::vector<GameTag> gameTags) const;
+
+    //! Returns a hero card that matches \p cardClass.
+    //! \param cardClass The class of the card.
+    //! \return A hero card that matches condition.
+    Card* GetHeroCard(CardClass cardClass) const;
+
+    //! Returns a default hero power card that matches \p cardClass.
+    //! \param cardClass The class of the card.
+    //! \return A default hero power card that matches condition.
+    Card* GetDefaultHeroPower(CardClass cardClass) const;
+
+ private:
+    //! Completes loading \p cards that are created by a loader.
+    //! \param cards A list of cards created by a loader.
+    //! \param base The database to share unchanged cards with, or nullptr.
+    //! \param pool The thread pool to load cards in parallel, or nullptr.
+    void Build(std::vector<Card*>& cards, const CardDatabase* base,
+               ThreadPool* pool);
+
+    //! Builds the indices to find a card by ID and dbfID.
+    void BuildIndices();
+
+    //! Builds the lists of cards by class and format.
+    void BuildCardLists();
+
+    //! Computes the version of the database from its cards.
+    void BuildVersion();
+
+    std::vector<std::shared_ptr<Card>> m_records;
+    std::vector<Card*> m_cards;
+    std::unordered_map<std::string_view, std::size_t> m_cardsByID;
+    std::unordered_map<int, std::size_t> m_cardsByDbfID;
+    std::size_t m_numSharedCards = 0;
+    std::uint64_t m_version = 0;
+
+    std::array<std::vector<Card*>, NUM_PLAYER_CLASS> m_standardCards;
+    std::array<std::vector<Card*>, NUM_PLAYER_CLASS> m_wildCards;
+    std::vector<Card*> m_allStandardCards;
+    std::vector<Card*> m_allWildCards;
+    std::vector<Card*> m_allClassicCards;
+    std::vector<Card*> m_basicTotems;
+    std::vector<Card*> m_lackeys;
+    std::vector<Card*> m_poisons;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_CARD_DATABASE_HPP
@@ -9,11 +9,14 @@
 
 #include <Rosetta/Common/Constants.hpp>
 #include <Rosetta/PlayMode/Cards/Card.hpp>
+#include <Rosetta/PlayMode/Cards/CardDatabase.hpp>
 
 #include <vector>
 
 namespace RosettaStone::PlayMode
 {
+class CardImage;
+
 //!
 //! \brief Search filter structure.
 //!
@@ -37,6 +40,8 @@ struct SearchFilter
 //! \brief Cards class.
 //!
 //! This class stores a list of cards and provides several search methods.
+//! It is the default card database that is loaded from cards.json in
+//! Resources, and games use it unless GameConfig chooses another database.
 //!
 class Cards
 {
@@ -57,6 +62,24 @@ class Cards
     //! \return An instance of Cards class.
     static Cards& GetInstance();
 
+    //! Sets the card image to load card data from instead of cards.json.
+    //! It must be called before the first call of GetInstance(), and
+    //! \p image must stay mapped until GetInstance() returns.
+    //! \param image The card image to load card data from.
+    static void SetCardImage(const CardImage* image);
+
+    //! Sets the number of threads to convert and initialize cards.
+    //! It must be called before the first call of GetInstance(). The loaded
+    //! cards are the same regardless of the number of threads.
+    //! \param numThreads The number of threads. If it is 0, the number of
+    //! hardware threads is used. If it is 1, cards are loaded on the calling
+    //! thread.
+    static void SetNumLoaderThreads(std::size_t numThreads);
+
+    //! Returns the default card database.
+    //! \return The default card database.
+    static const CardDatabase& GetDatabase();
+
     //! Returns a list of all cards.
     //! \return A list of all cards.
     static const std::vector<Card*>& GetAllCards();
@@ -184,18 +207,13 @@ class Cards
     //! Constructor: Loads card data.
     Cards();
 
-    //! Destructor: Releases card data.
-    ~Cards();
-
-    static std::vector<Card*> m_cards;
-    static std::array<std::vector<Card*>, NUM_PLAYER_CLASS> m_standardCards;
-    static std::array<std::vector<Card*>, NUM_PLAYER_CLASS> m_wildCards;
-    static std::vector<Card*> m_allStandardCards;
-    static std::vector<Card*> m_allWildCards;
-    static std::vector<Card*> m_allClassicCards;
-    static std::vector<Card*> m_basicTotems;
-    static std::vector<Card*> m_lackeys;
-    static std::vector<Card*> m_poisons;
+    //! Default destructor.
+    ~Cards() = default;
+
+    static const CardImage* m_cardImage;
+    static std::size_t m_numLoaderThreads;
+
+    static CardDatabase m_database;
 };
 }  // namespace RosettaStone::PlayMode
 
@@ -10,6 +10,7 @@
 #include <Rosetta/Common/Constants.hpp>
 #include <Rosetta/Common/Enums/CardEnums.hpp>
 #include <Rosetta/PlayMode/Cards/Card.hpp>
+#include <Rosetta/PlayMode/Cards/CardDatabase.hpp>
 
 #include <string>
 
@@ -62,6 +63,12 @@ class Deck
     //! \return A deck from a list of pointers to cards.
     std::array<Card*, START_DECK_SIZE> GetCards() const;
 
+    //! Creates a deck from a list of pointers to cards of \p cardDatabase.
+    //! \param cardDatabase The card database to look up cards.
+    //! \return A deck from a list of pointers to cards.
+    std::array<Card*, START_DECK_SIZE> GetCards(
+        const CardDatabase& cardDatabase) const;
+
     //! Add card(s) to deck with given \p cardID and \p numCardToAdd.
     //! \param cardID The ID of the card to add to deck.
     //! \param numCardToAdd The number of card to add to deck.
@@ -69,6 +76,15 @@ class Deck
     //! otherwise.
     bool AddCard(std::string cardID, std::size_t numCardToAdd);
 
+    //! Add card(s) to deck with given \p cardID and \p numCardToAdd.
+    //! \param cardID The ID of the card to add to deck.
+    //! \param numCardToAdd The number of card to add to deck.
+    //! \param cardDatabase The card database to look up the card.
+    //! \return true if card(s) is added to deck successfully, and false
+    //! otherwise.
+    bool AddCard(std::string cardID, std::size_t numCardToAdd,
+                 const CardDatabase& cardDatabase);
+
     //! Delete card(s) from deck with given \p cardID and \p numCardToDelete.
     //! \param cardID The ID of the card to delete from deck.
     //! \param numCardToDelete The number of card to delete from deck.
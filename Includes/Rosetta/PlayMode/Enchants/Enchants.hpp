@@ -6,6 +6,7 @@
 #ifndef ROSETTASTONE_PLAYMODE_ENCHANTS_HPP
 #define ROSETTASTONE_PLAYMODE_ENCHANTS_HPP
 
+#include <Rosetta/PlayMode/Cards/CardDatabase.hpp>
 #include <Rosetta/PlayMode/Enchants/Effects.hpp>
 #include <Rosetta/PlayMode/Enchants/Enchant.hpp>
 
@@ -50,6 +51,13 @@ class Enchants
     //! \return A newly created enchant from card's text.
     static std::shared_ptr<Enchant> GetEnchantFromText(
         const std::string& cardID);
+
+    //! Creates enchant from the text of a card in \p cardDatabase.
+    //! \param cardID A card's ID.
+    //! \param cardDatabase The card database to look up the card.
+    //! \return A newly created enchant from card's text.
+    static std::shared_ptr<Enchant> GetEnchantFromText(
+        const std::string& cardID, const CardDatabase& cardDatabase);
 };
 }  // namespace RosettaStone::PlayMode
 
@@ -0,0 +1,133 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_BATCH_EVALUATOR_HPP
+#define ROSETTASTONE_PLAYMODE_BATCH_EVALUATOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief BatchEvaluator class.
+//!
+//! This class evaluates encoded states (e.g. observations of
+//! ObservationEncoder) in batches. Searches on any thread submit states to a
+//! shared queue and get a future that is ready when the output of the state
+//! is written. A background thread forms a batch when maxBatchSize states are
+//! pending or the oldest pending state has waited maxDelay, and calls the
+//! batch function with the inputs of the batch in one contiguous buffer. A
+//! search can submit several states (e.g. with virtual loss) before it waits,
+//! so a few threads can fill large batches.
+//!
+//! An exception thrown by the batch function is stored in the futures of the
+//! batch.
+//!
+class BatchEvaluator
+{
+ public:
+    //! The function that evaluates a batch. It is called with the number of
+    //! states, the inputs of (batchSize, inputSize) and the outputs of
+    //! (batchSize, outputSize) to write.
+    using BatchFunc = std::function<void(std::size_t batchSize,
+                                         const float* inputs, float* outputs)>;
+
+    //! Constructs batch evaluator and starts its background thread.
+    //! \param inputSize The number of elements of an input.
+    //! \param outputSize The number of elements of an output.
+    //! \param maxBatchSize The maximum number of states in a batch.
+    //! \param maxDelay The maximum time a state waits for a batch to fill.
+    //! \param batchFunc The function that evaluates a batch.
+    BatchEvaluator(std::size_t inputSize, std::size_t outputSize,
+                   std::size_t maxBatchSize, std::chrono::microseconds maxDelay,
+                   BatchFunc batchFunc);
+
+    //! Destructor: Evaluates the pending states and stops the background
+    //! thread.
+    ~BatchEvaluator();
+
+    //! Deleted copy constructor.
+    BatchEvaluator(const BatchEvaluator&) = delete;
+
+    //! Deleted move constructor.
+    BatchEvaluator(BatchEvaluator&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    BatchEvaluator& operator=(const BatchEvaluator&) = delete;
+
+    //! Deleted move assignment operator.
+    BatchEvaluator& operator=(BatchEvaluator&&) noexcept = delete;
+
+    //! Submits a state. It can be called from several threads. The input is
+    //! copied, so it can be reused after the call. The output must be valid
+    //! until the future is ready.
+    //! \param input The input of inputSize elements.
+    //! \param output The output of outputSize elements to write.
+    //! \return The future that is ready when \p output is written.
+    std::future<void> Submit(const float* input, float* output);
+
+    //! Submits a state and waits until its output is written.
+    //! \param input The input of inputSize elements.
+    //! \param output The output of outputSize elements to write.
+    void Evaluate(const float* input, float* output);
+
+    //! Returns the number of elements of an input.
+    //! \return The number of elements of an input.
+    std::size_t GetInputSize() const;
+
+    //! Returns the number of elements of an output.
+    //! \return The number of elements of an output.
+    std::size_t GetOutputSize() const;
+
+    //! Returns the number of evaluated batches.
+    //! \return The number of evaluated batches.
+    std::size_t GetNumBatches() const;
+
+    //! Returns the number of evaluated states.
+    //! \return The number of evaluated states.
+    std::size_t GetNumEvaluations() const;
+
+ private:
+    //! Evaluates batches until the evaluator is stopped.
+    void Run();
+
+    //! Evaluates the taken states in batches of the maximum batch size.
+    void EvaluateTaken();
+
+    std::size_t m_inputSize = 0;
+    std::size_t m_outputSize = 0;
+    std::size_t m_maxBatchSize = 0;
+    std::chrono::microseconds m_maxDelay;
+    BatchFunc m_batchFunc;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::vector<float> m_pendingInputs;
+    std::vector<float*> m_pendingOutputs;
+    std::vector<std::promise<void>> m_pendingPromises;
+    std::chrono::steady_clock::time_point m_oldestTime;
+    bool m_stop = false;
+    std::thread m_thread;
+
+    std::vector<float> m_takenInputs;
+    std::vector<float*> m_takenOutputs;
+    std::vector<std::promise<void>> m_takenPromises;
+    std::vector<float> m_batchOutputs;
+
+    std::atomic<std::size_t> m_numBatches{ 0 };
+    std::atomic<std::size_t> m_numEvaluations{ 0 };
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_BATCH_EVALUATOR_HPP
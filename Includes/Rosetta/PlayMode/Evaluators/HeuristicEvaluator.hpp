@@ -0,0 +1,115 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_HEURISTIC_EVALUATOR_HPP
+#define ROSETTASTONE_PLAYMODE_HEURISTIC_EVALUATOR_HPP
+
+#include <Rosetta/PlayMode/Managers/ObservationEncoder.hpp>
+
+#include <array>
+#include <string>
+
+namespace RosettaStone::PlayMode
+{
+class Player;
+
+//!
+//! \brief HeuristicWeights struct.
+//!
+//! This struct holds the weights of HeuristicEvaluator. The weights of the
+//! hero, the weapon, the minions, the hand and the secrets are applied to
+//! both players with opposite signs. The weights can be loaded from a JSON
+//! object whose keys are the names of the weights in snake case (e.g.
+//! "hero_health"). A missing key keeps the default weight.
+//!
+struct HeuristicWeights
+{
+    float heroHealth = 1.0f;
+    float heroArmor = 1.0f;
+    float weaponAttack = 1.0f;
+    float weaponDurability = 0.5f;
+
+    float minion = 1.0f;
+    float minionAttack = 1.0f;
+    float minionHealth = 1.0f;
+    float spellPower = 0.5f;
+    float taunt = 1.0f;
+    float divineShield = 1.5f;
+    float windfury = 0.5f;
+    float stealth = 0.5f;
+    float poisonous = 1.5f;
+    float lifesteal = 0.5f;
+    float frozen = -1.0f;
+    float deathrattle = 0.5f;
+    float reborn = 1.0f;
+
+    float handSize = 1.0f;
+    float secret = 1.5f;
+
+    //! The weight of the mana the player spent this turn.
+    float spentMana = 0.5f;
+
+    //! The value if the current player can kill the other hero this turn.
+    float lethal = 100.0f;
+
+    //! The value if the other player can kill the hero of the current player
+    //! next turn unless the board changes.
+    float lethalThreat = 50.0f;
+
+    //! The value if the hero of the opponent is dead.
+    float win = 10000.0f;
+
+    //! Loads weights from the JSON file at \p path.
+    //! \param path The path of the file to read.
+    //! \return The loaded weights.
+    static HeuristicWeights Load(const std::string& path);
+};
+
+//!
+//! \brief HeuristicEvaluator class.
+//!
+//! This class evaluates the state of a game from the view of a player for
+//! the leaves of a search. It reads an observation (see ObservationEncoder)
+//! instead of the entities, so a state is encoded once and evaluated without
+//! map lookups. Most of the value is the dot product of the block weights
+//! and the difference of the blocks of the players, which the compiler can
+//! vectorize. The value is positive if the state is good for the player.
+//!
+class HeuristicEvaluator
+{
+ public:
+    //! Constructs heuristic evaluator with given \p weights.
+    //! \param weights The weights of the features.
+    explicit HeuristicEvaluator(const HeuristicWeights& weights = {});
+
+    //! Returns the weights of the features.
+    //! \return The weights of the features.
+    const HeuristicWeights& GetWeights() const;
+
+    //! Evaluates an observation.
+    //! \param observation The observation of NUM_FEATURES elements.
+    //! \return The value of the state for the player who observes it.
+    float Evaluate(const float* observation) const;
+
+    //! Encodes the view of \p player and evaluates it.
+    //! \param player The player who observes the game.
+    //! \return The value of the state for \p player.
+    float Evaluate(const Player& player) const;
+
+    //! Evaluates observations.
+    //! \param batchSize The number of observations.
+    //! \param observations The observations of (batchSize, NUM_FEATURES).
+    //! \param values The buffer of batchSize values.
+    void EvaluateBatch(std::size_t batchSize, const float* observations,
+                       float* values) const;
+
+ private:
+    HeuristicWeights m_weights;
+    std::array<float, ObservationEncoder::NUM_BLOCK_FEATURES> m_blockWeights{};
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_HEURISTIC_EVALUATOR_HPP
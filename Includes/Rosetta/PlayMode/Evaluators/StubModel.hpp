@@ -0,0 +1,51 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_STUB_MODEL_HPP
+#define ROSETTASTONE_PLAYMODE_STUB_MODEL_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief StubModel class.
+//!
+//! This class stands in for a neural network on the CPU. It evaluates a
+//! batch with one dense layer of fixed weights and waits a fixed latency per
+//! call, like the launch overhead of an accelerator. It can be used as the
+//! batch function of BatchEvaluator to test and measure searches without a
+//! model.
+//!
+class StubModel
+{
+ public:
+    //! Constructs stub model with given sizes and \p latency.
+    //! \param inputSize The number of elements of an input.
+    //! \param outputSize The number of elements of an output.
+    //! \param latency The time to wait per call.
+    StubModel(std::size_t inputSize, std::size_t outputSize,
+              std::chrono::microseconds latency =
+                  std::chrono::microseconds(0));
+
+    //! Evaluates a batch.
+    //! \param batchSize The number of inputs.
+    //! \param inputs The inputs of (batchSize, inputSize).
+    //! \param outputs The outputs of (batchSize, outputSize) to write.
+    void operator()(std::size_t batchSize, const float* inputs,
+                    float* outputs) const;
+
+ private:
+    std::size_t m_inputSize = 0;
+    std::size_t m_outputSize = 0;
+    std::chrono::microseconds m_latency;
+    std::vector<float> m_weights;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_STUB_MODEL_HPP
@@ -0,0 +1,99 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_DETERMINIZER_HPP
+#define ROSETTASTONE_PLAYMODE_DETERMINIZER_HPP
+
+#include <Rosetta/Common/Enums/CardEnums.hpp>
+#include <Rosetta/Common/Enums/GameEnums.hpp>
+#include <Rosetta/PlayMode/Games/GameRecord.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+class Card;
+class Game;
+class Player;
+
+//!
+//! \brief Determinizer class.
+//!
+//! This class samples determinizations of a game for a player: games that
+//! are consistent with everything the player knows (see ObservationView),
+//! with the hidden information resampled. The cards in the hand of the
+//! opponent that are not revealed, the deck of the opponent and the secrets
+//! of the opponent that are not revealed are replaced by cards drawn from
+//! the deck list the opponent is believed to play, without the cards the
+//! opponent has played from it. When the deck list runs out, cards are
+//! drawn from the card pool. Both decks are shuffled, because the player
+//! doesn't know the order of either deck.
+//!
+//! A game can't be copied, so a determinization is the replay of the record
+//! of the game (see GameRecorder) with the hidden information resampled.
+//! Each call of Sample() replays the whole record, so its cost grows with
+//! the number of actions in the record; the "determinize-sample" benchmark
+//! of RosettaTool measures it against the replay alone.
+//!
+//! The thread-local engine (Random) is used to sample, so a determinizer can
+//! be used on several threads at once. Sample() restores the state of the
+//! engine of the calling thread, while Determinize() draws from it.
+//!
+class Determinizer
+{
+ public:
+    //! Constructs a determinizer for the player of \p playerType.
+    //! \param playerType The player who searches the game.
+    //! \param deckPrior The deck list the opponent is believed to play.
+    //! \param cardPool The cards the opponent may have if the deck list runs
+    //! out. Usually CardDatabase::GetDiscoverCards() of the opponent.
+    Determinizer(PlayerType playerType, std::vector<Card*> deckPrior,
+                 std::vector<Card*> cardPool);
+
+    //! Replays \p record and resamples the hidden information. The state of
+    //! the engine of the calling thread is restored before it returns.
+    //! \param record The record of the game to determinize.
+    //! \param seed The seed of the determinization.
+    //! \return The determinized game.
+    std::unique_ptr<Game> Sample(const GameRecord& record,
+                                 unsigned int seed) const;
+
+    //! Resamples the hidden information of \p game in place with the engine
+    //! of the calling thread.
+    //! \param game The game to determinize.
+    void Determinize(Game& game) const;
+
+ private:
+    //! Returns the cards of the deck list the opponent hasn't played.
+    //! \param opponent The opponent of the player.
+    //! \return The cards of the deck list the opponent hasn't played.
+    std::vector<Card*> GetUnplayedCards(const Player& opponent) const;
+
+    //! Draws a card from \p cards, or from the card pool if \p cards is
+    //! empty.
+    //! \param cards The cards to draw from.
+    //! \return The drawn card.
+    Card* DrawCard(std::vector<Card*>& cards) const;
+
+    //! Draws a secret of \p cardClass that isn't in \p excluded from
+    //! \p cards, or from the card pool if there is no such secret in
+    //! \p cards.
+    //! \param cards The cards to draw from.
+    //! \param cardClass The class of the secret.
+    //! \param excluded The secrets that can't be drawn.
+    //! \return The drawn secret, or nullptr if there is no such secret.
+    Card* DrawSecret(std::vector<Card*>& cards, CardClass cardClass,
+                     const std::vector<Card*>& excluded) const;
+
+    PlayerType m_playerType = PlayerType::INVALID;
+    std::vector<Card*> m_deckPrior;
+    std::vector<Card*> m_cardPool;
+    std::vector<Card*> m_secretPool;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_DETERMINIZER_HPP
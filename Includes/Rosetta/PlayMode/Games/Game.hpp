@@ -15,11 +15,14 @@
 #include <Rosetta/PlayMode/Tasks/TaskQueue.hpp>
 #include <Rosetta/PlayMode/Tasks/TaskStack.hpp>
 
+#include <cstdint>
 #include <map>
+#include <memory>
 
 namespace RosettaStone::PlayMode
 {
 class Minion;
+struct GameRecord;
 
 //!
 //! \brief Game class.
@@ -63,6 +66,17 @@ class Game
     //! \return The format type of the game.
     FormatType GetFormatType() const;
 
+    //! Returns the card database of the game.
+    //! \return The card database of the game.
+    const CardDatabase& GetCardDatabase() const;
+
+    //! Returns the card of the card database of the game that has the same
+    //! ID as \p card. Powers find cards of the default database when they
+    //! are created, so tasks and auras map them with this at run time.
+    //! \param card The card to map.
+    //! \return The card of the card database of the game.
+    Card* FindCard(Card* card) const;
+
     //! Returns the first player.
     //! \return The first player.
     Player* GetPlayer1();
@@ -182,6 +196,21 @@ class Game
     //! \param step The game step to process until arrival.
     void ProcessUntil(Step step);
 
+    //! Returns the hash of the game state: the state, the turn, the players
+    //! and the zones and the game tags of all entities. Two games that run
+    //! the same actions with the same seed have the same hash.
+    //! \return The hash of the game state.
+    std::uint64_t GetStateHash() const;
+
+    //! Re-executes \p record from the start (see GameRecorder) and verifies
+    //! the state hash of the final state. Throws std::runtime_error if the
+    //! version of the card database differs, an action is illegal or the
+    //! state hash differs. The state of the engine (Random) of the calling
+    //! thread is restored before it returns.
+    //! \param record The record of the game to replay.
+    //! \return The replayed game at the final state.
+    static std::unique_ptr<Game> Replay(const GameRecord& record);
+
     State state = State::INVALID;
 
     Step step = Step::INVALID;
@@ -8,6 +8,7 @@
 
 #include <Rosetta/Common/Constants.hpp>
 #include <Rosetta/PlayMode/Cards/Card.hpp>
+#include <Rosetta/PlayMode/Cards/CardDatabase.hpp>
 #include <Rosetta/PlayMode/Models/Player.hpp>
 
 #include <array>
@@ -39,6 +40,10 @@ struct GameConfig
     std::array<Card*, START_DECK_SIZE> player1Deck;
     std::array<Card*, START_DECK_SIZE> player2Deck;
 
+    //! The card database of the game. If it is nullptr, the default card
+    //! database (Cards) is used. It must outlive the game.
+    const CardDatabase* cardDatabase = nullptr;
+
     std::array<std::string, 9> fillCardIDs = {
         "UNG_028", "UNG_067", "UNG_116", "UNG_829", "UNG_934",
         "UNG_920", "UNG_940", "UNG_942", "UNG_954"
@@ -0,0 +1,85 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_GAME_RECORD_HPP
+#define ROSETTASTONE_PLAYMODE_GAME_RECORD_HPP
+
+#include <Rosetta/PlayMode/Agents/Action.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+class CardDatabase;
+
+//!
+//! \brief GameRecord struct.
+//!
+//! This struct stores everything to reproduce a game exactly: the version of
+//! the card database, the configuration, the seed and the ordered actions of
+//! the players including choices. The state hash of the final state is
+//! stored to verify a replay (see Game::Replay()). A record is created by
+//! GameRecorder.
+//!
+struct GameRecord
+{
+    std::uint64_t cardDatabaseVersion = 0;
+    GameConfig gameConfig;
+    unsigned int seed = 0;
+    std::vector<Action> actions;
+    std::uint64_t stateHash = 0;
+};
+
+//!
+//! \brief The binary format of game records.
+//!
+//! A record file is a FileHeader followed by records. Each record is the
+//! size of its payload (uint32) followed by the payload. Integers of a
+//! payload are LEB128 variable-length integers (zigzag-encoded if signed)
+//! except the version of the card database and the state hash, which are
+//! 8 bytes. Decks are stored as dbfIDs without empty slots, and the cards to
+//! fill decks are stored only if GameConfig::doFillDecks is set, so a record
+//! of a game of 100 actions takes about 700 bytes.
+//!
+namespace GameRecordFile
+{
+constexpr char MAGIC[8] = { 'R', 'S', 'G', 'A', 'M', 'E', 0, 0 };
+constexpr std::uint32_t VERSION = 1;
+
+//! The maximum size of the payload of a record. A larger size means that
+//! the file is corrupted.
+constexpr std::uint32_t MAX_RECORD_SIZE = 1 << 24;
+
+//! Header of a record file.
+struct FileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t reserved;
+};
+
+//! Encodes the payload of \p record and appends it to \p dst.
+//! \param record The record to encode.
+//! \param dst The buffer to append encoded bytes.
+void Encode(const GameRecord& record, std::vector<char>& dst);
+
+//! Decodes the payload of a record into \p record. The cards of decks are
+//! found in \p cardDatabase, which is also set to the configuration. Throws
+//! std::runtime_error if \p src is corrupted or a card is not found.
+//! \param src The encoded bytes.
+//! \param srcSize The number of encoded bytes.
+//! \param cardDatabase The card database of decks, or nullptr to use the
+//! default card database (Cards).
+//! \param record The record to decode into. Its buffers are reused.
+void Decode(const char* src, std::size_t srcSize,
+            const CardDatabase* cardDatabase, GameRecord& record);
+}  // namespace GameRecordFile
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_GAME_RECORD_HPP
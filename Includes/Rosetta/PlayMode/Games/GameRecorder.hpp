@@ -0,0 +1,62 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_GAME_RECORDER_HPP
+#define ROSETTASTONE_PLAYMODE_GAME_RECORDER_HPP
+
+#include <Rosetta/PlayMode/Agents/Action.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GameRecord.hpp>
+
+#include <memory>
+#include <tuple>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief GameRecorder class.
+//!
+//! This class owns a game and records the actions applied to it. The engine
+//! is reseeded from the seed of the record before the game is created and
+//! before each action, so agents can use the engine between actions and a
+//! record reproduces the game whatever happened between them. The game
+//! always runs automatically and skips mulligan.
+//!
+class GameRecorder
+{
+ public:
+    //! Creates and starts a game with given \p gameConfig and \p seed.
+    //! \param gameConfig The configuration of the game.
+    //! \param seed The seed of the game.
+    GameRecorder(const GameConfig& gameConfig, unsigned int seed);
+
+    //! Returns the recorded game.
+    //! \return The recorded game.
+    Game& GetGame();
+
+    //! Applies \p action to the game and records it.
+    //! \param action The legal action of the current player.
+    //! \return The play states of the first and the second player.
+    std::tuple<PlayState, PlayState> Apply(const Action& action);
+
+    //! Returns the record of the game with the state hash of the current
+    //! state.
+    //! \return The record of the game.
+    GameRecord GetRecord() const;
+
+    //! Reseeds the engine for the step of a recorded game. The game is
+    //! created at step 0 and the i-th action is applied at step i + 1.
+    //! \param seed The seed of the game.
+    //! \param stepIdx The index of the step.
+    static void SeedStep(unsigned int seed, std::size_t stepIdx);
+
+ private:
+    GameRecord m_record;
+    std::unique_ptr<Game> m_game;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_GAME_RECORDER_HPP
@@ -0,0 +1,180 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_CARD_IMAGE_HPP
+#define ROSETTASTONE_PLAYMODE_CARD_IMAGE_HPP
+
+#include <Rosetta/PlayMode/Cards/Card.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief CardImage class.
+//!
+//! This class stores the immutable card data (ID, dbfID, name, text and game
+//! tags) in a flat, pointer-free image. One process builds the image into a
+//! file or a POSIX shared-memory segment, and other processes map it
+//! read-only. Because every reference inside the image is an offset, the
+//! image can be mapped at any address.
+//!
+//! GetRecord(), GetString(), GetGameTag() and FindIndexByDbfID() read the
+//! mapped records directly, so all processes share one copy of them.
+//! Load() creates the card list of a process without parsing cards.json,
+//! which cuts startup time, but the created cards are still owned by each
+//! process. Powers are code, so they are also created by each process
+//! through InternalCardLoader.
+//!
+class CardImage
+{
+ public:
+    //! Header of the card image.
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t numCards;
+        std::uint64_t size;
+        std::uint64_t recordsOffset;
+        std::uint64_t dbfIndexOffset;
+        std::uint64_t tagsOffset;
+        std::uint64_t stringsOffset;
+    };
+
+    //! A reference to the string in the string table.
+    struct StringRef
+    {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    //! A card record of the card image.
+    struct Record
+    {
+        std::int32_t dbfID;
+        StringRef id;
+        StringRef name;
+        StringRef text;
+        std::uint32_t tagsBegin;
+        std::uint32_t numTags;
+    };
+
+    //! A game tag entry of the card image.
+    struct TagEntry
+    {
+        std::int32_t tag;
+        std::int32_t value;
+    };
+
+    //! An entry of the index table sorted by dbfID.
+    struct DbfIndexEntry
+    {
+        std::int32_t dbfID;
+        std::uint32_t recordIdx;
+    };
+
+    //! Default constructor.
+    CardImage() = default;
+
+    //! Destructor: Unmaps the card image.
+    ~CardImage();
+
+    //! Deleted copy constructor.
+    CardImage(const CardImage&) = delete;
+
+    //! Deleted move constructor.
+    CardImage(CardImage&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    CardImage& operator=(const CardImage&) = delete;
+
+    //! Deleted move assignment operator.
+    CardImage& operator=(CardImage&&) noexcept = delete;
+
+    //! Builds the card image from \p cards.
+    //! \param cards A list of cards to store.
+    //! \return The bytes of the card image.
+    static std::vector<char> Build(const std::vector<Card*>& cards);
+
+    //! Writes the card image of \p cards to the file at \p path.
+    //! \param cards A list of cards to store.
+    //! \param path The path of the file to write.
+    static void Save(const std::vector<Card*>& cards, const std::string& path);
+
+    //! Writes the card image of \p cards to the POSIX shared-memory segment
+    //! \p name. The segment must not exist, so call Unpublish() first to
+    //! replace it. Processes that attached the old segment keep reading it.
+    //! \param cards A list of cards to store.
+    //! \param name The name of shared-memory segment (e.g. "/rosetta-cards").
+    static void Publish(const std::vector<Card*>& cards,
+                        const std::string& name);
+
+    //! Removes the POSIX shared-memory segment \p name.
+    //! \param name The name of shared-memory segment.
+    static void Unpublish(const std::string& name);
+
+    //! Maps the card image in the file at \p path read-only.
+    //! \param path The path of the file to map.
+    void Open(const std::string& path);
+
+    //! Maps the card image in the POSIX shared-memory segment \p name
+    //! read-only.
+    //! \param name The name of shared-memory segment.
+    void Attach(const std::string& name);
+
+    //! Unmaps the card image.
+    void Close();
+
+    //! Returns the flag that indicates whether the card image is mapped.
+    //! \return The flag that indicates whether the card image is mapped.
+    bool IsOpen() const;
+
+    //! Returns the number of cards in the card image.
+    //! \return The number of cards in the card image.
+    std::size_t GetCount() const;
+
+    //! Returns the record at \p idx.
+    //! \param idx The index of the record.
+    //! \return The record at \p idx.
+    const Record& GetRecord(std::size_t idx) const;
+
+    //! Returns the string that \p ref refers to.
+    //! \param ref The reference to the string.
+    //! \return The string that \p ref refers to.
+    std::string_view GetString(const StringRef& ref) const;
+
+    //! Returns the value of game tag of the record at \p idx.
+    //! \param idx The index of the record.
+    //! \param tag The game tag to find.
+    //! \return The value of game tag if it exists, 0 otherwise.
+    int GetGameTag(std::size_t idx, GameTag tag) const;
+
+    //! Returns the index of the record that matches \p dbfID.
+    //! \param dbfID The dbfID of the card.
+    //! \return The index of the record if it exists, -1 otherwise.
+    int FindIndexByDbfID(int dbfID) const;
+
+    //! Creates a list of cards from the card image. The cards are copies
+    //! in the heap of the calling process.
+    //! \param cards Data storage to store created cards.
+    void Load(std::vector<Card*>& cards) const;
+
+ private:
+    //! Validates the header and the size of mapped image.
+    void Validate() const;
+
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_isMapped = false;
+    std::vector<char> m_buffer;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_CARD_IMAGE_HPP
@@ -7,10 +7,12 @@
 #ifndef ROSETTASTONE_PLAYMODE_CARD_LOADER_HPP
 #define ROSETTASTONE_PLAYMODE_CARD_LOADER_HPP
 
+#include <Rosetta/Common/ThreadPool.hpp>
 #include <Rosetta/PlayMode/Cards/Card.hpp>
 
 #include <json/json.hpp>
 
+#include <string>
 #include <vector>
 
 namespace RosettaStone::PlayMode
@@ -25,7 +27,17 @@ class CardLoader
  public:
     //! Loads card data from cards.json.
     //! \param cards Data storage to store added cards with power.
-    static void Load(std::vector<Card*>& cards);
+    //! \param pool The thread pool to convert cards in parallel. If it is
+    //! nullptr, cards are converted on the calling thread. The order of cards
+    //! is the same in both cases.
+    static void Load(std::vector<Card*>& cards, ThreadPool* pool = nullptr);
+
+    //! Loads card data from the cards.json file at \p path.
+    //! \param path The path of cards.json.
+    //! \param cards Data storage to store added cards with power.
+    //! \param pool The thread pool to convert cards in parallel, or nullptr.
+    static void Load(const std::string& path, std::vector<Card*>& cards,
+                     ThreadPool* pool = nullptr);
 };
 }  // namespace RosettaStone::PlayMode
 
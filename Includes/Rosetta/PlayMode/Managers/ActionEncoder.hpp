@@ -0,0 +1,97 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_ACTION_ENCODER_HPP
+#define ROSETTASTONE_PLAYMODE_ACTION_ENCODER_HPP
+
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/PlayMode/Agents/Action.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+class Game;
+
+//!
+//! \brief ActionEncoder class.
+//!
+//! This class maps an action to an index of a fixed action space and back,
+//! and writes a mask of legal indices. The mask is built from the same
+//! checks as GetLegalActions(), so an index is legal if and only if its
+//! action is in GetLegalActions().
+//!
+//! The layout of the action space is:
+//! - [PLAY_CARD_OFFSET] PLAY_CARD of (hand position, choose one option,
+//!   target + 1). Target 0 means no target.
+//! - [ATTACK_OFFSET] ATTACK of (attacker, defender - MAX_FIELD_SIZE - 1).
+//! - [HERO_POWER_OFFSET] HERO_POWER of (target + 1).
+//! - [TRADE_CARD_OFFSET] TRADE_CARD of (hand position).
+//! - [CHOOSE_OFFSET] CHOOSE of (choice position).
+//! - [END_TURN_OFFSET] END_TURN.
+//!
+//! Minions are always played to the rightmost position as in
+//! GetLegalActions(), so the position is not a part of the action space.
+//!
+class ActionEncoder
+{
+ public:
+    static constexpr std::size_t NUM_CHOOSE_ONE_OPTIONS = 3;
+    static constexpr std::size_t NUM_TARGETS = NUM_CHARACTERS + 1;
+    static constexpr std::size_t NUM_SIDE_CHARACTERS = MAX_FIELD_SIZE + 1;
+
+    //! The mulligan of the second player has the most choices. Choices beyond
+    //! it are never legal in the mask.
+    static constexpr std::size_t NUM_CHOICES = 4;
+
+    static constexpr std::size_t PLAY_CARD_OFFSET = 0;
+    static constexpr std::size_t ATTACK_OFFSET =
+        PLAY_CARD_OFFSET + MAX_HAND_SIZE * NUM_CHOOSE_ONE_OPTIONS * NUM_TARGETS;
+    static constexpr std::size_t HERO_POWER_OFFSET =
+        ATTACK_OFFSET + NUM_SIDE_CHARACTERS * NUM_SIDE_CHARACTERS;
+    static constexpr std::size_t TRADE_CARD_OFFSET =
+        HERO_POWER_OFFSET + NUM_TARGETS;
+    static constexpr std::size_t CHOOSE_OFFSET =
+        TRADE_CARD_OFFSET + MAX_HAND_SIZE;
+    static constexpr std::size_t END_TURN_OFFSET = CHOOSE_OFFSET + NUM_CHOICES;
+    static constexpr std::size_t NUM_ACTIONS = END_TURN_OFFSET + 1;
+
+    //! Constructs action encoder with given \p numThreads.
+    //! \param numThreads The number of worker threads of WriteMaskBatch(). If
+    //! it is 0, the number of hardware threads is used. If it is 1, games are
+    //! processed on the calling thread.
+    explicit ActionEncoder(std::size_t numThreads = 1);
+
+    //! Returns the index of \p action.
+    //! \param action The action to encode.
+    //! \return The index of \p action in the action space.
+    static std::size_t Encode(const Action& action);
+
+    //! Returns the action at \p actionIdx.
+    //! \param actionIdx The index in the action space.
+    //! \return The action at \p actionIdx.
+    static Action Decode(std::size_t actionIdx);
+
+    //! Writes the legal indices of the current player. It doesn't allocate.
+    //! \param game The game in main action step.
+    //! \param mask The buffer of NUM_ACTIONS elements. An element is 1 if the
+    //! index is legal and 0 otherwise.
+    static void WriteMask(Game& game, std::uint8_t* mask);
+
+    //! Writes the legal indices of the current player of each game.
+    //! \param games The games to write.
+    //! \param masks The buffer of (games.size(), NUM_ACTIONS).
+    void WriteMaskBatch(const std::vector<Game*>& games, std::uint8_t* masks);
+
+ private:
+    ThreadPool m_pool;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_ACTION_ENCODER_HPP
@@ -0,0 +1,58 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_GAME_RECORD_READER_HPP
+#define ROSETTASTONE_PLAYMODE_GAME_RECORD_READER_HPP
+
+#include <Rosetta/PlayMode/Games/GameRecord.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+class CardDatabase;
+
+//!
+//! \brief GameRecordReader class.
+//!
+//! This class reads the records of a record file (see GameRecordFile) one
+//! by one, so only one record is in memory however large the file is. A
+//! record that is partially written is treated as the end of the file, so
+//! a file can be read while it is written.
+//!
+class GameRecordReader
+{
+ public:
+    //! Opens the record file at \p path and checks its header.
+    //! \param path The path of the file to read.
+    //! \param cardDatabase The card database of decks, or nullptr to use the
+    //! default card database (Cards). It must outlive the records.
+    explicit GameRecordReader(const std::string& path,
+                              const CardDatabase* cardDatabase = nullptr);
+
+    //! Reads the next record into \p record. Throws std::runtime_error if
+    //! the record is corrupted.
+    //! \param record The record to read into. Its buffers are reused.
+    //! \return true if a record is read, false at the end of the file.
+    bool Read(GameRecord& record);
+
+    //! Returns the number of records read so far.
+    //! \return The number of records read so far.
+    std::size_t GetNumRecords() const;
+
+ private:
+    std::string m_path;
+    std::ifstream m_file;
+    const CardDatabase* m_cardDatabase = nullptr;
+
+    std::vector<char> m_buffer;
+    std::size_t m_numRecords = 0;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_GAME_RECORD_READER_HPP
@@ -0,0 +1,81 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_GAME_RECORD_WRITER_HPP
+#define ROSETTASTONE_PLAYMODE_GAME_RECORD_WRITER_HPP
+
+#include <Rosetta/PlayMode/Games/GameRecord.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief GameRecordWriter class.
+//!
+//! This class appends game records to a record file (see GameRecordFile).
+//! Records are encoded into a reusable buffer and written through a
+//! buffered stream, so a file can hold millions of games. A file is valid
+//! after each record, and a reader ignores a record that is partially
+//! written. Write() can be called from several threads.
+//!
+class GameRecordWriter
+{
+ public:
+    //! Creates the record file at \p path and writes its header.
+    //! \param path The path of the file to create.
+    explicit GameRecordWriter(const std::string& path);
+
+    //! Destructor: Closes the record file.
+    ~GameRecordWriter();
+
+    //! Deleted copy constructor.
+    GameRecordWriter(const GameRecordWriter&) = delete;
+
+    //! Deleted move constructor.
+    GameRecordWriter(GameRecordWriter&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    GameRecordWriter& operator=(const GameRecordWriter&) = delete;
+
+    //! Deleted move assignment operator.
+    GameRecordWriter& operator=(GameRecordWriter&&) noexcept = delete;
+
+    //! Appends \p record.
+    //! \param record The record to append.
+    void Write(const GameRecord& record);
+
+    //! Writes the buffered records to the file.
+    void Flush();
+
+    //! Writes the buffered records and closes the file. It does nothing if
+    //! the file is already closed.
+    void Close();
+
+    //! Returns the number of appended records.
+    //! \return The number of appended records.
+    std::size_t GetNumRecords() const;
+
+    //! Returns the number of bytes of the file.
+    //! \return The number of bytes of the file.
+    std::uint64_t GetNumBytes() const;
+
+ private:
+    std::string m_path;
+    std::ofstream m_file;
+
+    mutable std::mutex m_mutex;
+    std::vector<char> m_buffer;
+    std::size_t m_numRecords = 0;
+    std::uint64_t m_numBytes = 0;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_GAME_RECORD_WRITER_HPP
@@ -0,0 +1,111 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_OBSERVATION_ENCODER_HPP
+#define ROSETTASTONE_PLAYMODE_OBSERVATION_ENCODER_HPP
+
+#include <Rosetta/Common/Constants.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/PlayMode/Views/ObservationView.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+class Game;
+class Player;
+
+//!
+//! \brief ObservationEncoder class.
+//!
+//! This class writes the view of a player (see ObservationView) into a
+//! fixed-size float tensor. It reads the game only through the view, so
+//! hidden information never reaches an observation.
+//! Counts, stats and flags (0 or 1) are stored as they are, and cards are
+//! stored by dbfID, which is exact in float. Empty slots are all zeros.
+//!
+//! The layout of an observation is:
+//! - [GAME_OFFSET] turn.
+//! - [PLAYER_OFFSET] the block of the player.
+//! - [OPPONENT_OFFSET] the block of the opponent.
+//! - [HAND_OFFSET] MAX_HAND_SIZE cards in hand of the player.
+//!
+//! A block of a player consists of:
+//! - player: class, total mana, remaining mana, overload owed, overload
+//!   locked, number of cards in hand, number of cards in deck, number of
+//!   secrets, whether the player has the turn.
+//! - hero: dbfID, health, armor, attack, can attack, frozen, immune, stealth.
+//! - hero power: dbfID, cost, exhausted.
+//! - weapon: present, dbfID, attack, durability.
+//! - MAX_FIELD_SIZE minions: present, dbfID, attack, health, base health,
+//!   cost, spell power, can attack, taunt, divine shield, charge, rush,
+//!   windfury, stealth, poisonous, lifesteal, frozen, deathrattle, reborn,
+//!   silenced.
+//!
+//! A card in hand consists of present, dbfID, cost, card type, attack and
+//! health. Cards in hand of the opponent are hidden, so only their number is
+//! stored.
+//!
+class ObservationEncoder
+{
+ public:
+    static constexpr std::size_t NUM_GAME_FEATURES = 1;
+    static constexpr std::size_t NUM_PLAYER_FEATURES = 9;
+    static constexpr std::size_t NUM_HERO_FEATURES = 8;
+    static constexpr std::size_t NUM_HERO_POWER_FEATURES = 3;
+    static constexpr std::size_t NUM_WEAPON_FEATURES = 4;
+    static constexpr std::size_t NUM_MINION_FEATURES = 20;
+    static constexpr std::size_t NUM_HAND_FEATURES = 6;
+
+    static constexpr std::size_t NUM_BLOCK_FEATURES =
+        NUM_PLAYER_FEATURES + NUM_HERO_FEATURES + NUM_HERO_POWER_FEATURES +
+        NUM_WEAPON_FEATURES + MAX_FIELD_SIZE * NUM_MINION_FEATURES;
+
+    static constexpr std::size_t BLOCK_HERO_OFFSET = NUM_PLAYER_FEATURES;
+    static constexpr std::size_t BLOCK_HERO_POWER_OFFSET =
+        BLOCK_HERO_OFFSET + NUM_HERO_FEATURES;
+    static constexpr std::size_t BLOCK_WEAPON_OFFSET =
+        BLOCK_HERO_POWER_OFFSET + NUM_HERO_POWER_FEATURES;
+    static constexpr std::size_t BLOCK_FIELD_OFFSET =
+        BLOCK_WEAPON_OFFSET + NUM_WEAPON_FEATURES;
+
+    static constexpr std::size_t GAME_OFFSET = 0;
+    static constexpr std::size_t PLAYER_OFFSET = NUM_GAME_FEATURES;
+    static constexpr std::size_t OPPONENT_OFFSET =
+        PLAYER_OFFSET + NUM_BLOCK_FEATURES;
+    static constexpr std::size_t HAND_OFFSET =
+        OPPONENT_OFFSET + NUM_BLOCK_FEATURES;
+    static constexpr std::size_t NUM_FEATURES =
+        HAND_OFFSET + MAX_HAND_SIZE * NUM_HAND_FEATURES;
+
+    //! Constructs observation encoder with given \p numThreads.
+    //! \param numThreads The number of worker threads of EncodeBatch(). If it
+    //! is 0, the number of hardware threads is used. If it is 1, games are
+    //! encoded on the calling thread.
+    explicit ObservationEncoder(std::size_t numThreads = 1);
+
+    //! Writes \p view.
+    //! \param view The view of the player who observes the game.
+    //! \param observation The buffer of NUM_FEATURES elements.
+    static void Encode(const ObservationView& view, float* observation);
+
+    //! Writes the view of \p player.
+    //! \param player The player who observes the game.
+    //! \param observation The buffer of NUM_FEATURES elements.
+    static void Encode(const Player& player, float* observation);
+
+    //! Writes the view of the current player of each game.
+    //! \param games The games to encode.
+    //! \param observations The buffer of (games.size(), NUM_FEATURES).
+    void EncodeBatch(const std::vector<Game*>& games, float* observations);
+
+ private:
+    ThreadPool m_pool;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_OBSERVATION_ENCODER_HPP
@@ -0,0 +1,91 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_TRAJECTORY_FILE_HPP
+#define ROSETTASTONE_PLAYMODE_TRAJECTORY_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief TrajectoryChunk struct.
+//!
+//! This struct stores the columns of consecutive steps. Each column has
+//! numSteps rows: the observation (see ObservationEncoder), the index of the
+//! environment, the index of the action and the mask of legal actions (see
+//! ActionEncoder), the reward and whether the game is done.
+//!
+struct TrajectoryChunk
+{
+    std::size_t numSteps = 0;
+    std::vector<float> observations;
+    std::vector<std::uint32_t> envs;
+    std::vector<std::int32_t> actions;
+    std::vector<std::uint8_t> actionMasks;
+    std::vector<float> rewards;
+    std::vector<std::uint8_t> dones;
+};
+
+//!
+//! \brief The format of trajectory files.
+//!
+//! A trajectory file is a FileHeader followed by chunks. A chunk is a
+//! ChunkHeader followed by its compressed columns in the order of
+//! TrajectoryChunk. A file is valid after each chunk, so a reader ignores
+//! a chunk that is partially written.
+//!
+//! A column is compressed by XOR-ing each row with the previous one and
+//! encoding runs of zero bytes, which are common in consecutive steps of
+//! the same game and in masks.
+//!
+namespace TrajectoryFile
+{
+constexpr char MAGIC[8] = { 'R', 'S', 'T', 'R', 'A', 'J', 0, 0 };
+constexpr std::uint32_t VERSION = 1;
+constexpr std::size_t NUM_COLUMNS = 6;
+
+//! Header of a trajectory file.
+struct FileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t numFeatures;
+    std::uint32_t numActions;
+    std::uint32_t reserved;
+};
+
+//! Header of a chunk.
+struct ChunkHeader
+{
+    std::uint32_t numSteps;
+    std::uint32_t reserved;
+    std::uint64_t columnSizes[NUM_COLUMNS];
+};
+
+//! Compresses \p numRows rows of \p rowSize bytes and appends them to \p dst.
+//! \param src The rows to compress.
+//! \param rowSize The number of bytes of a row.
+//! \param numRows The number of rows.
+//! \param dst The buffer to append compressed bytes.
+void Compress(const void* src, std::size_t rowSize, std::size_t numRows,
+              std::vector<char>& dst);
+
+//! Decompresses \p numRows rows of \p rowSize bytes. Throws
+//! std::runtime_error if \p src is corrupted.
+//! \param src The compressed bytes.
+//! \param srcSize The number of compressed bytes.
+//! \param rowSize The number of bytes of a row.
+//! \param numRows The number of rows.
+//! \param dst The buffer of \p rowSize * \p numRows bytes.
+void Decompress(const char* src, std::size_t srcSize, std::size_t rowSize,
+                std::size_t numRows, void* dst);
+}  // namespace TrajectoryFile
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_TRAJECTORY_FILE_HPP
@@ -0,0 +1,102 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_TRAJECTORY_READER_HPP
+#define ROSETTASTONE_PLAYMODE_TRAJECTORY_READER_HPP
+
+#include <Rosetta/PlayMode/Managers/TrajectoryFile.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief TrajectoryReader class.
+//!
+//! This class maps a trajectory file (see TrajectoryFile) read-only and
+//! decompresses its chunks on demand. Only the chunk headers are read when
+//! the file is opened. A chunk that is partially written is ignored, so a
+//! file can be read while it is written.
+//!
+class TrajectoryReader
+{
+ public:
+    //! Default constructor.
+    TrajectoryReader() = default;
+
+    //! Destructor: Unmaps the trajectory file.
+    ~TrajectoryReader();
+
+    //! Deleted copy constructor.
+    TrajectoryReader(const TrajectoryReader&) = delete;
+
+    //! Deleted move constructor.
+    TrajectoryReader(TrajectoryReader&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    TrajectoryReader& operator=(const TrajectoryReader&) = delete;
+
+    //! Deleted move assignment operator.
+    TrajectoryReader& operator=(TrajectoryReader&&) noexcept = delete;
+
+    //! Maps the trajectory file at \p path read-only.
+    //! \param path The path of the file to map.
+    void Open(const std::string& path);
+
+    //! Unmaps the trajectory file.
+    void Close();
+
+    //! Returns the flag that indicates whether the trajectory file is mapped.
+    //! \return The flag that indicates whether the trajectory file is mapped.
+    bool IsOpen() const;
+
+    //! Returns the number of features of an observation.
+    //! \return The number of features of an observation.
+    std::size_t GetNumFeatures() const;
+
+    //! Returns the number of actions of a mask.
+    //! \return The number of actions of a mask.
+    std::size_t GetNumActions() const;
+
+    //! Returns the number of complete chunks.
+    //! \return The number of complete chunks.
+    std::size_t GetNumChunks() const;
+
+    //! Returns the number of steps in complete chunks.
+    //! \return The number of steps in complete chunks.
+    std::size_t GetNumSteps() const;
+
+    //! Returns the number of steps in the chunk at \p chunkIdx.
+    //! \param chunkIdx The index of the chunk.
+    //! \return The number of steps in the chunk.
+    std::size_t GetNumSteps(std::size_t chunkIdx) const;
+
+    //! Decompresses the chunk at \p chunkIdx into \p chunk. The buffers of
+    //! \p chunk are reused.
+    //! \param chunkIdx The index of the chunk.
+    //! \param chunk The chunk to store the columns.
+    void ReadChunk(std::size_t chunkIdx, TrajectoryChunk& chunk) const;
+
+ private:
+    //! Reads the chunk header at \p offset.
+    //! \param offset The offset of the chunk header.
+    //! \return The chunk header.
+    TrajectoryFile::ChunkHeader ReadChunkHeader(std::size_t offset) const;
+
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_isMapped = false;
+    std::vector<char> m_buffer;
+
+    TrajectoryFile::FileHeader m_header{};
+    std::vector<std::size_t> m_chunkOffsets;
+    std::size_t m_numSteps = 0;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_TRAJECTORY_READER_HPP
@@ -0,0 +1,154 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_TRAJECTORY_WRITER_HPP
+#define ROSETTASTONE_PLAYMODE_TRAJECTORY_WRITER_HPP
+
+#include <Rosetta/PlayMode/Managers/TrajectoryFile.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief TrajectoryWriter class.
+//!
+//! This class appends steps of self-play to a trajectory file (see
+//! TrajectoryFile). Steps are copied into a chunk in memory, and a full chunk
+//! is compressed and written by a background thread. Written chunks are
+//! reused, and at most maxPendingChunks full chunks wait to be written: when
+//! the background thread falls that far behind, the Append() that fills the
+//! next chunk blocks until a chunk is written. Otherwise Append() never waits
+//! for I/O. An error of the background thread is rethrown by the next call of
+//! Append(), Flush() or Close().
+//!
+class TrajectoryWriter
+{
+ public:
+    //! Constructs trajectory writer that creates the file at \p path.
+    //! \param path The path of the file to write.
+    //! \param chunkSize The number of steps in a chunk.
+    //! \param maxPendingChunks The maximum number of full chunks that wait to
+    //! be written before Append() blocks.
+    explicit TrajectoryWriter(const std::string& path,
+                              std::size_t chunkSize = 4096,
+                              std::size_t maxPendingChunks = 4);
+
+    //! Destructor: Writes the remaining steps and closes the file.
+    ~TrajectoryWriter();
+
+    //! Deleted copy constructor.
+    TrajectoryWriter(const TrajectoryWriter&) = delete;
+
+    //! Deleted move constructor.
+    TrajectoryWriter(TrajectoryWriter&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    TrajectoryWriter& operator=(const TrajectoryWriter&) = delete;
+
+    //! Deleted move assignment operator.
+    TrajectoryWriter& operator=(TrajectoryWriter&&) noexcept = delete;
+
+    //! Appends a step. It can be called from several threads.
+    //! \param envIdx The index of the environment.
+    //! \param observation The observation of NUM_FEATURES elements.
+    //! \param actionIdx The index of the action.
+    //! \param actionMask The mask of NUM_ACTIONS elements.
+    //! \param reward The reward of the step.
+    //! \param done The flag that indicates whether the game is done.
+    void Append(std::size_t envIdx, const float* observation, int actionIdx,
+                const std::uint8_t* actionMask, float reward, bool done);
+
+    //! Appends a step of each environment in the order of environments.
+    //! \param numEnvs The number of environments.
+    //! \param observations The observations of (numEnvs, NUM_FEATURES).
+    //! \param actionIndices The indices of actions of (numEnvs).
+    //! \param actionMasks The masks of (numEnvs, NUM_ACTIONS).
+    //! \param rewards The rewards of (numEnvs).
+    //! \param dones The flags of (numEnvs).
+    void AppendBatch(std::size_t numEnvs, const float* observations,
+                     const std::int32_t* actionIndices,
+                     const std::uint8_t* actionMasks, const float* rewards,
+                     const std::uint8_t* dones);
+
+    //! Writes all steps appended before the call and waits until they are
+    //! written and flushed to the file. Append() is not blocked while it
+    //! waits.
+    void Flush();
+
+    //! Writes all appended steps, stops the background thread and closes the
+    //! file. It does nothing if the file is already closed.
+    void Close();
+
+    //! Returns the number of appended steps.
+    //! \return The number of appended steps.
+    std::size_t GetNumSteps() const;
+
+    //! Returns the number of bytes written to the file.
+    //! \return The number of bytes written to the file.
+    std::uint64_t GetNumBytes() const;
+
+ private:
+    //! Allocates a chunk of the chunk size.
+    //! \return The allocated chunk.
+    std::unique_ptr<TrajectoryChunk> MakeChunk() const;
+
+    //! Hands the current chunk to the background thread. It waits while
+    //! m_maxPendingChunks chunks are pending. m_appendMutex must be locked.
+    void PushChunk();
+
+    //! Rethrows the error of the background thread. m_queueMutex must be
+    //! locked.
+    void CheckError() const;
+
+    //! Writes chunks and flushes the file on request until the writer is
+    //! stopped.
+    void Run();
+
+    //! Compresses and writes \p chunk.
+    //! \param chunk The chunk to write.
+    void WriteChunk(const TrajectoryChunk& chunk);
+
+    std::string m_path;
+    std::ofstream m_file;
+    std::size_t m_chunkSize = 0;
+    std::size_t m_maxPendingChunks = 0;
+
+    std::mutex m_appendMutex;
+    std::unique_ptr<TrajectoryChunk> m_chunk;
+
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCondition;
+    std::condition_variable m_writtenCondition;
+    std::deque<std::unique_ptr<TrajectoryChunk>> m_pendingChunks;
+    std::vector<std::unique_ptr<TrajectoryChunk>> m_freeChunks;
+    std::uint64_t m_numPushedChunks = 0;
+    std::uint64_t m_numWrittenChunks = 0;
+    std::uint64_t m_numFlushRequests = 0;
+    std::uint64_t m_numFlushes = 0;
+    std::uint64_t m_flushTarget = 0;
+    bool m_stop = false;
+    std::exception_ptr m_error;
+    std::thread m_thread;
+
+    std::vector<char> m_compressed;
+    std::atomic<std::size_t> m_numSteps{ 0 };
+    std::atomic<std::uint64_t> m_numBytes{ 0 };
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_TRAJECTORY_WRITER_HPP
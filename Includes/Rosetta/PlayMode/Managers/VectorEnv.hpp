@@ -0,0 +1,202 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_VECTOR_ENV_HPP
+#define ROSETTASTONE_PLAYMODE_VECTOR_ENV_HPP
+
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/PlayMode/Agents/Action.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Managers/ActionEncoder.hpp>
+#include <Rosetta/PlayMode/Managers/ObservationEncoder.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace RosettaStone::PlayMode
+{
+//!
+//! \brief VectorEnv class.
+//!
+//! This class owns a number of games and applies an action of the current
+//! player to each one of them at once on a thread pool. The outputs of all
+//! games are stored in contiguous buffers in the order of games: the
+//! observation of the current player (see ObservationEncoder), the mask of
+//! legal actions (see ActionEncoder), the index of the current player (0 or
+//! 1), the turn, the rewards of both players and whether the game is done.
+//! A game that is done is restarted in the same step, so the observation,
+//! the mask, the current player, the turn and the legal actions belong to
+//! the new game while the rewards and the flag belong to the finished one.
+//!
+//! The outputs are double-buffered: Reset() and Step() write into the back
+//! buffers in place and swap them with the front ones at the end, so the
+//! outputs of the previous call stay valid and unchanged during the next
+//! call. A buffer is never reallocated, so its data can be shared without
+//! copy until the call after next. Reset() and Step() are serialized, and
+//! the index of the front buffers is atomic, so the outputs can be read on
+//! another thread while a call runs.
+//!
+//! An illegal action throws before any game is changed. If Reset() or
+//! Step() throws after that, some games may already be stepped or replaced
+//! and the front buffers no longer match them, so the environment becomes
+//! invalid: the buffers are not swapped and Step() throws std::logic_error
+//! until Reset() succeeds. Step() also throws before the first Reset().
+//!
+//! The engine is reseeded before each step of a game from the seed of
+//! Reset(), the index of game, the index of episode and the index of step, so
+//! the outputs don't depend on the number of threads.
+//!
+class VectorEnv
+{
+ public:
+    //! Constructs vector environment with given \p gameConfig, \p numEnvs and
+    //! \p numThreads. The games always run automatically and skip mulligan.
+    //! \param gameConfig The configuration of games.
+    //! \param numEnvs The number of games.
+    //! \param numThreads The number of worker threads. If it is 0, the number
+    //! of hardware threads is used. If it is 1, games are stepped on the
+    //! calling thread.
+    VectorEnv(const GameConfig& gameConfig, std::size_t numEnvs,
+              std::size_t numThreads = 1);
+
+    //! Sets the maximum number of turns of a game. A game that exceeds it is
+    //! done with the rewards of 0.
+    //! \param maxTurns The maximum number of turns.
+    void SetMaxTurns(int maxTurns);
+
+    //! Starts new games.
+    //! \param seed The seed that the seeds of games are derived from.
+    void Reset(unsigned int seed);
+
+    //! Applies an action of the current player to each game.
+    //! \param actions The actions of NumEnvs() elements. Each one must be in
+    //! the legal actions of its game.
+    void Step(const std::vector<Action>& actions);
+
+    //! Applies an action of the current player to each game.
+    //! \param actionIndices The indices of actions of NumEnvs() elements in
+    //! the action space of ActionEncoder. Each one must be legal in the mask.
+    void Step(const std::vector<std::size_t>& actionIndices);
+
+    //! Returns the number of games.
+    //! \return The number of games.
+    std::size_t GetNumEnvs() const;
+
+    //! Returns the game at \p envIdx.
+    //! \param envIdx The index of game.
+    //! \return The game at \p envIdx. A game that is done is replaced by a new
+    //! one, so the reference is invalid after the next Reset() or Step().
+    Game& GetGame(std::size_t envIdx);
+
+    //! Returns the legal actions of the current player of the game. They are
+    //! decoded from the mask of the front buffers in the order of the action
+    //! space, so END_TURN is the last action if it is legal.
+    //! \param envIdx The index of game.
+    //! \return The legal actions of the current player.
+    std::vector<Action> GetLegalActions(std::size_t envIdx) const;
+
+    //! Returns the index of the front buffers. It is flipped by each call of
+    //! Reset() and Step().
+    //! \return The index of the front buffers, 0 or 1.
+    std::size_t GetBufferIndex() const;
+
+    //! Returns the observations of (NumEnvs(), NUM_FEATURES).
+    //! \return The observations of current players.
+    const std::vector<float>& GetObservations() const;
+
+    //! Returns the masks of legal actions of (NumEnvs(), NUM_ACTIONS).
+    //! \return The masks of legal actions of current players.
+    const std::vector<std::uint8_t>& GetActionMasks() const;
+
+    //! Returns the indices of current players of (NumEnvs()).
+    //! \return The indices of current players.
+    const std::vector<std::int32_t>& GetCurrentPlayers() const;
+
+    //! Returns the turns of games of (NumEnvs()).
+    //! \return The turns of games.
+    const std::vector<std::int32_t>& GetTurns() const;
+
+    //! Returns the rewards of the last step of (NumEnvs(), 2). A reward is 1
+    //! if the player won, -1 if the player lost and 0 otherwise.
+    //! \return The rewards of both players.
+    const std::vector<float>& GetRewards() const;
+
+    //! Returns the flags of the last step of (NumEnvs()). A flag is 1 if the
+    //! game was done in the last step and the game was restarted.
+    //! \return The flags that indicate whether games were done.
+    const std::vector<std::uint8_t>& GetDones() const;
+
+ private:
+    //! The outputs of all games.
+    struct Buffers
+    {
+        std::vector<float> observations;
+        std::vector<std::uint8_t> actionMasks;
+        std::vector<std::int32_t> currentPlayers;
+        std::vector<std::int32_t> turns;
+        std::vector<float> rewards;
+        std::vector<std::uint8_t> dones;
+    };
+
+    //! Runs \p func for the index of each game.
+    template <typename F>
+    void ForEachEnv(F&& func);
+
+    //! Throws std::logic_error if the environment is invalid.
+    void CheckValid() const;
+
+    //! Returns whether \p actionIdx is legal in the mask of the front buffers.
+    //! \param envIdx The index of game.
+    //! \param actionIdx The index in the action space.
+    //! \return true if \p actionIdx is legal, false otherwise.
+    bool IsLegal(std::size_t envIdx, std::size_t actionIdx) const;
+
+    //! Starts the next game of the environment.
+    //! \param envIdx The index of game.
+    void ResetEnv(std::size_t envIdx);
+
+    //! Reseeds the engine for the next step of the game.
+    //! \param envIdx The index of game.
+    void SeedNextStep(std::size_t envIdx);
+
+    //! Applies \p action to the game and restarts the game if it is done.
+    //! \param envIdx The index of game.
+    //! \param action The legal action of the current player.
+    //! \param buffers The buffers to write.
+    void StepEnv(std::size_t envIdx, const Action& action, Buffers& buffers);
+
+    //! Writes the rewards of the last step and whether the game is done.
+    //! \param envIdx The index of game.
+    //! \param buffers The buffers to write.
+    //! \return true if the game is done, false otherwise.
+    bool WriteResults(std::size_t envIdx, Buffers& buffers);
+
+    //! Writes the observation, the mask, the current player and the turn.
+    //! \param envIdx The index of game.
+    //! \param buffers The buffers to write.
+    void WriteOutputs(std::size_t envIdx, Buffers& buffers);
+
+    GameConfig m_gameConfig;
+    std::vector<std::unique_ptr<Game>> m_games;
+    std::vector<std::size_t> m_numEpisodes;
+    std::vector<std::size_t> m_numSteps;
+    ThreadPool m_pool;
+    unsigned int m_seed = 0;
+    int m_maxTurns = 100;
+
+    std::mutex m_stepMutex;
+    std::array<Buffers, 2> m_buffers;
+    std::atomic<std::size_t> m_front = 0;
+    bool m_isValid = false;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_VECTOR_ENV_HPP
@@ -187,6 +187,13 @@ class Playable : public Entity
     //! \return A list of valid play targets.
     std::vector<Character*> GetValidPlayTargets() const;
 
+    //! Checks whether \p target is in the valid play targets without building
+    //! the list of them.
+    //! \param target The proposed target that is a hero or a minion on the
+    //! field.
+    //! \return true if \p target is in GetValidPlayTargets(), false otherwise.
+    bool IsInValidPlayTargets(Character* target) const;
+
     //! Gets a random valid target in valid play targets.
     //! \return A randomly selected valid target.
     Character* GetRandomValidTarget();
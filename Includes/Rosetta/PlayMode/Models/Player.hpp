@@ -91,6 +91,10 @@ class Player : public Entity
     //! \return Player's hero power.
     HeroPower& GetHeroPower() const;
 
+    //! Deletes the hero power of the hero and erases it from the entity list
+    //! of the game. It is called before the hero power is replaced.
+    void DeleteHeroPower();
+
     //! Returns player's hero weapon.
     //! \return Player's hero weapon.
     Weapon& GetWeapon() const;
@@ -18,7 +18,7 @@
 
 #include <utility>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode
 {
@@ -56,7 +56,9 @@ class ComplexTask
             std::make_shared<SimpleTasks::IncludeTask>(EntityType::SOURCE),
             std::make_shared<SimpleTasks::FuncPlayableTask>(
                 [=](const std::vector<Playable*>& playables) {
-                    auto basicTotems = Cards::GetBasicTotems();
+                    const Game* game = playables[0]->game;
+                    auto basicTotems =
+                        game->GetCardDatabase().GetBasicTotems();
                     const auto totem = Entity::GetFromCard(
                         playables[0]->player, *Random::get(basicTotems));
 
@@ -20,6 +20,13 @@ class DeckCode
     //! \param deckCode The deck code generated by Hearthstone.
     //! \return The decoded deck that contains card information.
     static Deck Decode(std::string_view deckCode);
+
+    //! Decodes a deck code and returns the deck that contains some cards.
+    //! \param deckCode The deck code generated by Hearthstone.
+    //! \param cardDatabase The card database to look up cards.
+    //! \return The decoded deck that contains card information.
+    static Deck Decode(std::string_view deckCode,
+                       const CardDatabase& cardDatabase);
 };
 }  // namespace RosettaStone::PlayMode
 
@@ -0,0 +1,152 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_ENTITY_VIEW_HPP
+#define ROSETTASTONE_PLAYMODE_ENTITY_VIEW_HPP
+
+#include <Rosetta/Common/Enums/CardEnums.hpp>
+
+namespace RosettaStone::PlayMode
+{
+class Card;
+class Character;
+class Hero;
+class Minion;
+class Playable;
+class Weapon;
+
+//!
+//! \brief EntityView class.
+//!
+//! This class is a read-only view of an entity that an observer can see. It
+//! forwards the getters of the entity but never exposes the entity itself,
+//! so the owner, the game and other entities can't be reached through it.
+//! Getters that don't apply to the type of the entity (e.g. the health of a
+//! weapon) return 0 or false. A view is a few pointers, so it is passed by
+//! value.
+//!
+class EntityView
+{
+ public:
+    //! Constructs the view of \p playable.
+    //! \param playable The entity to view.
+    explicit EntityView(const Playable* playable);
+
+    //! Returns the card of the entity.
+    //! \return The card of the entity.
+    const Card& GetCard() const;
+
+    //! Returns the ID of the entity.
+    //! \return The ID of the entity.
+    int GetID() const;
+
+    //! Returns the value of \p tag of the entity.
+    //! \param tag The game tag to get.
+    //! \return The value of \p tag.
+    int GetGameTag(GameTag tag) const;
+
+    //! Returns the position of the entity in its zone.
+    //! \return The position of the entity in its zone.
+    int GetZonePosition() const;
+
+    //! Returns the cost of the entity.
+    //! \return The cost of the entity.
+    int GetCost() const;
+
+    //! Returns the attack of a character or a weapon.
+    //! \return The attack of a character or a weapon.
+    int GetAttack() const;
+
+    //! Returns the health of a character.
+    //! \return The health of a character.
+    int GetHealth() const;
+
+    //! Returns the base health of a character.
+    //! \return The base health of a character.
+    int GetBaseHealth() const;
+
+    //! Returns the armor of a hero.
+    //! \return The armor of a hero.
+    int GetArmor() const;
+
+    //! Returns the durability of a weapon.
+    //! \return The durability of a weapon.
+    int GetDurability() const;
+
+    //! Returns the spell power of a character.
+    //! \return The spell power of a character.
+    int GetSpellPower() const;
+
+    //! Returns whether the entity is exhausted.
+    //! \return true if the entity is exhausted, false otherwise.
+    bool IsExhausted() const;
+
+    //! Returns whether a character can attack.
+    //! \return true if a character can attack, false otherwise.
+    bool CanAttack() const;
+
+    //! Returns whether a character is frozen.
+    //! \return true if a character is frozen, false otherwise.
+    bool IsFrozen() const;
+
+    //! Returns whether a character or a weapon is immune.
+    //! \return true if a character or a weapon is immune, false otherwise.
+    bool IsImmune() const;
+
+    //! Returns whether the entity is silenced.
+    //! \return true if the entity is silenced, false otherwise.
+    bool IsSilenced() const;
+
+    //! Returns whether a minion has taunt.
+    //! \return true if a minion has taunt, false otherwise.
+    bool HasTaunt() const;
+
+    //! Returns whether a minion has divine shield.
+    //! \return true if a minion has divine shield, false otherwise.
+    bool HasDivineShield() const;
+
+    //! Returns whether a minion has charge.
+    //! \return true if a minion has charge, false otherwise.
+    bool HasCharge() const;
+
+    //! Returns whether a minion has rush.
+    //! \return true if a minion has rush, false otherwise.
+    bool HasRush() const;
+
+    //! Returns whether a character has windfury.
+    //! \return true if a character has windfury, false otherwise.
+    bool HasWindfury() const;
+
+    //! Returns whether a character has stealth.
+    //! \return true if a character has stealth, false otherwise.
+    bool HasStealth() const;
+
+    //! Returns whether a minion or a weapon has poisonous.
+    //! \return true if a minion or a weapon has poisonous, false otherwise.
+    bool HasPoisonous() const;
+
+    //! Returns whether the entity has lifesteal.
+    //! \return true if the entity has lifesteal, false otherwise.
+    bool HasLifesteal() const;
+
+    //! Returns whether the entity has deathrattle.
+    //! \return true if the entity has deathrattle, false otherwise.
+    bool HasDeathrattle() const;
+
+    //! Returns whether a minion has reborn.
+    //! \return true if a minion has reborn, false otherwise.
+    bool HasReborn() const;
+
+ private:
+    const Playable* m_playable = nullptr;
+    const Character* m_character = nullptr;
+    const Minion* m_minion = nullptr;
+    const Hero* m_hero = nullptr;
+    const Weapon* m_weapon = nullptr;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_ENTITY_VIEW_HPP
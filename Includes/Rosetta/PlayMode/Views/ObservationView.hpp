@@ -0,0 +1,63 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_OBSERVATION_VIEW_HPP
+#define ROSETTASTONE_PLAYMODE_OBSERVATION_VIEW_HPP
+
+#include <Rosetta/PlayMode/Views/EntityView.hpp>
+#include <Rosetta/PlayMode/Views/PlayerView.hpp>
+
+#include <functional>
+
+namespace RosettaStone::PlayMode
+{
+class Player;
+
+//!
+//! \brief ObservationView class.
+//!
+//! This class is the information set of a player: everything the player
+//! may know about the game and nothing else. It gives the view of the
+//! player, the view of the opponent with the hidden cards masked (see
+//! PlayerView) and the current choice of the player. No view exposes a
+//! game, a player, a zone or an entity, so code that is given a view can't
+//! reach hidden information. A view holds a pointer to the player and
+//! copies nothing, so it is cheap to create for each decision.
+//!
+class ObservationView
+{
+ public:
+    //! Constructs the view of \p player.
+    //! \param player The player who observes the game.
+    explicit ObservationView(const Player& player);
+
+    //! Returns the turn of the game.
+    //! \return The turn of the game.
+    int GetTurn() const;
+
+    //! Returns the view of the player.
+    //! \return The view of the player.
+    PlayerView GetPlayer() const;
+
+    //! Returns the view of the opponent from the player.
+    //! \return The view of the opponent.
+    PlayerView GetOpponent() const;
+
+    //! Returns the number of options of the current choice of the player.
+    //! \return The number of options, or 0 if there is no choice.
+    int GetNumChoices() const;
+
+    //! Calls \p func for each option of the current choice of the player.
+    //! \param func The function to call with each option.
+    void ForEachChoice(
+        const std::function<void(const EntityView&)>& func) const;
+
+ private:
+    const Player* m_player = nullptr;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_OBSERVATION_VIEW_HPP
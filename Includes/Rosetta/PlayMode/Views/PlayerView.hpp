@@ -0,0 +1,149 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PLAYMODE_PLAYER_VIEW_HPP
+#define ROSETTASTONE_PLAYMODE_PLAYER_VIEW_HPP
+
+#include <Rosetta/Common/Enums/CardEnums.hpp>
+#include <Rosetta/Common/Enums/GameEnums.hpp>
+#include <Rosetta/PlayMode/Views/EntityView.hpp>
+
+#include <functional>
+
+namespace RosettaStone::PlayMode
+{
+class Player;
+
+//!
+//! \brief PlayedCard struct.
+//!
+//! This struct is a card in the play history of a player as an observer
+//! sees it. The card of a secret of the opponent is nullptr until the
+//! secret is revealed.
+//!
+struct PlayedCard
+{
+    const Card* card = nullptr;
+    const Card* target = nullptr;
+    int turn = -1;
+    int chooseOne = -1;
+};
+
+//!
+//! \brief PlayerView class.
+//!
+//! This class is a read-only view of a player from the view of an observer,
+//! who is the player or the opponent. Public information (heroes, minions,
+//! weapons and counts) is always visible. The cards in hand and the secrets
+//! are visible to the player, and to the opponent only if they are revealed
+//! (GameTag::REVEALED). The order of the deck is never visible. Zones are
+//! iterated in place, so nothing is copied.
+//!
+class PlayerView
+{
+ public:
+    //! Constructs the view of \p player.
+    //! \param player The player to view.
+    //! \param isObserver true if the observer is \p player, false if the
+    //! observer is the opponent.
+    PlayerView(const Player* player, bool isObserver);
+
+    //! Returns the type of the player.
+    //! \return The type of the player.
+    PlayerType GetPlayerType() const;
+
+    //! Returns the class of the player.
+    //! \return The class of the player.
+    CardClass GetClass() const;
+
+    //! Returns whether the player controls the current turn.
+    //! \return true if the player controls the current turn, false otherwise.
+    bool IsCurrentPlayer() const;
+
+    //! Returns the total mana of the player.
+    //! \return The total mana of the player.
+    int GetTotalMana() const;
+
+    //! Returns the remaining mana of the player.
+    //! \return The remaining mana of the player.
+    int GetRemainingMana() const;
+
+    //! Returns the overload owed of the player.
+    //! \return The overload owed of the player.
+    int GetOverloadOwed() const;
+
+    //! Returns the overload locked of the player.
+    //! \return The overload locked of the player.
+    int GetOverloadLocked() const;
+
+    //! Returns the hero of the player.
+    //! \return The hero of the player.
+    EntityView GetHero() const;
+
+    //! Returns the hero power of the player.
+    //! \return The hero power of the player.
+    EntityView GetHeroPower() const;
+
+    //! Returns whether the hero of the player has a weapon.
+    //! \return true if the hero has a weapon, false otherwise.
+    bool HasWeapon() const;
+
+    //! Returns the weapon of the player. HasWeapon() must be true.
+    //! \return The weapon of the player.
+    EntityView GetWeapon() const;
+
+    //! Returns the number of minions on the field.
+    //! \return The number of minions on the field.
+    int GetNumMinions() const;
+
+    //! Calls \p func for each minion on the field from left to right.
+    //! \param func The function to call with each minion.
+    void ForEachMinion(
+        const std::function<void(const EntityView&)>& func) const;
+
+    //! Returns the number of cards in hand.
+    //! \return The number of cards in hand.
+    int GetHandCount() const;
+
+    //! Calls \p func for each card in hand in the order of the hand. The card
+    //! is nullptr if the observer can't see it.
+    //! \param func The function to call with each card in hand.
+    void ForEachHandCard(
+        const std::function<void(const EntityView* card)>& func) const;
+
+    //! Returns the number of cards in deck.
+    //! \return The number of cards in deck.
+    int GetDeckCount() const;
+
+    //! Returns the number of secrets.
+    //! \return The number of secrets.
+    int GetSecretCount() const;
+
+    //! Calls \p func for each secret with its class. The secret is nullptr if
+    //! the observer can't see it, so the observer only knows that there is a
+    //! secret of the class.
+    //! \param func The function to call with each secret.
+    void ForEachSecret(
+        const std::function<void(const EntityView* secret, CardClass)>& func)
+        const;
+
+    //! Calls \p func for each card in the play history in the order of play.
+    //! \param func The function to call with each played card.
+    void ForEachPlayedCard(
+        const std::function<void(const PlayedCard&)>& func) const;
+
+ private:
+    //! Returns whether the observer can see \p playable in hand or secrets.
+    //! \param playable The entity in hand or secrets.
+    //! \return true if the observer can see \p playable, false otherwise.
+    bool IsVisible(const Playable* playable) const;
+
+    const Player* m_player = nullptr;
+    bool m_isObserver = false;
+};
+}  // namespace RosettaStone::PlayMode
+
+#endif  // ROSETTASTONE_PLAYMODE_PLAYER_VIEW_HPP
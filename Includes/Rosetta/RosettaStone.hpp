@@ -8,6 +8,9 @@
 #define ROSSETASTONE_ROSETTA_HPP
 
 #include <Rosetta/Battlegrounds/Actions/Generic.hpp>
+#include <Rosetta/Battlegrounds/Agents/Action.hpp>
+#include <Rosetta/Battlegrounds/Agents/IAgent.hpp>
+#include <Rosetta/Battlegrounds/Agents/RandomAgent.hpp>
 #include <Rosetta/Battlegrounds/CardSets/BattlegroundsCardsGen.hpp>
 #include <Rosetta/Battlegrounds/Cards/Card.hpp>
 #include <Rosetta/Battlegrounds/Cards/CardDef.hpp>
@@ -24,8 +27,14 @@
 #include <Rosetta/Battlegrounds/Games/GameState.hpp>
 #include <Rosetta/Battlegrounds/Loaders/CardLoader.hpp>
 #include <Rosetta/Battlegrounds/Loaders/InternalCardLoader.hpp>
+#include <Rosetta/Battlegrounds/Managers/GameEnv.hpp>
 #include <Rosetta/Battlegrounds/Managers/GameManager.hpp>
+#include <Rosetta/Battlegrounds/Managers/GameRunner.hpp>
+#include <Rosetta/Battlegrounds/Managers/VectorEnv.hpp>
+#include <Rosetta/Battlegrounds/Models/BatchCombat.hpp>
 #include <Rosetta/Battlegrounds/Models/Battle.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatCache.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatSimulator.hpp>
 #include <Rosetta/Battlegrounds/Models/Hero.hpp>
 #include <Rosetta/Battlegrounds/Models/Minion.hpp>
 #include <Rosetta/Battlegrounds/Models/MinionPool.hpp>
@@ -63,6 +72,8 @@
 #include <Rosetta/Common/Macros.hpp>
 #include <Rosetta/Common/PriorityQueue.hpp>
 #include <Rosetta/Common/SpinLocks.hpp>
+#include <Rosetta/Common/StartupProfiler.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
 #include <Rosetta/Common/Utils.hpp>
 #include <Rosetta/PlayMode/Actions/Attack.hpp>
 #include <Rosetta/PlayMode/Actions/CastSpell.hpp>
@@ -72,6 +83,7 @@
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
 #include <Rosetta/PlayMode/Actions/PlayCard.hpp>
 #include <Rosetta/PlayMode/Actions/Summon.hpp>
+#include <Rosetta/PlayMode/Agents/Action.hpp>
 #include <Rosetta/PlayMode/Agents/IAgent.hpp>
 #include <Rosetta/PlayMode/Agents/RandomAgent.hpp>
 #include <Rosetta/PlayMode/Auras/AdaptiveCostEffect.hpp>
@@ -117,6 +129,7 @@
 #include <Rosetta/PlayMode/CardSets/VanillaCardsGen.hpp>
 #include <Rosetta/PlayMode/CardSets/YoDCardsGen.hpp>
 #include <Rosetta/PlayMode/Cards/Card.hpp>
+#include <Rosetta/PlayMode/Cards/CardDatabase.hpp>
 #include <Rosetta/PlayMode/Cards/CardDef.hpp>
 #include <Rosetta/PlayMode/Cards/CardDefs.hpp>
 #include <Rosetta/PlayMode/Cards/CardPowers.hpp>
@@ -144,17 +157,32 @@
 #include <Rosetta/PlayMode/Enchants/PlayerAuraEffects.hpp>
 #include <Rosetta/PlayMode/Enchants/Power.hpp>
 #include <Rosetta/PlayMode/Enchants/SwapCostEnchant.hpp>
+#include <Rosetta/PlayMode/Evaluators/BatchEvaluator.hpp>
+#include <Rosetta/PlayMode/Evaluators/HeuristicEvaluator.hpp>
+#include <Rosetta/PlayMode/Evaluators/StubModel.hpp>
+#include <Rosetta/PlayMode/Games/Determinizer.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Games/GameRecord.hpp>
+#include <Rosetta/PlayMode/Games/GameRecorder.hpp>
+#include <Rosetta/PlayMode/Loaders/CardImage.hpp>
 #include <Rosetta/PlayMode/Loaders/CardLoader.hpp>
 #include <Rosetta/PlayMode/Loaders/InternalCardLoader.hpp>
 #include <Rosetta/PlayMode/Loaders/TargetingPredicates.hpp>
 #include <Rosetta/PlayMode/Logs/PlayHistory.hpp>
+#include <Rosetta/PlayMode/Managers/ActionEncoder.hpp>
 #include <Rosetta/PlayMode/Managers/CostManager.hpp>
 #include <Rosetta/PlayMode/Managers/GameManager.hpp>
+#include <Rosetta/PlayMode/Managers/GameRecordReader.hpp>
+#include <Rosetta/PlayMode/Managers/GameRecordWriter.hpp>
+#include <Rosetta/PlayMode/Managers/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Managers/TrajectoryFile.hpp>
+#include <Rosetta/PlayMode/Managers/TrajectoryReader.hpp>
+#include <Rosetta/PlayMode/Managers/TrajectoryWriter.hpp>
 #include <Rosetta/PlayMode/Managers/TriggerEvent.hpp>
 #include <Rosetta/PlayMode/Managers/TriggerEventHandler.hpp>
 #include <Rosetta/PlayMode/Managers/TriggerManager.hpp>
+#include <Rosetta/PlayMode/Managers/VectorEnv.hpp>
 #include <Rosetta/PlayMode/Models/Character.hpp>
 #include <Rosetta/PlayMode/Models/Choice.hpp>
 #include <Rosetta/PlayMode/Models/Enchantment.hpp>
@@ -291,6 +319,9 @@
 #include <Rosetta/PlayMode/Triggers/Trigger.hpp>
 #include <Rosetta/PlayMode/Triggers/Triggers.hpp>
 #include <Rosetta/PlayMode/Utils/DeckCode.hpp>
+#include <Rosetta/PlayMode/Views/EntityView.hpp>
+#include <Rosetta/PlayMode/Views/ObservationView.hpp>
+#include <Rosetta/PlayMode/Views/PlayerView.hpp>
 #include <Rosetta/PlayMode/Zones/DeckZone.hpp>
 #include <Rosetta/PlayMode/Zones/FieldZone.hpp>
 #include <Rosetta/PlayMode/Zones/GraveyardZone.hpp>
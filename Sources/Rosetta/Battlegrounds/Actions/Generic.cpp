@@ -7,11 +7,11 @@
 
 namespace RosettaStone::Battlegrounds::Generic
 {
-void AddEnchantment(Card& enchantmentCard, Minion& target, int num)
+void AddEnchantment(const Card& enchantmentCard, Minion& target, int num)
 {
-    Power& power = enchantmentCard.power;
+    const Power& power = enchantmentCard.power;
 
-    if (auto& enchant = power.GetEnchant(); enchant.has_value())
+    if (const auto& enchant = power.GetEnchant(); enchant.has_value())
     {
         enchant.value().ActivateTo(target, num);
     }
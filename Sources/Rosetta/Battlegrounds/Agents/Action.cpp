@@ -0,0 +1,148 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Agents/Action.hpp>
+#include <Rosetta/Battlegrounds/Models/Player.hpp>
+
+#include <stdexcept>
+
+namespace RosettaStone::Battlegrounds
+{
+bool operator==(const Action& lhs, const Action& rhs)
+{
+    return lhs.type == rhs.type && lhs.index == rhs.index &&
+           lhs.target == rhs.target;
+}
+
+bool operator!=(const Action& lhs, const Action& rhs)
+{
+    return !(lhs == rhs);
+}
+
+std::vector<Action> GetLegalActions(Player& player)
+{
+    std::vector<Action> actions;
+    GetLegalActions(player, actions);
+
+    return actions;
+}
+
+void GetLegalActions(Player& player, std::vector<Action>& actions)
+{
+    actions.clear();
+
+    const int numTavernMinions = player.tavern.fieldZone.GetCount();
+    const int numFieldMinions = player.recruitField.GetCount();
+    const int numHandCards = player.hand.GetCount();
+
+    if (player.remainCoin >= NUM_COIN_PURCHASE_MINION && !player.hand.IsFull())
+    {
+        for (int i = 0; i < numTavernMinions; ++i)
+        {
+            actions.emplace_back(Action{ ActionType::PURCHASE, i, -1 });
+        }
+    }
+
+    for (int i = 0; i < numFieldMinions; ++i)
+    {
+        actions.emplace_back(Action{ ActionType::SELL, i, -1 });
+    }
+
+    if (!player.recruitField.IsFull())
+    {
+        for (int i = 0; i < numHandCards; ++i)
+        {
+            // NOTE: Player::PlayCard() can't cast spells yet, so spells in
+            // hand are excluded instead of being played as no-ops.
+            if (!std::holds_alternative<Minion>(player.hand[i]))
+            {
+                continue;
+            }
+
+            auto& minion = std::get<Minion>(player.hand[i]);
+            if (!minion.IsPlayableByCardReq(player))
+            {
+                continue;
+            }
+
+            for (int target = -1; target < numFieldMinions; ++target)
+            {
+                if (minion.IsValidPlayTarget(player, target))
+                {
+                    actions.emplace_back(
+                        Action{ ActionType::PLAY, i, target });
+                }
+            }
+        }
+    }
+
+    if (player.currentTier < TIER_UPPER_LIMIT &&
+        player.remainCoin >= player.coinToUpgradeTavern)
+    {
+        actions.emplace_back(Action{ ActionType::UPGRADE, -1, -1 });
+    }
+
+    if (player.remainCoin >= NUM_COIN_REFRESH_TAVERN)
+    {
+        actions.emplace_back(Action{ ActionType::REFRESH, -1, -1 });
+    }
+
+    actions.emplace_back(Action{ ActionType::FREEZE, -1, -1 });
+
+    for (int i = 0; i < numFieldMinions; ++i)
+    {
+        for (int j = 0; j < numFieldMinions; ++j)
+        {
+            if (i != j)
+            {
+                actions.emplace_back(Action{ ActionType::REARRANGE, i, j });
+            }
+        }
+    }
+
+    actions.emplace_back(Action{ ActionType::END_TURN, -1, -1 });
+}
+
+void ApplyAction(Player& player, const Action& action)
+{
+    switch (action.type)
+    {
+        case ActionType::PURCHASE:
+            player.PurchaseMinion(static_cast<std::size_t>(action.index));
+            break;
+        case ActionType::SELL:
+            player.SellMinion(static_cast<std::size_t>(action.index));
+            break;
+        case ActionType::PLAY:
+            if (!std::holds_alternative<Minion>(player.hand[action.index]))
+            {
+                throw std::invalid_argument("Spells can't be played");
+            }
+            player.PlayCard(
+                static_cast<std::size_t>(action.index),
+                static_cast<std::size_t>(player.recruitField.GetCount()),
+                action.target);
+            break;
+        case ActionType::UPGRADE:
+            player.UpgradeTavern();
+            break;
+        case ActionType::REFRESH:
+            player.RefreshTavern();
+            break;
+        case ActionType::FREEZE:
+            player.FreezeTavern();
+            break;
+        case ActionType::REARRANGE:
+            player.RearrangeMinion(static_cast<std::size_t>(action.index),
+                                   static_cast<std::size_t>(action.target));
+            break;
+        case ActionType::END_TURN:
+            break;
+        default:
+            throw std::invalid_argument("Invalid action type");
+    }
+}
+}  // namespace RosettaStone::Battlegrounds
@@ -0,0 +1,60 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Agents/RandomAgent.hpp>
+#include <Rosetta/Battlegrounds/Models/Player.hpp>
+
+#include <effolkronium/random.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+using Random = effolkronium::random_thread_local;
+
+namespace RosettaStone::Battlegrounds
+{
+std::size_t RandomAgent::GetActionForSelectHero(
+    [[maybe_unused]] Player& player)
+{
+    return Random::get<std::size_t>(0, NUM_HEROES_ON_SELECTION_LIST - 1);
+}
+
+Action RandomAgent::GetActionForRecruit(
+    [[maybe_unused]] Player& player, const std::vector<Action>& legalActions)
+{
+    if (legalActions.empty())
+    {
+        throw std::invalid_argument("There are no legal actions");
+    }
+
+    // Choose the type of action
+    std::vector<ActionType> types;
+    for (const auto& action : legalActions)
+    {
+        if (std::find(types.begin(), types.end(), action.type) ==
+            types.end())
+        {
+            types.emplace_back(action.type);
+        }
+    }
+
+    const ActionType type =
+        types[Random::get<std::size_t>(0, types.size() - 1)];
+
+    // Choose one of the actions of that type
+    std::vector<std::size_t> candidates;
+    for (std::size_t i = 0; i < legalActions.size(); ++i)
+    {
+        if (legalActions[i].type == type)
+        {
+            candidates.emplace_back(i);
+        }
+    }
+
+    return legalActions[candidates[Random::get<std::size_t>(
+        0, candidates.size() - 1)]];
+}
+}  // namespace RosettaStone::Battlegrounds
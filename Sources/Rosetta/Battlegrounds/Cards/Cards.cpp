@@ -7,22 +7,45 @@
 #include <Rosetta/Battlegrounds/Cards/Cards.hpp>
 #include <Rosetta/Battlegrounds/Loaders/CardLoader.hpp>
 #include <Rosetta/Battlegrounds/Loaders/InternalCardLoader.hpp>
+#include <Rosetta/Common/StartupProfiler.hpp>
 
 namespace RosettaStone::Battlegrounds
 {
+const Card emptyCard{};
+
 std::array<Card, NUM_BATTLEGROUNDS_CARDS> Cards::m_cards;
-std::array<Card, NUM_BATTLEGROUNDS_HEROES> Cards::m_curHeroes;
-std::array<Card, NUM_TIER1_MINIONS> Cards::m_tier1Minions;
-std::array<Card, NUM_TIER2_MINIONS> Cards::m_tier2Minions;
-std::array<Card, NUM_TIER3_MINIONS> Cards::m_tier3Minions;
-std::array<Card, NUM_TIER4_MINIONS> Cards::m_tier4Minions;
-std::array<Card, NUM_TIER5_MINIONS> Cards::m_tier5Minions;
-std::array<Card, NUM_TIER6_MINIONS> Cards::m_tier6Minions;
+std::unordered_map<std::string_view, const Card*> Cards::m_cardsByID;
+std::unordered_map<int, const Card*> Cards::m_cardsByDbfID;
+std::array<const Card*, NUM_BATTLEGROUNDS_HEROES> Cards::m_curHeroes;
+std::array<const Card*, NUM_TIER1_MINIONS> Cards::m_tier1Minions;
+std::array<const Card*, NUM_TIER2_MINIONS> Cards::m_tier2Minions;
+std::array<const Card*, NUM_TIER3_MINIONS> Cards::m_tier3Minions;
+std::array<const Card*, NUM_TIER4_MINIONS> Cards::m_tier4Minions;
+std::array<const Card*, NUM_TIER5_MINIONS> Cards::m_tier5Minions;
+std::array<const Card*, NUM_TIER6_MINIONS> Cards::m_tier6Minions;
 
 Cards::Cards()
 {
-    CardLoader::Load(m_cards);
-    InternalCardLoader::Load(m_cards);
+    StartupProfiler::ScopedPhase phase("Battlegrounds::Cards");
+
+    {
+        StartupProfiler::ScopedPhase loadPhase("CardLoader::Load");
+        CardLoader::Load(m_cards);
+    }
+
+    // NOTE: InternalCardLoader looks up the text of enchantments,
+    // so the indices must be built before it runs.
+    {
+        StartupProfiler::ScopedPhase indexPhase("Build indices");
+        BuildIndices();
+    }
+
+    {
+        StartupProfiler::ScopedPhase loadPhase("InternalCardLoader::Load");
+        InternalCardLoader::Load(m_cards);
+    }
+
+    StartupProfiler::ScopedPhase initPhase("Card::Initialize and card lists");
 
     std::size_t heroIdx = 0;
     std::size_t tier1Idx = 0, tier2Idx = 0, tier3Idx = 0, tier4Idx = 0,
@@ -34,7 +57,7 @@ Cards::Cards()
 
         if (card.GetCardType() == CardType::HERO && card.isCurHero)
         {
-            m_curHeroes.at(heroIdx) = card;
+            m_curHeroes.at(heroIdx) = &card;
             ++heroIdx;
         }
 
@@ -42,38 +65,54 @@ Cards::Cards()
         {
             if (card.GetTier() == 1)
             {
-                m_tier1Minions.at(tier1Idx) = card;
+                m_tier1Minions.at(tier1Idx) = &card;
                 ++tier1Idx;
             }
             else if (card.GetTier() == 2)
             {
-                m_tier2Minions.at(tier2Idx) = card;
+                m_tier2Minions.at(tier2Idx) = &card;
                 ++tier2Idx;
             }
             else if (card.GetTier() == 3)
             {
-                m_tier3Minions.at(tier3Idx) = card;
+                m_tier3Minions.at(tier3Idx) = &card;
                 ++tier3Idx;
             }
             else if (card.GetTier() == 4)
             {
-                m_tier4Minions.at(tier4Idx) = card;
+                m_tier4Minions.at(tier4Idx) = &card;
                 ++tier4Idx;
             }
             else if (card.GetTier() == 5)
             {
-                m_tier5Minions.at(tier5Idx) = card;
+                m_tier5Minions.at(tier5Idx) = &card;
                 ++tier5Idx;
             }
             else if (card.GetTier() == 6)
             {
-                m_tier6Minions.at(tier6Idx) = card;
+                m_tier6Minions.at(tier6Idx) = &card;
                 ++tier6Idx;
             }
         }
     }
 }
 
+void Cards::BuildIndices()
+{
+    m_cardsByID.clear();
+    m_cardsByDbfID.clear();
+    m_cardsByID.reserve(m_cards.size());
+    m_cardsByDbfID.reserve(m_cards.size());
+
+    // NOTE: emplace() keeps the first card if there are duplicates,
+    // which matches the result of a linear search.
+    for (const auto& card : m_cards)
+    {
+        m_cardsByID.emplace(card.id, &card);
+        m_cardsByDbfID.emplace(card.dbfID, &card);
+    }
+}
+
 Cards& Cards::GetInstance()
 {
     static Cards instance;
@@ -85,33 +124,28 @@ const std::array<Card, NUM_BATTLEGROUNDS_CARDS>& Cards::GetAllCards()
     return m_cards;
 }
 
-Card Cards::FindCardByID(const std::string_view& id)
+const Card& Cards::FindCardByID(const std::string_view& id)
 {
-    for (auto& card : m_cards)
+    if (const auto iter = m_cardsByID.find(id); iter != m_cardsByID.end())
     {
-        if (card.id == id)
-        {
-            return card;
-        }
+        return *iter->second;
     }
 
-    return Card{};
+    return emptyCard;
 }
 
-Card Cards::FindCardByDbfID(int dbfID)
+const Card& Cards::FindCardByDbfID(int dbfID)
 {
-    for (auto& card : m_cards)
+    if (const auto iter = m_cardsByDbfID.find(dbfID);
+        iter != m_cardsByDbfID.end())
     {
-        if (card.dbfID == dbfID)
-        {
-            return card;
-        }
+        return *iter->second;
     }
 
-    return Card{};
+    return emptyCard;
 }
 
-Card Cards::FindCardByName(const std::string_view& name)
+const Card& Cards::FindCardByName(const std::string_view& name)
 {
     for (auto& card : m_cards)
     {
@@ -123,40 +157,41 @@ Card Cards::FindCardByName(const std::string_view& name)
         }
     }
 
-    return Card{};
+    return emptyCard;
 }
 
-const std::array<Card, NUM_BATTLEGROUNDS_HEROES>& Cards::GetCurrentHeroes()
+const std::array<const Card*, NUM_BATTLEGROUNDS_HEROES>&
+Cards::GetCurrentHeroes()
 {
     return m_curHeroes;
 }
 
-const std::array<Card, NUM_TIER1_MINIONS>& Cards::GetTier1Minions()
+const std::array<const Card*, NUM_TIER1_MINIONS>& Cards::GetTier1Minions()
 {
     return m_tier1Minions;
 }
 
-const std::array<Card, NUM_TIER2_MINIONS>& Cards::GetTier2Minions()
+const std::array<const Card*, NUM_TIER2_MINIONS>& Cards::GetTier2Minions()
 {
     return m_tier2Minions;
 }
 
-const std::array<Card, NUM_TIER3_MINIONS>& Cards::GetTier3Minions()
+const std::array<const Card*, NUM_TIER3_MINIONS>& Cards::GetTier3Minions()
 {
     return m_tier3Minions;
 }
 
-const std::array<Card, NUM_TIER4_MINIONS>& Cards::GetTier4Minions()
+const std::array<const Card*, NUM_TIER4_MINIONS>& Cards::GetTier4Minions()
 {
     return m_tier4Minions;
 }
 
-const std::array<Card, NUM_TIER5_MINIONS>& Cards::GetTier5Minions()
+const std::array<const Card*, NUM_TIER5_MINIONS>& Cards::GetTier5Minions()
 {
     return m_tier5Minions;
 }
 
-const std::array<Card, NUM_TIER6_MINIONS>& Cards::GetTier6Minions()
+const std::array<const Card*, NUM_TIER6_MINIONS>& Cards::GetTier6Minions()
 {
     return m_tier6Minions;
 }
@@ -20,11 +20,11 @@ Enchant::Enchant(std::vector<Effect> effects, bool useScriptTag)
     // Do nothing
 }
 
-void Enchant::ActivateTo(Minion& minion, int num)
+void Enchant::ActivateTo(Minion& minion, int num) const
 {
     if (!m_useScriptTag)
     {
-        for (auto& effect : m_effects)
+        for (const auto& effect : m_effects)
         {
             effect.ApplyTo(minion);
         }
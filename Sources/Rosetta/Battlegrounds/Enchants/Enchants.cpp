@@ -18,8 +18,8 @@ Enchant Enchants::GetEnchantFromText(const std::string& cardID)
     static std::regex attackHealthRegex(
         R"(([\+\-][[:digit:]]+)/([\+\-][[:digit:]]+))");
 
-    const auto card = Cards::FindCardByID(cardID);
-    const std::string text = card.text;
+    const Card& card = Cards::FindCardByID(cardID);
+    const std::string& text = card.text;
     std::smatch values;
 
     if (std::regex_search(text, values, attackHealthRegex))
@@ -11,10 +11,70 @@
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+#include <limits>
+
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::Battlegrounds
 {
+std::unique_ptr<Game> Game::Clone() const
+{
+    auto game = std::make_unique<Game>();
+    game->Restore(Snapshot());
+
+    return game;
+}
+
+GameSnapshot Game::Snapshot() const
+{
+    GameSnapshot snapshot;
+    snapshot.gameState = m_gameState;
+    snapshot.excludeRace = m_excludeRace;
+    snapshot.playerFightPair = m_playerFightPair;
+    snapshot.playerCount = m_playerCount;
+    snapshot.cardIndex = m_cardIndex;
+
+    return snapshot;
+}
+
+void Game::Restore(const GameSnapshot& snapshot)
+{
+    m_gameState = snapshot.gameState;
+    m_excludeRace = snapshot.excludeRace;
+    m_playerFightPair = snapshot.playerFightPair;
+    m_playerCount = snapshot.playerCount;
+    m_cardIndex = snapshot.cardIndex;
+
+    // NOTE: The copied players and minions still refer to the players of the
+    // game that the snapshot is taken from, so they must be rebound.
+    for (auto& player : m_gameState.players)
+    {
+        player.game = this;
+        player.battle = nullptr;
+        player.taskStack.Reset();
+
+        auto rebind = [&](Minion& minion) {
+            if (minion.owner != nullptr)
+            {
+                minion.owner = &player;
+            }
+        };
+
+        player.tavern.fieldZone.ForEach(
+            [&](MinionData& minion) { rebind(minion.value()); });
+        player.recruitField.ForEach(
+            [&](MinionData& minion) { rebind(minion.value()); });
+        player.battleField.ForEach(
+            [&](MinionData& minion) { rebind(minion.value()); });
+        player.hand.ForEach([&](std::optional<CardData>& card) {
+            if (std::holds_alternative<Minion>(card.value()))
+            {
+                rebind(std::get<Minion>(card.value()));
+            }
+        });
+    }
+}
+
 GameState& Game::GetGameState()
 {
     return m_gameState;
@@ -31,122 +91,9 @@ void Game::Start()
     m_gameState.minionPool.Initialize(m_excludeRace);
     m_playerFightPair.reserve(NUM_BATTLEGROUNDS_PLAYERS / 2);
 
-    // Create callback to increase player count and process next phase
-    auto selectHeroCallback = [this](Player& player) {
-        ++m_playerCount;
-
-        player.hero.health = player.hero.card.GetHealth();
-
-        if (m_playerCount >= NUM_BATTLEGROUNDS_PLAYERS)
-        {
-            // Set next phase
-            m_gameState.nextPhase = Phase::RECRUIT;
-            GameManager::ProcessNextPhase(*this, m_gameState.nextPhase);
-        }
-    };
-
-    // Create callback to prepare a list of minions for purchase
-    auto prepareTavernMinionsCallback = [this](Player& player) {
-        m_gameState.minionPool.AddMinionsToTavern(player, player.tavern);
-    };
-
-    // Create callback to purchase a minion in Tavern
-    auto purchaseMinionCallback = [](Player& player, std::size_t tavernIdx) {
-        Minion minion =
-            player.tavern.fieldZone.Remove(player.tavern.fieldZone[tavernIdx]);
-        player.hand.Add(minion, -1);
-    };
-
-    // Create callback to get next card index
-    auto getNextCardIndexCallback = [this]() -> int { return m_cardIndex++; };
-
-    // Create callback to return a minion to the minion pool
-    auto returnMinionCallback = [this](int poolIdx) {
-        m_gameState.minionPool.ReturnMinion(poolIdx);
-    };
-
-    // Create callback to clear a list of minions in Tavern's field
-    auto clearTavernMinionsCallback = [this](Player& player) {
-        while (!player.tavern.fieldZone.IsEmpty())
-        {
-            Minion minion =
-                player.tavern.fieldZone.Remove(player.tavern.fieldZone[0]);
-            m_gameState.minionPool.ReturnMinion(minion.GetPoolIndex());
-        }
-    };
-
-    // Create callback to upgrade player's Tavern to the next tier
-    auto upgradeTavernCallback = [](Player& player) {
-        ++player.currentTier;
-
-        // Set the value of coin to upgrade player's Tavern to the next tier
-        switch (player.currentTier)
-        {
-            case 2:
-                player.coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_3;
-                break;
-            case 3:
-                player.coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_4;
-                break;
-            case 4:
-                player.coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_5;
-                break;
-            case 5:
-                player.coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_6;
-                break;
-            default:
-                throw std::logic_error("Invalid player's current tier");
-        }
-    };
-
-    // Create callback to complete recruit and process next phase
-    auto completeRecruitCallback = [this]() {
-        ++m_playerCount;
-
-        if (m_playerCount >= NUM_BATTLEGROUNDS_PLAYERS)
-        {
-            // Set next phase
-            m_gameState.nextPhase = Phase::COMBAT;
-            GameManager::ProcessNextPhase(*this, m_gameState.nextPhase);
-        }
-    };
-
-    // Create callback to get opponent player
-    auto getOpponentPlayerCallback = [this](Player& player) -> Player& {
-        const std::size_t idx = FindPlayerNextFight(player.idx);
-        return m_gameState.players[idx];
-    };
-
-    // Create callback to process the tasks related to defeat
-    auto processDefeatCallback = [this](Player& player) {
-        player.playState = PlayState::LOST;
-
-        // Determine player's rank
-        player.rank = m_gameState.numRemainPlayer;
-        --m_gameState.numRemainPlayer;
-
-        player.tavern.fieldZone.ForEach([&](MinionData& minion) {
-            m_gameState.minionPool.ReturnMinion(minion.value().GetPoolIndex());
-        });
-
-        player.hand.ForEach([&](std::optional<CardData>& card) {
-            if (std::holds_alternative<Minion>(card.value()))
-            {
-                const auto minion = std::get<Minion>(card.value());
-                m_gameState.minionPool.ReturnMinion(minion.GetPoolIndex());
-            }
-        });
-
-        player.recruitField.ForEach([&](MinionData& minion) {
-            m_gameState.minionPool.ReturnMinion(minion.value().GetPoolIndex());
-        });
-
-        m_gameState.ghostPlayerIdx = player.idx;
-    };
-
     std::size_t playerIdx = 0;
 
-    // Initialize variables and callbacks
+    // Initialize variables
     for (auto& player : m_gameState.players)
     {
         player.playState = PlayState::PLAYING;
@@ -157,16 +104,7 @@ void Game::Start()
         player.currentTier = 1;
         player.coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_2 + 1;
 
-        player.selectHeroCallback = selectHeroCallback;
-        player.prepareTavernMinionsCallback = prepareTavernMinionsCallback;
-        player.purchaseMinionCallback = purchaseMinionCallback;
-        player.getNextCardIndexCallback = getNextCardIndexCallback;
-        player.returnMinionCallback = returnMinionCallback;
-        player.clearTavernMinionsCallback = clearTavernMinionsCallback;
-        player.upgradeTavernCallback = upgradeTavernCallback;
-        player.completeRecruitCallback = completeRecruitCallback;
-        player.getOpponentPlayerCallback = getOpponentPlayerCallback;
-        player.processDefeatCallback = processDefeatCallback;
+        player.game = this;
 
         ++playerIdx;
     }
@@ -188,7 +126,7 @@ void Game::SelectHero()
     {
         for (std::size_t i = 0; i < NUM_HEROES_ON_SELECTION_LIST; ++i)
         {
-            player.heroChoices.at(i) = currentHeroes.at(heroIdx + i).dbfID;
+            player.heroChoices.at(i) = currentHeroes.at(heroIdx + i)->dbfID;
         }
 
         heroIdx += NUM_HEROES_ON_SELECTION_LIST;
@@ -219,8 +157,8 @@ void Game::Recruit()
             continue;
         }
 
-        // Set the flag
-        player.isInCombat = true;
+        // Reset the flag
+        player.isInCombat = false;
 
         // Assign the index of the player to fight next.
         player.playerIdxNextFight = FindPlayerNextFight(player.idx);
@@ -241,12 +179,7 @@ void Game::Recruit()
         if (!player.freezeTavern)
         {
             // Clear a list of minions in Tavern
-            while (!player.tavern.fieldZone.IsEmpty())
-            {
-                Minion minion =
-                    player.tavern.fieldZone.Remove(player.tavern.fieldZone[0]);
-                m_gameState.minionPool.ReturnMinion(minion.GetPoolIndex());
-            }
+            player.ClearTavern();
 
             // Prepare a list of minions to each player for purchase
             player.PrepareTavern();
@@ -264,26 +197,151 @@ void Game::Combat()
         player.isInCombat = true;
     }
 
-    // Simulates a battle for each pair
+    const std::size_t numBattles = m_playerFightPair.size();
+
+    std::vector<std::unique_ptr<Battle>> battles;
+    std::vector<unsigned int> seeds;
+    battles.reserve(numBattles);
+    seeds.reserve(numBattles);
+
     for (const auto& pair : m_playerFightPair)
     {
         Player& player1 = m_gameState.players.at(std::get<0>(pair));
         Player& player2 = m_gameState.players.at(std::get<1>(pair));
 
-        Battle battle(player1, player2);
+        battles.emplace_back(std::make_unique<Battle>(player1, player2));
+        seeds.emplace_back(Random::get<unsigned int>(
+            0, std::numeric_limits<unsigned int>::max()));
+    }
+
+    // NOTE: Battles share the random engine of the thread that runs them.
+    // The engine of this thread is reseeded after battles, so the rest of the
+    // game doesn't depend on which thread ran which battle.
+    const auto nextSeed =
+        Random::get<unsigned int>(0, std::numeric_limits<unsigned int>::max());
+
+    // Simulates a battle for each pair
+    // NOTE: The pairs don't share any player, so battles can run in parallel.
+    auto simulate = [&](std::size_t idx) {
+        Battle::Seed(seeds[idx]);
+        battles[idx]->Simulate();
+    };
 
-        // Create callback to get battle
-        player1.getBattleCallback = [&]() -> Battle& { return battle; };
-        player2.getBattleCallback = [&]() -> Battle& { return battle; };
+    if (m_numCombatThreads != 1 && numBattles > 1)
+    {
+        if (!m_combatPool)
+        {
+            m_combatPool = std::make_unique<ThreadPool>(m_numCombatThreads);
+        }
 
-        battle.Run();
+        m_combatPool->ParallelFor(numBattles, simulate);
     }
+    else
+    {
+        for (std::size_t idx = 0; idx < numBattles; ++idx)
+        {
+            simulate(idx);
+        }
+    }
+
+    Random::seed(nextSeed);
+
+    // NOTE: Damage is dealt in the order of pairs because processing defeat
+    // changes the game state.
+    for (std::size_t idx = 0; idx < numBattles; ++idx)
+    {
+        battles[idx]->DealDamage();
+    }
+
+    // Battles are destroyed at the end of this phase
+    battles.clear();
 
     // Set next phase
     m_gameState.nextPhase = Phase::RECRUIT;
     GameManager::ProcessNextPhase(*this, m_gameState.nextPhase);
 }
 
+void Game::SetNumCombatThreads(std::size_t numThreads)
+{
+    if (m_numCombatThreads != numThreads)
+    {
+        m_numCombatThreads = numThreads;
+        m_combatPool.reset();
+    }
+}
+
+std::size_t Game::GetNumCombatThreads() const
+{
+    return m_numCombatThreads;
+}
+
+void Game::ProcessSelectHero()
+{
+    ++m_playerCount;
+
+    if (m_playerCount >= NUM_BATTLEGROUNDS_PLAYERS)
+    {
+        // Set next phase
+        m_gameState.nextPhase = Phase::RECRUIT;
+        GameManager::ProcessNextPhase(*this, m_gameState.nextPhase);
+    }
+}
+
+void Game::ProcessCompleteRecruit()
+{
+    ++m_playerCount;
+
+    if (m_playerCount >= NUM_BATTLEGROUNDS_PLAYERS)
+    {
+        // Set next phase
+        m_gameState.nextPhase = Phase::COMBAT;
+        GameManager::ProcessNextPhase(*this, m_gameState.nextPhase);
+    }
+}
+
+void Game::ProcessDefeat(Player& player)
+{
+    // NOTE: The ghost can take damage again after it is defeated.
+    if (player.playState != PlayState::PLAYING)
+    {
+        return;
+    }
+
+    player.playState = PlayState::LOST;
+
+    // Determine player's rank
+    player.rank = m_gameState.numRemainPlayer;
+    --m_gameState.numRemainPlayer;
+
+    player.tavern.fieldZone.ForEach([&](MinionData& minion) {
+        m_gameState.minionPool.ReturnMinion(minion.value().GetPoolIndex());
+    });
+
+    player.hand.ForEach([&](std::optional<CardData>& card) {
+        if (std::holds_alternative<Minion>(card.value()))
+        {
+            const auto minion = std::get<Minion>(card.value());
+            m_gameState.minionPool.ReturnMinion(minion.GetPoolIndex());
+        }
+    });
+
+    player.recruitField.ForEach([&](MinionData& minion) {
+        m_gameState.minionPool.ReturnMinion(minion.value().GetPoolIndex());
+    });
+
+    m_gameState.ghostPlayerIdx = player.idx;
+}
+
+int Game::GetNextCardIndex()
+{
+    return m_cardIndex++;
+}
+
+Player& Game::GetOpponentPlayer(const Player& player)
+{
+    return m_gameState.players[FindPlayerNextFight(player.idx)];
+}
+
 void Game::GameOver()
 {
     m_gameState.phase = Phase::COMPLETE;
@@ -306,11 +364,21 @@ void Game::DetermineOpponent()
         m_playerFightPair.emplace_back(
             std::make_tuple(playerIdx, m_gameState.ghostPlayerIdx));
 
+        for (auto& player : m_gameState.players)
+        {
+            player.isFoughtGhostLastTurn = player.idx == playerIdx;
+        }
+
         // Pair a list of players
         PairPlayers(playerData);
     }
     else
     {
+        for (auto& player : m_gameState.players)
+        {
+            player.isFoughtGhostLastTurn = false;
+        }
+
         // Pair a list of players
         PairPlayers(playerData);
     }
@@ -344,32 +412,47 @@ std::size_t Game::DeterminePlayerToFightGhost(
     std::vector<std::tuple<int, int>>& playerData)
 {
     // Bottom 3 have a chance to play the ghost
-    std::vector<int> ghostCandidates;
+    const std::size_t begin =
+        playerData.size() > 3 ? playerData.size() - 3 : 0;
+    std::vector<std::size_t> ghostCandidates;
 
-    for (std::size_t i = playerData.size() - 3; i < playerData.size(); ++i)
+    for (std::size_t i = begin; i < playerData.size(); ++i)
     {
+        const auto playerIdx =
+            static_cast<std::size_t>(std::get<0>(playerData[i]));
+
         // Can't fight a ghost 2 turns in a row
-        if (m_gameState.players.at(i).isFoughtGhostLastTurn)
+        if (m_gameState.players.at(playerIdx).isFoughtGhostLastTurn)
         {
             continue;
         }
 
-        ghostCandidates.emplace_back(i);
+        ghostCandidates.emplace_back(playerIdx);
+    }
+
+    // NOTE: If all of them fought the ghost last turn, one of them fights the
+    // ghost again because someone must fight it.
+    if (ghostCandidates.empty())
+    {
+        for (std::size_t i = begin; i < playerData.size(); ++i)
+        {
+            ghostCandidates.emplace_back(std::get<0>(playerData[i]));
+        }
     }
 
     // Fight randomly selected player and the ghost
-    const std::size_t idx =
-        Random::get<std::size_t>(0, ghostCandidates.size() - 1);
+    const std::size_t playerIdx = ghostCandidates.at(
+        Random::get<std::size_t>(0, ghostCandidates.size() - 1));
 
     // Remove the index of randomly selected player from player data
     playerData.erase(std::remove_if(playerData.begin(), playerData.end(),
                                     [&](std::tuple<int, int> data) {
                                         return std::get<0>(data) ==
-                                               static_cast<int>(idx);
+                                               static_cast<int>(playerIdx);
                                     }),
                      playerData.end());
 
-    return idx;
+    return playerIdx;
 }
 
 void Game::SetPlayerPair(int player1Idx, int player2Idx)
@@ -5,6 +5,7 @@
 // property of any third parties.
 
 #include <Rosetta/Battlegrounds/Loaders/CardLoader.hpp>
+#include <Rosetta/Common/StartupProfiler.hpp>
 
 #include <fstream>
 
@@ -21,7 +22,10 @@ void CardLoader::Load(std::array<Card, NUM_BATTLEGROUNDS_CARDS>& cards)
         throw std::runtime_error("Can't open cards.json");
     }
 
-    cardFile >> j;
+    {
+        StartupProfiler::ScopedPhase phase("JSON parse");
+        cardFile >> j;
+    }
 
     std::size_t idx = 0;
 
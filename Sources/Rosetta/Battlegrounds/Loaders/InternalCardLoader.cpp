@@ -5,12 +5,18 @@
 // property of any third parties.
 
 #include <Rosetta/Battlegrounds/Cards/CardDefs.hpp>
+#include <Rosetta/Common/StartupProfiler.hpp>
 #include <Rosetta/Battlegrounds/Loaders/InternalCardLoader.hpp>
 
 namespace RosettaStone::Battlegrounds
 {
 void InternalCardLoader::Load(std::array<Card, NUM_BATTLEGROUNDS_CARDS>& cards)
 {
+    {
+        StartupProfiler::ScopedPhase phase("CardDefs");
+        CardDefs::GetInstance();
+    }
+
     for (auto& card : cards)
     {
         const auto cardDef = CardDefs::GetInstance().FindCardDefByID(card.id);
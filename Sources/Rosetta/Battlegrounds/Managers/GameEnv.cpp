@@ -0,0 +1,385 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Managers/GameEnv.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatSimulator.hpp>
+
+#include <effolkronium/random.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+using Random = effolkronium::random_thread_local;
+
+namespace RosettaStone::Battlegrounds
+{
+namespace
+{
+//! Writes the features of the minion to \p features.
+void WriteMinion(const Minion& minion, float* features)
+{
+    features[0] = 1.0f;
+    features[1] = static_cast<float>(minion.GetCard().dbfID);
+    features[2] = static_cast<float>(minion.GetAttack());
+    features[3] = static_cast<float>(minion.GetHealth());
+    features[4] = static_cast<float>(minion.GetTier());
+    features[5] = minion.HasTaunt() ? 1.0f : 0.0f;
+    features[6] = minion.HasDivineShield() ? 1.0f : 0.0f;
+}
+
+//! Writes the features of minions on \p fieldZone to \p features.
+void WriteField(const FieldZone& fieldZone, float* features)
+{
+    fieldZone.ForEach([&](const MinionData& minion) {
+        WriteMinion(minion.value(), features);
+        features += GameEnv::NUM_CARD_FEATURES;
+    });
+}
+}  // namespace
+
+std::size_t GameEnv::EncodeAction(const Action& action)
+{
+    const auto index = static_cast<std::size_t>(action.index);
+
+    // NOTE: The target of PLAY starts from -1 (no target).
+    const auto playTarget = static_cast<std::size_t>(action.target + 1);
+    const auto newIndex = static_cast<std::size_t>(action.target);
+
+    switch (action.type)
+    {
+        case ActionType::PURCHASE:
+            return PURCHASE_OFFSET + index;
+        case ActionType::SELL:
+            return SELL_OFFSET + index;
+        case ActionType::PLAY:
+            return PLAY_OFFSET + index * NUM_PLAY_TARGETS + playTarget;
+        case ActionType::UPGRADE:
+            return UPGRADE_INDEX;
+        case ActionType::REFRESH:
+            return REFRESH_INDEX;
+        case ActionType::FREEZE:
+            return FREEZE_INDEX;
+        case ActionType::REARRANGE:
+            return REARRANGE_OFFSET + index * MAX_FIELD_SIZE + newIndex;
+        case ActionType::END_TURN:
+            return END_TURN_INDEX;
+        default:
+            throw std::invalid_argument("Invalid action type");
+    }
+}
+
+Action GameEnv::DecodeAction(std::size_t actionIdx)
+{
+    if (actionIdx < SELL_OFFSET)
+    {
+        return Action{ ActionType::PURCHASE,
+                       static_cast<int>(actionIdx - PURCHASE_OFFSET), -1 };
+    }
+    if (actionIdx < PLAY_OFFSET)
+    {
+        return Action{ ActionType::SELL,
+                       static_cast<int>(actionIdx - SELL_OFFSET), -1 };
+    }
+    if (actionIdx < UPGRADE_INDEX)
+    {
+        const std::size_t idx = actionIdx - PLAY_OFFSET;
+        return Action{ ActionType::PLAY,
+                       static_cast<int>(idx / NUM_PLAY_TARGETS),
+                       static_cast<int>(idx % NUM_PLAY_TARGETS) - 1 };
+    }
+    if (actionIdx == UPGRADE_INDEX)
+    {
+        return Action{ ActionType::UPGRADE, -1, -1 };
+    }
+    if (actionIdx == REFRESH_INDEX)
+    {
+        return Action{ ActionType::REFRESH, -1, -1 };
+    }
+    if (actionIdx == FREEZE_INDEX)
+    {
+        return Action{ ActionType::FREEZE, -1, -1 };
+    }
+    if (actionIdx < END_TURN_INDEX)
+    {
+        const std::size_t idx = actionIdx - REARRANGE_OFFSET;
+        return Action{ ActionType::REARRANGE,
+                       static_cast<int>(idx / MAX_FIELD_SIZE),
+                       static_cast<int>(idx % MAX_FIELD_SIZE) };
+    }
+    if (actionIdx == END_TURN_INDEX)
+    {
+        return Action{ ActionType::END_TURN, -1, -1 };
+    }
+
+    throw std::out_of_range("Invalid action index");
+}
+
+void GameEnv::SetMaxTurns(std::size_t maxTurns)
+{
+    m_maxTurns = maxTurns;
+}
+
+void GameEnv::SetMaxActionsPerTurn(std::size_t maxActions)
+{
+    m_maxActionsPerTurn = maxActions;
+}
+
+void GameEnv::Reset(unsigned int seed)
+{
+    m_seed = seed;
+    m_numSteps = 0;
+    m_numTurns = 0;
+    m_isDone = false;
+    m_isTruncated = false;
+
+    SeedNextStep();
+
+    m_game = std::make_unique<Game>();
+    m_game->Start();
+
+    for (auto& player : m_game->GetGameState().players)
+    {
+        player.SelectHero(
+            Random::get<std::size_t>(0, NUM_HEROES_ON_SELECTION_LIST - 1));
+    }
+
+    StartRecruit();
+}
+
+std::vector<Action> GameEnv::GetLegalActions()
+{
+    UpdateLegalActions();
+
+    return m_legalActions;
+}
+
+void GameEnv::WriteLegalMask(std::uint8_t* mask)
+{
+    std::fill(mask, mask + NUM_ACTIONS, 0);
+
+    UpdateLegalActions();
+    for (const auto& action : m_legalActions)
+    {
+        mask[EncodeAction(action)] = 1;
+    }
+}
+
+bool GameEnv::Step(const Action& action)
+{
+    if (m_isDone)
+    {
+        throw std::logic_error("The episode is done");
+    }
+
+    UpdateLegalActions();
+    if (std::find(m_legalActions.begin(), m_legalActions.end(), action) ==
+        m_legalActions.end())
+    {
+        throw std::invalid_argument("Illegal action");
+    }
+
+    SeedNextStep();
+
+    if (action.type == ActionType::END_TURN)
+    {
+        EndTurn();
+        return m_isDone;
+    }
+
+    ApplyAction(GetCurrentPlayer(), action);
+
+    ++m_numActions;
+    if (m_numActions >= m_maxActionsPerTurn)
+    {
+        EndTurn();
+    }
+
+    return m_isDone;
+}
+
+bool GameEnv::AdvancePhase()
+{
+    if (m_isDone)
+    {
+        throw std::logic_error("The episode is done");
+    }
+
+    SeedNextStep();
+
+    const std::size_t numTurns = m_numTurns;
+    while (!m_isDone && m_numTurns == numTurns)
+    {
+        EndTurn();
+    }
+
+    return m_isDone;
+}
+
+void GameEnv::WriteObservation(std::size_t seatIdx, float* observation) const
+{
+    std::fill(observation, observation + NUM_OBSERVATIONS, 0.0f);
+
+    const GameState& gameState = m_game->GetGameState();
+    const Player& player = gameState.players.at(seatIdx);
+
+    observation[0] = static_cast<float>(player.hero.health);
+    observation[1] = static_cast<float>(player.remainCoin);
+    observation[2] = static_cast<float>(player.totalCoin);
+    observation[3] = static_cast<float>(player.currentTier);
+    observation[4] = static_cast<float>(player.coinToUpgradeTavern);
+    observation[5] = player.freezeTavern ? 1.0f : 0.0f;
+    observation[6] = static_cast<float>(gameState.numRemainPlayer);
+    observation[7] = static_cast<float>(m_numTurns);
+
+    if (player.playerIdxNextFight < gameState.players.size())
+    {
+        const Player& opponent = gameState.players[player.playerIdxNextFight];
+        observation[8] = static_cast<float>(opponent.hero.health);
+        observation[9] = static_cast<float>(opponent.currentTier);
+    }
+
+    float* cards = observation + NUM_PLAYER_FEATURES;
+    WriteField(player.recruitField, cards);
+    cards += MAX_FIELD_SIZE * NUM_CARD_FEATURES;
+    WriteField(player.tavern.fieldZone, cards);
+    cards += MAX_FIELD_SIZE * NUM_CARD_FEATURES;
+
+    player.hand.ForEach([&](const std::optional<CardData>& card) {
+        if (std::holds_alternative<Minion>(card.value()))
+        {
+            WriteMinion(std::get<Minion>(card.value()), cards);
+        }
+        else
+        {
+            cards[0] = 2.0f;
+        }
+
+        cards += NUM_CARD_FEATURES;
+    });
+}
+
+float GameEnv::GetReward(std::size_t seatIdx) const
+{
+    if (!m_isDone || m_isTruncated)
+    {
+        return 0.0f;
+    }
+
+    const auto rank = static_cast<float>(
+        m_game->GetGameState().players.at(seatIdx).rank);
+
+    return (NUM_BATTLEGROUNDS_PLAYERS + 1 - 2.0f * rank) /
+           (NUM_BATTLEGROUNDS_PLAYERS - 1);
+}
+
+std::size_t GameEnv::GetCurrentPlayerIdx() const
+{
+    return m_currentPlayerIdx;
+}
+
+std::size_t GameEnv::GetNumTurns() const
+{
+    return m_numTurns;
+}
+
+bool GameEnv::IsDone() const
+{
+    return m_isDone;
+}
+
+bool GameEnv::IsTruncated() const
+{
+    return m_isTruncated;
+}
+
+Game& GameEnv::GetGame()
+{
+    return *m_game;
+}
+
+void GameEnv::SeedNextStep()
+{
+    // NOTE: Seeds of steps are derived in the same way as the seeds of
+    // combat samples.
+    Random::seed(CombatSimulator::GetSampleSeed(m_seed, m_numSteps));
+    ++m_numSteps;
+}
+
+void GameEnv::EndTurn()
+{
+    auto& players = m_game->GetGameState().players;
+
+    for (std::size_t idx = m_currentPlayerIdx + 1; idx < players.size(); ++idx)
+    {
+        if (players[idx].playState == PlayState::PLAYING)
+        {
+            m_currentPlayerIdx = idx;
+            m_numActions = 0;
+            return;
+        }
+    }
+
+    // Combat phase starts when the last player completes recruit
+    // NOTE: Defeated players also complete recruit to be counted.
+    for (auto& player : players)
+    {
+        player.CompleteRecruit();
+    }
+
+    StartRecruit();
+}
+
+void GameEnv::StartRecruit()
+{
+    GameState& gameState = m_game->GetGameState();
+
+    if (gameState.phase == Phase::COMPLETE)
+    {
+        m_isDone = true;
+        return;
+    }
+
+    if (m_numTurns == m_maxTurns)
+    {
+        m_isDone = true;
+        m_isTruncated = true;
+        return;
+    }
+
+    ++m_numTurns;
+    m_numActions = 0;
+
+    for (const auto& player : gameState.players)
+    {
+        if (player.playState == PlayState::PLAYING)
+        {
+            m_currentPlayerIdx = player.idx;
+            return;
+        }
+    }
+}
+
+void GameEnv::UpdateLegalActions()
+{
+    if (m_isDone)
+    {
+        m_legalActions.clear();
+        return;
+    }
+
+    Battlegrounds::GetLegalActions(GetCurrentPlayer(), m_legalActions);
+}
+
+Player& GameEnv::GetCurrentPlayer()
+{
+    return m_game->GetGameState().players[m_currentPlayerIdx];
+}
+
+const Player& GameEnv::GetCurrentPlayer() const
+{
+    return m_game->GetGameState().players[m_currentPlayerIdx];
+}
+}  // namespace RosettaStone::Battlegrounds
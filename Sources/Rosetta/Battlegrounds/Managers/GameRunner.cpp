@@ -0,0 +1,208 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Managers/GameRunner.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatSimulator.hpp>
+
+#include <effolkronium/random.hpp>
+
+#include <chrono>
+#include <utility>
+
+using Random = effolkronium::random_thread_local;
+
+namespace RosettaStone::Battlegrounds
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double GetElapsedSec(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+}  // namespace
+
+double GameStats::GetGamesPerSecond() const
+{
+    return elapsedSec > 0.0 ? static_cast<double>(numGames) / elapsedSec
+                            : 0.0;
+}
+
+double GameStats::GetAveragePlacement(std::size_t seatIdx) const
+{
+    std::size_t count = 0;
+    std::size_t sum = 0;
+
+    for (std::size_t i = 0; i < placements.at(seatIdx).size(); ++i)
+    {
+        count += placements[seatIdx][i];
+        sum += placements[seatIdx][i] * (i + 1);
+    }
+
+    return count > 0 ? static_cast<double>(sum) / static_cast<double>(count)
+                     : 0.0;
+}
+
+void GameStats::Merge(const GameStats& other)
+{
+    numGames += other.numGames;
+    numTruncatedGames += other.numTruncatedGames;
+    numTurns += other.numTurns;
+    numActions += other.numActions;
+
+    elapsedSec += other.elapsedSec;
+    selectHeroSec += other.selectHeroSec;
+    recruitSec += other.recruitSec;
+    combatSec += other.combatSec;
+
+    for (std::size_t i = 0; i < placements.size(); ++i)
+    {
+        for (std::size_t j = 0; j < placements[i].size(); ++j)
+        {
+            placements[i][j] += other.placements[i][j];
+        }
+    }
+}
+
+GameRunner::GameRunner(AgentFactory agentFactory, std::size_t numThreads)
+    : m_agentFactory(std::move(agentFactory)), m_pool(numThreads)
+{
+    // Do nothing
+}
+
+void GameRunner::SetMaxTurns(std::size_t maxTurns)
+{
+    m_maxTurns = maxTurns;
+}
+
+void GameRunner::SetMaxActionsPerTurn(std::size_t maxActions)
+{
+    m_maxActionsPerTurn = maxActions;
+}
+
+GameStats GameRunner::Run(std::size_t numGames, unsigned int seed)
+{
+    std::vector<GameStats> gameStats(numGames);
+
+    auto play = [&](std::size_t idx) {
+        // NOTE: Seeds of games are derived in the same way as the seeds of
+        // combat samples.
+        Random::seed(CombatSimulator::GetSampleSeed(seed, idx));
+
+        std::array<std::unique_ptr<IAgent>, NUM_BATTLEGROUNDS_PLAYERS> agents;
+        std::array<IAgent*, NUM_BATTLEGROUNDS_PLAYERS> agentPtrs{};
+        for (std::size_t i = 0; i < agents.size(); ++i)
+        {
+            agents[i] = m_agentFactory(i);
+            agentPtrs[i] = agents[i].get();
+        }
+
+        const auto game = std::make_unique<Game>();
+
+        Play(*game, agentPtrs, gameStats[idx]);
+    };
+
+    const auto start = Clock::now();
+
+    if (m_pool.GetNumThreads() > 1)
+    {
+        m_pool.ParallelFor(numGames, play);
+    }
+    else
+    {
+        for (std::size_t idx = 0; idx < numGames; ++idx)
+        {
+            play(idx);
+        }
+    }
+
+    GameStats stats;
+    for (const auto& gameStat : gameStats)
+    {
+        stats.Merge(gameStat);
+    }
+    stats.elapsedSec = GetElapsedSec(start);
+
+    return stats;
+}
+
+bool GameRunner::Play(
+    Game& game, const std::array<IAgent*, NUM_BATTLEGROUNDS_PLAYERS>& agents,
+    GameStats& stats) const
+{
+    GameState& gameState = game.GetGameState();
+    game.Start();
+
+    // Select hero phase
+    auto start = Clock::now();
+    for (auto& player : gameState.players)
+    {
+        player.SelectHero(agents[player.idx]->GetActionForSelectHero(player));
+    }
+    stats.selectHeroSec += GetElapsedSec(start);
+
+    std::size_t numTurns = 0;
+
+    while (gameState.phase != Phase::COMPLETE)
+    {
+        if (numTurns == m_maxTurns)
+        {
+            ++stats.numTruncatedGames;
+            stats.numTurns += numTurns;
+            return false;
+        }
+
+        ++numTurns;
+
+        // Recruit phase
+        start = Clock::now();
+        for (auto& player : gameState.players)
+        {
+            if (player.playState != PlayState::PLAYING)
+            {
+                continue;
+            }
+
+            for (std::size_t i = 0; i < m_maxActionsPerTurn; ++i)
+            {
+                const auto legalActions = GetLegalActions(player);
+                const Action action =
+                    agents[player.idx]->GetActionForRecruit(player,
+                                                            legalActions);
+                ++stats.numActions;
+
+                if (action.type == ActionType::END_TURN)
+                {
+                    break;
+                }
+
+                ApplyAction(player, action);
+            }
+        }
+        stats.recruitSec += GetElapsedSec(start);
+
+        // Combat phase starts when the last player completes recruit
+        // NOTE: Defeated players also complete recruit to be counted.
+        start = Clock::now();
+        for (auto& player : gameState.players)
+        {
+            player.CompleteRecruit();
+        }
+        stats.combatSec += GetElapsedSec(start);
+    }
+
+    ++stats.numGames;
+    stats.numTurns += numTurns;
+
+    for (const auto& player : gameState.players)
+    {
+        ++stats.placements[player.idx][player.rank - 1];
+    }
+
+    return true;
+}
+}  // namespace RosettaStone::Battlegrounds
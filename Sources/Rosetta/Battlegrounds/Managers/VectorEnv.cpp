@@ -0,0 +1,222 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Managers/VectorEnv.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatSimulator.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace RosettaStone::Battlegrounds
+{
+VectorEnv::VectorEnv(std::size_t numEnvs, std::size_t numThreads)
+    : m_envs(numEnvs),
+      m_numEpisodes(numEnvs, 0),
+      m_pool(numThreads),
+      m_observations(numEnvs * GameEnv::NUM_OBSERVATIONS, 0.0f),
+      m_legalMasks(numEnvs * GameEnv::NUM_ACTIONS, 0),
+      m_currentPlayers(numEnvs, 0),
+      m_rewards(numEnvs * NUM_BATTLEGROUNDS_PLAYERS, 0.0f),
+      m_dones(numEnvs, 0)
+{
+    // Do nothing
+}
+
+template <typename F>
+void VectorEnv::ForEachEnv(F&& func)
+{
+    if (m_pool.GetNumThreads() > 1)
+    {
+        m_pool.ParallelFor(m_envs.size(), func);
+    }
+    else
+    {
+        for (std::size_t envIdx = 0; envIdx < m_envs.size(); ++envIdx)
+        {
+            func(envIdx);
+        }
+    }
+}
+
+void VectorEnv::SetMaxTurns(std::size_t maxTurns)
+{
+    for (auto& env : m_envs)
+    {
+        env.SetMaxTurns(maxTurns);
+    }
+}
+
+void VectorEnv::SetMaxActionsPerTurn(std::size_t maxActions)
+{
+    for (auto& env : m_envs)
+    {
+        env.SetMaxActionsPerTurn(maxActions);
+    }
+}
+
+void VectorEnv::Reset(unsigned int seed, const VectorEnvOutputs& outputs)
+{
+    std::lock_guard<std::mutex> lock(m_stepMutex);
+
+    // NOTE: The environments are reset in place, so the environment is
+    // invalid until all of them are reset.
+    m_isValid = false;
+    m_seed = seed;
+    std::fill(m_numEpisodes.begin(), m_numEpisodes.end(), 0);
+    std::fill(m_rewards.begin(), m_rewards.end(), 0.0f);
+    std::fill(m_dones.begin(), m_dones.end(), 0);
+
+    ForEachEnv([&](std::size_t envIdx) {
+        ResetEnv(envIdx);
+        WriteOutputs(envIdx);
+    });
+
+    m_isValid = true;
+    CopyOutputs(outputs);
+}
+
+void VectorEnv::Step(const std::int32_t* actions,
+                     const VectorEnvOutputs& outputs)
+{
+    std::lock_guard<std::mutex> lock(m_stepMutex);
+    CheckValid();
+
+    // NOTE: Actions are checked on the calling thread so that an illegal
+    // action throws before any environment is changed.
+    for (std::size_t envIdx = 0; envIdx < m_envs.size(); ++envIdx)
+    {
+        const std::int32_t action = actions[envIdx];
+        if (action < 0 ||
+            static_cast<std::size_t>(action) >= GameEnv::NUM_ACTIONS ||
+            !m_legalMasks[envIdx * GameEnv::NUM_ACTIONS +
+                          static_cast<std::size_t>(action)])
+        {
+            throw std::invalid_argument("Illegal action " +
+                                        std::to_string(action) +
+                                        " of environment " +
+                                        std::to_string(envIdx));
+        }
+    }
+
+    m_isValid = false;
+    ForEachEnv([&](std::size_t envIdx) {
+        GameEnv& env = m_envs[envIdx];
+        const bool isDone = env.Step(GameEnv::DecodeAction(
+            static_cast<std::size_t>(actions[envIdx])));
+
+        float* rewards = &m_rewards[envIdx * NUM_BATTLEGROUNDS_PLAYERS];
+        for (std::size_t seatIdx = 0; seatIdx < NUM_BATTLEGROUNDS_PLAYERS;
+             ++seatIdx)
+        {
+            rewards[seatIdx] = env.GetReward(seatIdx);
+        }
+        m_dones[envIdx] = isDone ? 1 : 0;
+
+        if (isDone)
+        {
+            ResetEnv(envIdx);
+        }
+
+        WriteOutputs(envIdx);
+    });
+
+    m_isValid = true;
+    CopyOutputs(outputs);
+}
+
+std::size_t VectorEnv::GetNumEnvs() const
+{
+    return m_envs.size();
+}
+
+GameEnv& VectorEnv::GetEnv(std::size_t envIdx)
+{
+    return m_envs.at(envIdx);
+}
+
+const std::vector<float>& VectorEnv::GetObservations() const
+{
+    return m_observations;
+}
+
+const std::vector<std::uint8_t>& VectorEnv::GetLegalMasks() const
+{
+    return m_legalMasks;
+}
+
+const std::vector<std::int32_t>& VectorEnv::GetCurrentPlayers() const
+{
+    return m_currentPlayers;
+}
+
+const std::vector<float>& VectorEnv::GetRewards() const
+{
+    return m_rewards;
+}
+
+const std::vector<std::uint8_t>& VectorEnv::GetDones() const
+{
+    return m_dones;
+}
+
+void VectorEnv::CheckValid() const
+{
+    if (!m_isValid)
+    {
+        throw std::logic_error(
+            "VectorEnv must be reset before the first step and after a "
+            "failed call");
+    }
+}
+
+void VectorEnv::CopyOutputs(const VectorEnvOutputs& outputs) const
+{
+    if (outputs.observations)
+    {
+        std::copy(m_observations.begin(), m_observations.end(),
+                  outputs.observations);
+    }
+    if (outputs.legalMasks)
+    {
+        std::copy(m_legalMasks.begin(), m_legalMasks.end(),
+                  outputs.legalMasks);
+    }
+    if (outputs.currentPlayers)
+    {
+        std::copy(m_currentPlayers.begin(), m_currentPlayers.end(),
+                  outputs.currentPlayers);
+    }
+    if (outputs.rewards)
+    {
+        std::copy(m_rewards.begin(), m_rewards.end(), outputs.rewards);
+    }
+    if (outputs.dones)
+    {
+        std::copy(m_dones.begin(), m_dones.end(), outputs.dones);
+    }
+}
+
+void VectorEnv::ResetEnv(std::size_t envIdx)
+{
+    const unsigned int envSeed =
+        CombatSimulator::GetSampleSeed(m_seed, envIdx);
+    m_envs[envIdx].Reset(
+        CombatSimulator::GetSampleSeed(envSeed, m_numEpisodes[envIdx]));
+    ++m_numEpisodes[envIdx];
+}
+
+void VectorEnv::WriteOutputs(std::size_t envIdx)
+{
+    GameEnv& env = m_envs[envIdx];
+    const std::size_t playerIdx = env.GetCurrentPlayerIdx();
+
+    env.WriteObservation(
+        playerIdx, &m_observations[envIdx * GameEnv::NUM_OBSERVATIONS]);
+    env.WriteLegalMask(&m_legalMasks[envIdx * GameEnv::NUM_ACTIONS]);
+    m_currentPlayers[envIdx] = static_cast<std::int32_t>(playerIdx);
+}
+}  // namespace RosettaStone::Battlegrounds
@@ -0,0 +1,399 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Models/BatchCombat.hpp>
+
+#include <stdexcept>
+
+namespace RosettaStone::Battlegrounds
+{
+namespace
+{
+//! Returns a value indicating whether the minion has no power in combat.
+bool IsVanilla(const Minion& minion)
+{
+    const auto& power = minion.GetCard().power;
+
+    return minion.GetTriggerType() == TriggerType::NONE &&
+           !minion.HasDeathrattle() && power.GetDeathrattleTask().empty() &&
+           power.GetStartCombatTask().empty() && minion.GetHealth() > 0;
+}
+}  // namespace
+
+bool BatchCombat::IsSupported(const Player& player1, const Player& player2)
+{
+    bool isSupported = true;
+
+    player1.recruitField.ForEach([&](const MinionData& minion) {
+        isSupported = isSupported && IsVanilla(minion.value());
+    });
+    player2.recruitField.ForEach([&](const MinionData& minion) {
+        isSupported = isSupported && IsVanilla(minion.value());
+    });
+
+    return isSupported;
+}
+
+BatchCombat::BatchCombat(const Player& player1, const Player& player2)
+{
+    const std::array<const Player*, NUM_SIDES> players{ &player1, &player2 };
+
+    for (std::size_t side = 0; side < NUM_SIDES; ++side)
+    {
+        std::size_t pos = 0;
+
+        players[side]->recruitField.ForEach([&](const MinionData& minion) {
+            const Minion& value = minion.value();
+
+            m_initAttack[side][pos] = value.GetAttack();
+            m_initHealth[side][pos] = value.GetHealth();
+            m_initTier[side][pos] = value.GetTier();
+            m_initTaunt[side][pos] = value.HasTaunt() ? 1 : 0;
+            m_initShield[side][pos] = value.HasDivineShield() ? 1 : 0;
+            ++pos;
+        });
+
+        m_initCount[side] = static_cast<int>(pos);
+        m_playerTier[side] = players[side]->currentTier;
+    }
+}
+
+void BatchCombat::Run(std::size_t numBattles, unsigned int seed,
+                      std::tuple<BattleResult, int>* results)
+{
+    if (numBattles > NUM_LANES)
+    {
+        throw std::invalid_argument(
+            "BatchCombat::Run() - Too many battles for a batch");
+    }
+
+    Reset(numBattles, seed);
+
+    bool isAnyActive = true;
+    while (isAnyActive)
+    {
+        SelectAttacks();
+        ResolveDamage();
+        ResolveDeath();
+        FinishTurn();
+
+        isAnyActive = false;
+        for (std::size_t lane = 0; lane < numBattles; ++lane)
+        {
+            isAnyActive = isAnyActive || m_isActive[lane] != 0;
+        }
+    }
+
+    for (std::size_t lane = 0; lane < numBattles; ++lane)
+    {
+        const int p1Count = m_count[0][lane];
+        const int p2Count = m_count[1][lane];
+
+        if ((p1Count > 0) == (p2Count > 0))
+        {
+            results[lane] = std::make_tuple(BattleResult::DRAW, 0);
+            continue;
+        }
+
+        const std::size_t winner = p1Count > 0 ? 0 : 1;
+        int damage = m_playerTier[winner];
+
+        for (int pos = 0; pos < m_count[winner][lane]; ++pos)
+        {
+            damage += m_tier[winner][pos][lane];
+        }
+
+        results[lane] = std::make_tuple(winner == 0
+                                            ? BattleResult::PLAYER1_WIN
+                                            : BattleResult::PLAYER2_WIN,
+                                        damage);
+    }
+}
+
+void BatchCombat::Reset(std::size_t numBattles, unsigned int seed)
+{
+    for (std::size_t side = 0; side < NUM_SIDES; ++side)
+    {
+        for (std::size_t pos = 0; pos < NUM_SLOTS; ++pos)
+        {
+            m_attack[side][pos].fill(m_initAttack[side][pos]);
+            m_health[side][pos].fill(m_initHealth[side][pos]);
+            m_tier[side][pos].fill(m_initTier[side][pos]);
+            m_taunt[side][pos].fill(m_initTaunt[side][pos]);
+            m_shield[side][pos].fill(m_initShield[side][pos]);
+        }
+
+        m_count[side].fill(m_initCount[side]);
+        m_nextAttacker[side].fill(0);
+    }
+
+    m_prevAttackSuccess.fill(0);
+    m_curAttackSuccess.fill(0);
+
+    for (std::size_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+        m_randomState[lane] = static_cast<std::uint64_t>(seed) +
+                              (static_cast<std::uint64_t>(lane) + 1) *
+                                  0x9E3779B97F4A7C15ULL;
+        m_isActive[lane] = lane < numBattles && m_initCount[0] > 0 &&
+                           m_initCount[1] > 0;
+
+        // NOTE: The player with the greater number of minions attacks first,
+        // the same as Battle::Initialize().
+        if (m_initCount[0] > m_initCount[1])
+        {
+            m_turn[lane] = 0;
+        }
+        else if (m_initCount[0] < m_initCount[1])
+        {
+            m_turn[lane] = 1;
+        }
+        else
+        {
+            m_turn[lane] = GetRandom(lane, 2);
+        }
+    }
+}
+
+int BatchCombat::GetRandom(std::size_t lane, int count)
+{
+    // NOTE: Each lane has its own splitmix64 engine, so lanes are independent
+    // and a batch only depends on its seed.
+    std::uint64_t z = (m_randomState[lane] += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+
+    return static_cast<int>(((z >> 32) * static_cast<std::uint64_t>(count)) >>
+                            32);
+}
+
+void BatchCombat::SelectAttacks()
+{
+    for (std::size_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+        m_attackerIdx[lane] = -1;
+        m_targetIdx[lane] = -1;
+        m_curAttackSuccess[lane] = 0;
+
+        if (!m_isActive[lane])
+        {
+            continue;
+        }
+
+        const auto side = static_cast<std::size_t>(m_turn[lane]);
+        const std::size_t opponent = 1 - side;
+        const int count = m_count[side][lane];
+
+        // NOTE: Battle::FindAttacker() can read past the last minion when
+        // the next attacker isn't wrapped, so it is wrapped here.
+        int pos = m_nextAttacker[side][lane] < count
+                      ? m_nextAttacker[side][lane]
+                      : 0;
+        for (int i = 0; i < count; ++i)
+        {
+            if (m_attack[side][pos][lane] > 0)
+            {
+                m_attackerIdx[lane] = pos;
+                break;
+            }
+
+            pos = pos + 1 == count ? 0 : pos + 1;
+        }
+
+        if (m_attackerIdx[lane] == -1)
+        {
+            continue;
+        }
+
+        std::array<int, MAX_FIELD_SIZE> taunts{};
+        int numTaunts = 0;
+
+        for (int i = 0; i < m_count[opponent][lane]; ++i)
+        {
+            if (m_taunt[opponent][i][lane])
+            {
+                taunts[numTaunts++] = i;
+            }
+        }
+
+        m_targetIdx[lane] =
+            numTaunts > 0 ? taunts[GetRandom(lane, numTaunts)]
+                          : GetRandom(lane, m_count[opponent][lane]);
+        m_curAttackSuccess[lane] = 1;
+    }
+}
+
+void BatchCombat::ResolveDamage()
+{
+    LaneArray<int> attackerAttack{};
+    LaneArray<int> attackerHealth{};
+    LaneArray<int> attackerShield{};
+    LaneArray<int> targetAttack{};
+    LaneArray<int> targetHealth{};
+    LaneArray<int> targetShield{};
+
+    // Gather the stats of attackers and targets
+    for (std::size_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+        if (m_attackerIdx[lane] == -1)
+        {
+            continue;
+        }
+
+        const auto side = static_cast<std::size_t>(m_turn[lane]);
+        const std::size_t opponent = 1 - side;
+        const auto attackerPos = static_cast<std::size_t>(m_attackerIdx[lane]);
+        const auto targetPos = static_cast<std::size_t>(m_targetIdx[lane]);
+
+        attackerAttack[lane] = m_attack[side][attackerPos][lane];
+        attackerHealth[lane] = m_health[side][attackerPos][lane];
+        attackerShield[lane] = m_shield[side][attackerPos][lane];
+        targetAttack[lane] = m_attack[opponent][targetPos][lane];
+        targetHealth[lane] = m_health[opponent][targetPos][lane];
+        targetShield[lane] = m_shield[opponent][targetPos][lane];
+    }
+
+    // NOTE: This loop has no branches, so it can be vectorized. Divine shield
+    // blocks the damage and is removed even if the damage is 0, the same as
+    // Minion::TakeDamage(). Lanes without an attack have no damage.
+    for (std::size_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+        const int hasAttack = m_attackerIdx[lane] >= 0;
+
+        targetHealth[lane] -=
+            hasAttack * (1 - targetShield[lane]) * attackerAttack[lane];
+        attackerHealth[lane] -=
+            hasAttack * (1 - attackerShield[lane]) * targetAttack[lane];
+        targetShield[lane] *= 1 - hasAttack;
+        attackerShield[lane] *= 1 - hasAttack;
+
+        m_isTargetDestroyed[lane] =
+            static_cast<std::uint8_t>(hasAttack & (targetHealth[lane] <= 0));
+        m_isAttackerDestroyed[lane] =
+            static_cast<std::uint8_t>(hasAttack & (attackerHealth[lane] <= 0));
+    }
+
+    // Scatter the stats of attackers and targets
+    for (std::size_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+        if (m_attackerIdx[lane] == -1)
+        {
+            continue;
+        }
+
+        const auto side = static_cast<std::size_t>(m_turn[lane]);
+        const std::size_t opponent = 1 - side;
+        const auto attackerPos = static_cast<std::size_t>(m_attackerIdx[lane]);
+        const auto targetPos = static_cast<std::size_t>(m_targetIdx[lane]);
+
+        m_health[side][attackerPos][lane] = attackerHealth[lane];
+        m_shield[side][attackerPos][lane] =
+            static_cast<std::uint8_t>(attackerShield[lane]);
+        m_health[opponent][targetPos][lane] = targetHealth[lane];
+        m_shield[opponent][targetPos][lane] =
+            static_cast<std::uint8_t>(targetShield[lane]);
+    }
+}
+
+void BatchCombat::ResolveDeath()
+{
+    // Find the position of destroyed minion of each side, -1 if none
+    for (std::size_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+        const int side = m_turn[lane];
+        const int attackerDead =
+            m_isAttackerDestroyed[lane] ? m_attackerIdx[lane] : -1;
+        const int targetDead =
+            m_isTargetDestroyed[lane] ? m_targetIdx[lane] : -1;
+
+        m_deadPos[0][lane] = side == 0 ? attackerDead : targetDead;
+        m_deadPos[1][lane] = side == 0 ? targetDead : attackerDead;
+    }
+
+    // Update the next attackers with the rules of Battle::ProcessDestroy()
+    // NOTE: The minion of the opponent is processed first, but each side has
+    // at most one destroyed minion and the rules of a side only depend on
+    // the minion of the same side, so the order doesn't matter.
+    for (std::size_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+        int isAttackerKept = 0;
+
+        for (std::size_t side = 0; side < NUM_SIDES; ++side)
+        {
+            const int deadPos = m_deadPos[side][lane];
+            const int next = m_nextAttacker[side][lane];
+            const int isDead = deadPos >= 0;
+            const int isDecreased = isDead & (next < deadPos) & (next > 0);
+            const int isTurn = m_turn[lane] == static_cast<int>(side);
+
+            isAttackerKept |=
+                isDead & (1 - isDecreased) & isTurn & (next == deadPos);
+            m_nextAttacker[side][lane] = next - isDecreased;
+            m_count[side][lane] -= isDead;
+        }
+
+        const auto turn = static_cast<std::size_t>(m_turn[lane]);
+        const int hasAttack = m_attackerIdx[lane] >= 0;
+        m_nextAttacker[turn][lane] += hasAttack & (1 - isAttackerKept);
+
+        for (std::size_t side = 0; side < NUM_SIDES; ++side)
+        {
+            const int isWrapped = hasAttack & (m_nextAttacker[side][lane] ==
+                                               m_count[side][lane]);
+            m_nextAttacker[side][lane] *= 1 - isWrapped;
+        }
+    }
+
+    // Remove destroyed minions by shifting the minions after them
+    for (std::size_t side = 0; side < NUM_SIDES; ++side)
+    {
+        ShiftSlots(side, m_attack);
+        ShiftSlots(side, m_health);
+        ShiftSlots(side, m_tier);
+        ShiftSlots(side, m_taunt);
+        ShiftSlots(side, m_shield);
+    }
+}
+
+template <typename T>
+void BatchCombat::ShiftSlots(std::size_t side, SlotArray<T>& values)
+{
+    const LaneArray<int>& deadPos = m_deadPos[side];
+
+    for (std::size_t pos = 0; pos + 1 < NUM_SLOTS; ++pos)
+    {
+        const int curPos = static_cast<int>(pos);
+
+        for (std::size_t lane = 0; lane < NUM_LANES; ++lane)
+        {
+            const bool isShifted =
+                deadPos[lane] >= 0 && curPos >= deadPos[lane];
+            values[side][pos][lane] = isShifted ? values[side][pos + 1][lane]
+                                                : values[side][pos][lane];
+        }
+    }
+}
+
+void BatchCombat::FinishTurn()
+{
+    for (std::size_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+        if (!m_isActive[lane])
+        {
+            continue;
+        }
+
+        const bool isDone = !m_prevAttackSuccess[lane] &&
+                            !m_curAttackSuccess[lane];
+
+        m_prevAttackSuccess[lane] = m_curAttackSuccess[lane];
+        m_turn[lane] = 1 - m_turn[lane];
+        m_isActive[lane] = !isDone && m_count[0][lane] > 0 &&
+                           m_count[1][lane] > 0;
+    }
+}
+}  // namespace RosettaStone::Battlegrounds
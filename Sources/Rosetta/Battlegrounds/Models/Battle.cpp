@@ -8,7 +8,9 @@
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+// NOTE: Each thread has its own engine so that battles can be simulated in
+// parallel (see CombatSimulator).
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::Battlegrounds
 {
@@ -20,6 +22,21 @@ Battle::Battle(Player& player1, Player& player2)
 {
     m_player1.battleField = m_player1.recruitField;
     m_player2.battleField = m_player2.recruitField;
+
+    m_player1.battle = this;
+    m_player2.battle = this;
+}
+
+Battle::~Battle()
+{
+    if (m_player1.battle == this)
+    {
+        m_player1.battle = nullptr;
+    }
+    if (m_player2.battle == this)
+    {
+        m_player2.battle = nullptr;
+    }
 }
 
 void Battle::Initialize()
@@ -70,6 +87,12 @@ void Battle::Initialize()
 }
 
 void Battle::Run()
+{
+    Simulate();
+    DealDamage();
+}
+
+void Battle::Simulate()
 {
     Initialize();
 
@@ -79,43 +102,13 @@ void Battle::Run()
     {
         if (m_turn == Turn::PLAYER1)
         {
-            m_p1Field.ForEachAlive([&](MinionData& owner) {
-                m_p1Field.ForEachAlive([&](MinionData& minion) {
-                    {
-                        owner.value().ActivateTrigger(TriggerType::TURN_START,
-                                                      minion.value());
-                    };
-                });
-            });
-
-            m_p2Field.ForEachAlive([&](MinionData& owner) {
-                m_p2Field.ForEachAlive([&](MinionData& minion) {
-                    {
-                        owner.value().ActivateTrigger(TriggerType::TURN_START,
-                                                      minion.value());
-                    };
-                });
-            });
+            ProcessTurnStart(m_p1Field);
+            ProcessTurnStart(m_p2Field);
         }
         else
         {
-            m_p2Field.ForEachAlive([&](MinionData& owner) {
-                m_p2Field.ForEachAlive([&](MinionData& minion) {
-                    {
-                        owner.value().ActivateTrigger(TriggerType::TURN_START,
-                                                      minion.value());
-                    };
-                });
-            });
-
-            m_p1Field.ForEachAlive([&](MinionData& owner) {
-                m_p1Field.ForEachAlive([&](MinionData& minion) {
-                    {
-                        owner.value().ActivateTrigger(TriggerType::TURN_START,
-                                                      minion.value());
-                    };
-                });
-            });
+            ProcessTurnStart(m_p2Field);
+            ProcessTurnStart(m_p1Field);
         }
 
         const bool curAttackSuccess = Attack();
@@ -129,7 +122,10 @@ void Battle::Run()
     }
 
     ProcessResult();
+}
 
+void Battle::DealDamage()
+{
     const int damage = CalculateDamage();
     if (m_result == BattleResult::PLAYER1_WIN)
     {
@@ -141,6 +137,11 @@ void Battle::Run()
     }
 }
 
+void Battle::Seed(unsigned int seed)
+{
+    Random::seed(seed);
+}
+
 bool Battle::Attack()
 {
     const int attackerIdx = FindAttacker();
@@ -282,13 +283,7 @@ void Battle::ProcessDestroy(bool beforeAttack)
                 }
             }
 
-            m_p1Field.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::DEATH, minion);
-            });
-
-            m_p2Field.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::DEATH, minion);
-            });
+            ProcessDeathTrigger(minion);
 
             minion.SetLastFieldPos(minion.GetZonePosition());
             removedMinion = m_p1Field.Remove(minion);
@@ -313,13 +308,7 @@ void Battle::ProcessDestroy(bool beforeAttack)
                 }
             }
 
-            m_p1Field.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::DEATH, minion);
-            });
-
-            m_p2Field.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::DEATH, minion);
-            });
+            ProcessDeathTrigger(minion);
 
             minion.SetLastFieldPos(minion.GetZonePosition());
             removedMinion = m_p2Field.Remove(minion);
@@ -362,6 +351,34 @@ void Battle::ProcessDestroy(bool beforeAttack)
     }
 }
 
+void Battle::ProcessTurnStart(FieldZone& fieldZone)
+{
+    // NOTE: Only minions that have a trigger of TURN_START are visited, and
+    // each of them is activated by every alive minion on the same field.
+    fieldZone.ForEachAliveWithTrigger(
+        TriggerType::TURN_START, [&](MinionData& owner) {
+            fieldZone.ForEachAlive([&](MinionData& minion) {
+                owner.value().ActivateTrigger(TriggerType::TURN_START,
+                                              minion.value());
+            });
+        });
+}
+
+void Battle::ProcessDeathTrigger(Minion& deadMinion)
+{
+    m_p1Field.ForEachAliveWithTrigger(
+        TriggerType::DEATH, [&](MinionData& aliveMinion) {
+            aliveMinion.value().ActivateTrigger(TriggerType::DEATH,
+                                                deadMinion);
+        });
+
+    m_p2Field.ForEachAliveWithTrigger(
+        TriggerType::DEATH, [&](MinionData& aliveMinion) {
+            aliveMinion.value().ActivateTrigger(TriggerType::DEATH,
+                                                deadMinion);
+        });
+}
+
 bool Battle::IsDone() const
 {
     return m_p1Field.IsEmpty() || m_p2Field.IsEmpty() || m_turn == Turn::DONE;
@@ -407,6 +424,11 @@ int Battle::CalculateDamage()
     return totalDamage;
 }
 
+Player& Battle::GetOpponentPlayer(const Player& player)
+{
+    return &player == &m_player1 ? m_player2 : m_player1;
+}
+
 const FieldZone& Battle::GetPlayer1Field() const
 {
     return m_p1Field;
@@ -0,0 +1,183 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Cards/Card.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatCache.hpp>
+#include <Rosetta/Common/Utils.hpp>
+
+namespace RosettaStone::Battlegrounds
+{
+namespace
+{
+//! Appends the encoding of \p field to \p values.
+void EncodeField(const FieldZone& field, std::vector<int>& values)
+{
+    values.emplace_back(field.GetCount());
+
+    field.ForEach([&](const MinionData& minionData) {
+        const Minion& minion = minionData.value();
+        const int flags = (minion.HasTaunt() ? 1 : 0) |
+                          (minion.HasDivineShield() ? 2 : 0) |
+                          (minion.HasDeathrattle() ? 4 : 0);
+
+        values.emplace_back(minion.GetCard().dbfID);
+        values.emplace_back(minion.GetAttack());
+        values.emplace_back(minion.GetHealth());
+        values.emplace_back(flags);
+    });
+}
+
+//! Calculates the hash of \p values.
+std::size_t HashValues(const std::vector<int>& values)
+{
+    std::uint64_t hash = HashCombine(HASH_OFFSET_BASIS, values.size());
+
+    for (const int value : values)
+    {
+        hash = HashCombine(hash, static_cast<std::uint64_t>(value));
+    }
+
+    return static_cast<std::size_t>(hash);
+}
+}  // namespace
+
+std::vector<int> EncodeBoards(const FieldZone& field1, const FieldZone& field2)
+{
+    std::vector<int> values;
+    values.reserve(2 + 8 * MAX_FIELD_SIZE);
+
+    EncodeField(field1, values);
+    EncodeField(field2, values);
+
+    return values;
+}
+
+std::size_t CalculateBoardHash(const FieldZone& field1,
+                               const FieldZone& field2)
+{
+    return HashValues(EncodeBoards(field1, field2));
+}
+
+CombatKey::CombatKey(const Player& player1, const Player& player2,
+                     std::size_t sampleCount)
+    : values(EncodeBoards(player1.recruitField, player2.recruitField)),
+      numSamples(sampleCount)
+{
+    // NOTE: The damage to the hero of loser depends on the tier of winner.
+    values.emplace_back(player1.currentTier);
+    values.emplace_back(player2.currentTier);
+
+    hash = static_cast<std::size_t>(
+        HashCombine(HashValues(values), numSamples));
+}
+
+bool CombatKey::operator==(const CombatKey& rhs) const
+{
+    return hash == rhs.hash && numSamples == rhs.numSamples &&
+           values == rhs.values;
+}
+
+double CombatCacheStats::GetHitRate() const
+{
+    const std::size_t numLookups = numHits + numMisses;
+
+    return numLookups > 0 ? static_cast<double>(numHits) /
+                                static_cast<double>(numLookups)
+                          : 0.0;
+}
+
+CombatCache::CombatCache(CombatSimulator& simulator, std::size_t capacity)
+    : m_simulator(simulator), m_capacity(capacity)
+{
+    // Do nothing
+}
+
+CombatResult CombatCache::Run(const Player& player1, const Player& player2,
+                              std::size_t numSamples, unsigned int seed)
+{
+    const CombatKey key(player1, player2, numSamples);
+
+    if (auto result = Find(key); result.has_value())
+    {
+        return result.value();
+    }
+
+    // NOTE: The simulator runs without the lock, so other threads can use
+    // the cache in the meantime.
+    CombatResult result = m_simulator.Run(player1, player2, numSamples, seed);
+    Insert(key, result);
+
+    return result;
+}
+
+std::optional<CombatResult> CombatCache::Find(const CombatKey& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto iter = m_index.find(key);
+    if (iter == m_index.end())
+    {
+        ++m_stats.numMisses;
+        return std::nullopt;
+    }
+
+    ++m_stats.numHits;
+
+    // Mark as the most recently used
+    m_entries.splice(m_entries.begin(), m_entries, iter->second);
+
+    return iter->second->second;
+}
+
+void CombatCache::Insert(const CombatKey& key, const CombatResult& result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_capacity == 0)
+    {
+        return;
+    }
+
+    if (const auto iter = m_index.find(key); iter != m_index.end())
+    {
+        iter->second->second = result;
+        m_entries.splice(m_entries.begin(), m_entries, iter->second);
+        return;
+    }
+
+    if (m_entries.size() == m_capacity)
+    {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+        ++m_stats.numEvictions;
+    }
+
+    m_entries.emplace_front(key, result);
+    m_index.emplace(key, m_entries.begin());
+}
+
+void CombatCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_index.clear();
+    m_entries.clear();
+}
+
+std::size_t CombatCache::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_entries.size();
+}
+
+CombatCacheStats CombatCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_stats;
+}
+}  // namespace RosettaStone::Battlegrounds
@@ -0,0 +1,253 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Battlegrounds/Models/BatchCombat.hpp>
+#include <Rosetta/Battlegrounds/Models/Battle.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatSimulator.hpp>
+#include <Rosetta/Common/Utils.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace RosettaStone::Battlegrounds
+{
+namespace
+{
+constexpr std::size_t NUM_SAMPLES_PER_THREAD_IN_ROUND = 16;
+
+//! Copies the information of \p src that a battle uses to \p dst.
+void CopyPlayer(const Player& src, Player& dst)
+{
+    dst.playState = src.playState;
+    dst.idx = src.idx;
+    dst.hero = src.hero;
+    dst.currentTier = src.currentTier;
+    dst.recruitField = src.recruitField;
+    dst.isInCombat = true;
+
+    // NOTE: Minions keep the pointer to their original player, so they must
+    // be rebound to the copy. The copy has no game, so the defeat of its hero
+    // isn't processed.
+    dst.recruitField.ForEach(
+        [&](MinionData& minion) { minion.value().owner = &dst; });
+}
+
+void AddDamage(std::vector<std::size_t>& distribution, int damage)
+{
+    const auto idx = static_cast<std::size_t>(damage);
+    if (idx >= distribution.size())
+    {
+        distribution.resize(idx + 1, 0);
+    }
+
+    ++distribution[idx];
+}
+}  // namespace
+
+double CombatResult::GetWinProbability() const
+{
+    return numSamples == 0 ? 0.0
+                           : static_cast<double>(numWins) /
+                                 static_cast<double>(numSamples);
+}
+
+double CombatResult::GetTieProbability() const
+{
+    return numSamples == 0 ? 0.0
+                           : static_cast<double>(numTies) /
+                                 static_cast<double>(numSamples);
+}
+
+double CombatResult::GetLossProbability() const
+{
+    return numSamples == 0 ? 0.0
+                           : static_cast<double>(numLosses) /
+                                 static_cast<double>(numSamples);
+}
+
+double CombatResult::GetAverageDamage() const
+{
+    if (numSamples == 0)
+    {
+        return 0.0;
+    }
+
+    double totalDamage = 0.0;
+
+    for (std::size_t i = 0; i < damageDealt.size(); ++i)
+    {
+        totalDamage += static_cast<double>(i * damageDealt[i]);
+    }
+    for (std::size_t i = 0; i < damageTaken.size(); ++i)
+    {
+        totalDamage -= static_cast<double>(i * damageTaken[i]);
+    }
+
+    return totalDamage / static_cast<double>(numSamples);
+}
+
+CombatSimulator::CombatSimulator(std::size_t numThreads) : m_pool(numThreads)
+{
+    // Do nothing
+}
+
+CombatResult CombatSimulator::Run(const Player& player1, const Player& player2,
+                                  std::size_t numSamples, unsigned int seed)
+{
+    return RunUntil(player1, player2, numSamples, seed, std::nullopt);
+}
+
+CombatResult CombatSimulator::Run(const Player& player1, const Player& player2,
+                                  std::size_t numSamples, unsigned int seed,
+                                  std::chrono::microseconds timeBudget)
+{
+    return RunUntil(player1, player2, numSamples, seed,
+                    std::chrono::steady_clock::now() + timeBudget);
+}
+
+CombatResult CombatSimulator::RunUntil(
+    const Player& player1, const Player& player2, std::size_t numSamples,
+    unsigned int seed,
+    std::optional<std::chrono::steady_clock::time_point> deadline)
+{
+    // NOTE: Battles reseed the engine of the thread they run on, which is the
+    // calling thread if there is one thread, so the state of the engine of
+    // the caller is restored afterwards.
+    const RandomStateGuard randomStateGuard;
+
+    std::vector<std::tuple<BattleResult, int>> samples;
+
+    // NOTE: A unit of work is a batch of battles with the batch kernel and
+    // a battle without it. Each unit runs on its own copy of boards and is
+    // seeded by its index, so the result doesn't depend on the number of
+    // threads.
+    std::unique_ptr<BatchCombat> prototype;
+    if (m_isBatchKernelEnabled && BatchCombat::IsSupported(player1, player2))
+    {
+        prototype = std::make_unique<BatchCombat>(player1, player2);
+    }
+
+    const std::size_t unitSize = prototype ? BatchCombat::NUM_LANES : 1;
+    const std::size_t numUnits = (numSamples + unitSize - 1) / unitSize;
+
+    const auto runUnit = [&](std::size_t unitIdx) {
+        const std::size_t begin = unitIdx * unitSize;
+
+        if (prototype)
+        {
+            const std::size_t count =
+                std::min(BatchCombat::NUM_LANES, numSamples - begin);
+
+            auto batch = std::make_unique<BatchCombat>(*prototype);
+            batch->Run(count, GetSampleSeed(seed, unitIdx), &samples[begin]);
+        }
+        else
+        {
+            samples[begin] =
+                RunSample(player1, player2, GetSampleSeed(seed, begin));
+        }
+    };
+
+    // NOTE: Without a deadline, all units run in one round. With a deadline,
+    // a round gives each thread a few units, so the time is checked often
+    // and the units that ran are always the first ones.
+    const std::size_t numThreads = m_pool.GetNumThreads();
+    const std::size_t roundSize =
+        deadline ? std::max<std::size_t>(numThreads, 1) *
+                       (prototype ? 1 : NUM_SAMPLES_PER_THREAD_IN_ROUND)
+                 : numUnits;
+    std::size_t numDone = 0;
+
+    while (numDone < numUnits)
+    {
+        const std::size_t count = std::min(roundSize, numUnits - numDone);
+
+        // NOTE: The buffer grows by rounds, so a large number of samples with
+        // a small budget doesn't allocate results that never run.
+        samples.resize(std::min(numSamples, (numDone + count) * unitSize));
+
+        if (numThreads > 1)
+        {
+            m_pool.ParallelFor(
+                count, [&](std::size_t idx) { runUnit(numDone + idx); });
+        }
+        else
+        {
+            for (std::size_t idx = 0; idx < count; ++idx)
+            {
+                runUnit(numDone + idx);
+            }
+        }
+
+        numDone += count;
+
+        if (deadline && std::chrono::steady_clock::now() >= *deadline)
+        {
+            break;
+        }
+    }
+
+    CombatResult result;
+    result.numSamples = samples.size();
+
+    for (const auto& [battleResult, damage] : samples)
+    {
+        switch (battleResult)
+        {
+            case BattleResult::PLAYER1_WIN:
+                ++result.numWins;
+                AddDamage(result.damageDealt, damage);
+                break;
+            case BattleResult::PLAYER2_WIN:
+                ++result.numLosses;
+                AddDamage(result.damageTaken, damage);
+                break;
+            default:
+                ++result.numTies;
+                break;
+        }
+    }
+
+    return result;
+}
+
+void CombatSimulator::SetBatchKernelEnabled(bool isEnabled)
+{
+    m_isBatchKernelEnabled = isEnabled;
+}
+
+unsigned int CombatSimulator::GetSampleSeed(unsigned int seed,
+                                            std::size_t sampleIdx)
+{
+    return MixSeed(seed, sampleIdx);
+}
+
+std::tuple<BattleResult, int> CombatSimulator::RunSample(
+    const Player& player1, const Player& player2, unsigned int seed)
+{
+    Player p1;
+    Player p2;
+    CopyPlayer(player1, p1);
+    CopyPlayer(player2, p2);
+
+    // NOTE: Minions of both players compare the index of their players,
+    // so the copies must have different indices.
+    if (p1.idx == p2.idx)
+    {
+        p2.idx = p1.idx + 1;
+    }
+
+    Battle battle(p1, p2);
+    Battle::Seed(seed);
+    battle.Simulate();
+
+    const BattleResult result = battle.GetResult();
+    const int damage =
+        result == BattleResult::DRAW ? 0 : battle.CalculateDamage();
+
+    return std::make_tuple(result, damage);
+}
+}  // namespace RosettaStone::Battlegrounds
@@ -11,7 +11,7 @@ namespace RosettaStone::Battlegrounds
 {
 void Hero::Initialize(const Card& heroCard)
 {
-    card = heroCard;
+    card = &heroCard;
     health = heroCard.gameTags.at(GameTag::HEALTH);
 }
 
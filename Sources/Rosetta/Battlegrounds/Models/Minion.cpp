@@ -13,13 +13,13 @@
 
 namespace RosettaStone::Battlegrounds
 {
-Minion::Minion(Card card, int poolIdx)
-    : m_card(std::move(card)),
+Minion::Minion(const Card& card, int poolIdx)
+    : m_card(&card),
       m_poolIdx(poolIdx),
-      m_attack(m_card.GetAttack()),
-      m_health(m_card.GetHealth())
+      m_attack(card.GetAttack()),
+      m_health(card.GetHealth())
 {
-    for (const auto& tag : m_card.gameTags)
+    for (const auto& tag : card.gameTags)
     {
         switch (tag.first)
         {
@@ -38,6 +38,11 @@ Minion::Minion(Card card, int poolIdx)
     }
 }
 
+const Card& Minion::GetCard() const
+{
+    return *m_card;
+}
+
 int Minion::GetIndex() const
 {
     return m_index;
@@ -55,7 +60,7 @@ int Minion::GetPoolIndex() const
 
 std::string_view Minion::GetName() const
 {
-    return m_card.name;
+    return m_card->name;
 }
 
 int Minion::GetGameTag(GameTag tag) const
@@ -83,7 +88,7 @@ void Minion::SetGameTag(GameTag tag, int value)
 
 Race Minion::GetRace() const
 {
-    return m_card.GetRace();
+    return m_card->GetRace();
 }
 
 ZoneType Minion::GetZoneType() const
@@ -118,7 +123,7 @@ void Minion::SetLastFieldPos(int pos)
 
 int Minion::GetTier() const
 {
-    return m_card.GetTier();
+    return m_card->GetTier();
 }
 
 int Minion::GetAttack() const
@@ -141,6 +146,13 @@ void Minion::SetHealth(int val)
     m_health = val;
 }
 
+TriggerType Minion::GetTriggerType() const
+{
+    const auto& trigger = m_card->power.GetTrigger();
+    return trigger.has_value() ? trigger.value().GetTriggerType()
+                               : TriggerType::NONE;
+}
+
 bool Minion::HasDeathrattle() const
 {
     return m_hasDeathrattle;
@@ -187,12 +199,12 @@ bool Minion::IsDestroyed() const
 
 bool Minion::IsPlayableByCardReq(Player& player) const
 {
-    if (!m_card.IsPlayableByCardReq(player))
+    if (!m_card->IsPlayableByCardReq(player))
     {
         return false;
     }
 
-    if (m_card.mustHaveToTargetToPlay && !HasAnyValidPlayTargets(player))
+    if (m_card->mustHaveToTargetToPlay && !HasAnyValidPlayTargets(player))
     {
         return false;
     }
@@ -204,7 +216,7 @@ bool Minion::HasAnyValidPlayTargets(Player& player) const
 {
     bool friendlyMinions = false;
     
-    switch (m_card.targetingType)
+    switch (m_card->targetingType)
     {
         case TargetingType::FRIENDLY_MINIONS:
             friendlyMinions = true;
@@ -217,7 +229,7 @@ bool Minion::HasAnyValidPlayTargets(Player& player) const
     {
         for (auto& minion : player.recruitField.GetAll())
         {
-            if (m_card.TargetingRequirements(minion))
+            if (m_card->TargetingRequirements(minion))
             {
                 return true;
             }
@@ -231,12 +243,12 @@ bool Minion::IsValidPlayTarget(Player& player, int targetIdx)
 {
     if (targetIdx == -1)
     {
-        if (m_card.mustHaveToTargetToPlay)
+        if (m_card->mustHaveToTargetToPlay)
         {
             return false;
         }
 
-        if (m_card.targetingType == TargetingType::NONE)
+        if (m_card->targetingType == TargetingType::NONE)
         {
             return true;
         }
@@ -257,7 +269,7 @@ bool Minion::IsValidPlayTarget(Player& player, int targetIdx)
             return false;
         }
 
-        if (m_card.TargetingRequirements(target))
+        if (m_card->TargetingRequirements(target))
         {
             return true;
         }
@@ -268,7 +280,7 @@ bool Minion::IsValidPlayTarget(Player& player, int targetIdx)
 
 bool Minion::CheckTargetingType([[maybe_unused]] Minion& target)
 {
-    switch (m_card.targetingType)
+    switch (m_card->targetingType)
     {
         case TargetingType::NONE:
             return false;
@@ -283,7 +295,7 @@ bool Minion::CheckTargetingType([[maybe_unused]] Minion& target)
 
 void Minion::ActivateTrigger(TriggerType type, Minion& source)
 {
-    auto& trigger = m_card.power.GetTrigger();
+    const auto& trigger = m_card->power.GetTrigger();
     if (!trigger.has_value())
     {
         return;
@@ -342,16 +354,16 @@ void Minion::ActivateTask(PowerType type, Player& player, Minion& target)
     }
 }
 
-std::vector<TaskType> Minion::GetTasks(PowerType type)
+std::vector<TaskType> Minion::GetTasks(PowerType type) const
 {
     switch (type)
     {
         case PowerType::POWER:
-            return m_card.power.GetBattlecryTask();
+            return m_card->power.GetBattlecryTask();
         case PowerType::DEATHRATTLE:
-            return m_card.power.GetDeathrattleTask();
+            return m_card->power.GetDeathrattleTask();
         case PowerType::START_OF_COMBAT:
-            return m_card.power.GetStartCombatTask();
+            return m_card->power.GetStartCombatTask();
         default:
             return std::vector<TaskType>{};
     }
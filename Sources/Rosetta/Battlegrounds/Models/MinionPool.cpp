@@ -10,7 +10,7 @@
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::Battlegrounds
 {
@@ -18,17 +18,24 @@ void MinionPool::Initialize(Race excludeRace)
 {
     std::size_t idx = 0;
 
+    for (auto& indices : m_availableIdx)
+    {
+        indices.clear();
+    }
+    m_availablePos.fill(-1);
+
     // Tier 1
     for (const auto& card : Cards::GetTier1Minions())
     {
-        if (card.GetRace() == excludeRace)
+        if (card->GetRace() == excludeRace)
         {
             continue;
         }
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER1_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_minions.at(idx) = Minion(*card, idx);
+            AddAvailable(idx);
             ++idx;
         }
     }
@@ -36,14 +43,15 @@ void MinionPool::Initialize(Race excludeRace)
     // Tier 2
     for (const auto& card : Cards::GetTier2Minions())
     {
-        if (card.GetRace() == excludeRace)
+        if (card->GetRace() == excludeRace)
         {
             continue;
         }
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER2_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_minions.at(idx) = Minion(*card, idx);
+            AddAvailable(idx);
             ++idx;
         }
     }
@@ -51,14 +59,15 @@ void MinionPool::Initialize(Race excludeRace)
     // Tier 3
     for (const auto& card : Cards::GetTier3Minions())
     {
-        if (card.GetRace() == excludeRace)
+        if (card->GetRace() == excludeRace)
         {
             continue;
         }
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER3_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_minions.at(idx) = Minion(*card, idx);
+            AddAvailable(idx);
             ++idx;
         }
     }
@@ -66,14 +75,15 @@ void MinionPool::Initialize(Race excludeRace)
     // Tier 4
     for (const auto& card : Cards::GetTier4Minions())
     {
-        if (card.GetRace() == excludeRace)
+        if (card->GetRace() == excludeRace)
         {
             continue;
         }
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER4_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_minions.at(idx) = Minion(*card, idx);
+            AddAvailable(idx);
             ++idx;
         }
     }
@@ -81,14 +91,15 @@ void MinionPool::Initialize(Race excludeRace)
     // Tier 5
     for (const auto& card : Cards::GetTier5Minions())
     {
-        if (card.GetRace() == excludeRace)
+        if (card->GetRace() == excludeRace)
         {
             continue;
         }
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER5_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_minions.at(idx) = Minion(*card, idx);
+            AddAvailable(idx);
             ++idx;
         }
     }
@@ -96,14 +107,15 @@ void MinionPool::Initialize(Race excludeRace)
     // Tier 6
     for (const auto& card : Cards::GetTier6Minions())
     {
-        if (card.GetRace() == excludeRace)
+        if (card->GetRace() == excludeRace)
         {
             continue;
         }
 
         for (std::size_t i = 0; i < NUM_COPIES_OF_EACH_TIER6_MINIONS; ++i)
         {
-            m_minions.at(idx) = { Minion(card, idx), idx, true };
+            m_minions.at(idx) = Minion(*card, idx);
+            AddAvailable(idx);
             ++idx;
         }
     }
@@ -119,32 +131,53 @@ std::size_t MinionPool::GetCount() const
 void MinionPool::AddMinionsToTavern(Player& player, Tavern& tavern)
 {
     const std::size_t numMinions = GetNumMinionsCanPurchase(player.currentTier);
-    auto minions = GetMinions(1, player.currentTier, true);
-
-    Random::shuffle(minions.begin(), minions.end());
 
-    std::size_t idx = 0;
-    for (auto& minion : minions)
+    std::size_t numAvailable = 0;
+    for (int tier = 1; tier <= player.currentTier; ++tier)
     {
-        tavern.fieldZone.Add(minion);
-        std::get<2>(m_minions.at(minion.GetPoolIndex())) = false;
-        ++idx;
+        numAvailable += m_availableIdx[tier - 1].size();
+    }
 
-        if (idx == numMinions)
+    // NOTE: Picking a minion uniformly at random among the remaining ones each
+    // time has the same distribution as shuffling all of them and taking the
+    // first ones.
+    for (std::size_t i = 0; i < numMinions && numAvailable > 0; ++i)
+    {
+        if (tavern.fieldZone.IsFull())
         {
             break;
         }
+
+        auto pos = Random::get<std::size_t>(0, numAvailable - 1);
+        int tier = 1;
+
+        while (pos >= m_availableIdx[tier - 1].size())
+        {
+            pos -= m_availableIdx[tier - 1].size();
+            ++tier;
+        }
+
+        const int idx = m_availableIdx[tier - 1][pos];
+        RemoveAvailable(idx);
+        --numAvailable;
+
+        tavern.fieldZone.Add(m_minions[idx]);
     }
 }
 
 void MinionPool::ReturnMinion(int idx)
 {
-    if (idx < 0 || idx >= NUM_TOTAL_TAVERN_MINIONS)
+    if (idx < 0 || idx >= static_cast<int>(m_count))
     {
         return;
     }
 
-    std::get<2>(m_minions.at(idx)) = true;
+    if (m_availablePos[idx] >= 0)
+    {
+        return;
+    }
+
+    AddAvailable(idx);
 }
 
 std::vector<Minion> MinionPool::GetMinions(int minTier, int maxTier,
@@ -152,21 +185,42 @@ std::vector<Minion> MinionPool::GetMinions(int minTier, int maxTier,
 {
     std::vector<Minion> result;
 
-    for (auto& minion : m_minions)
+    for (std::size_t idx = 0; idx < m_count; ++idx)
     {
-        const int tier = std::get<0>(minion).GetTier();
+        const int tier = m_minions[idx].GetTier();
 
         if (tier >= minTier && tier <= maxTier)
         {
-            if (isInPoolOnly && std::get<2>(minion) == false)
+            if (isInPoolOnly && m_availablePos[idx] < 0)
             {
                 continue;
             }
 
-            result.emplace_back(std::get<0>(minion));
+            result.emplace_back(m_minions[idx]);
         }
     }
 
     return result;
 }
+
+void MinionPool::AddAvailable(int idx)
+{
+    auto& indices = m_availableIdx[m_minions[idx].GetTier() - 1];
+
+    m_availablePos[idx] = static_cast<int>(indices.size());
+    indices.emplace_back(idx);
+}
+
+void MinionPool::RemoveAvailable(int idx)
+{
+    auto& indices = m_availableIdx[m_minions[idx].GetTier() - 1];
+    const int pos = m_availablePos[idx];
+
+    // Move the last index to the position of the removed one
+    indices[pos] = indices.back();
+    m_availablePos[indices[pos]] = pos;
+    indices.pop_back();
+
+    m_availablePos[idx] = -1;
+}
 }  // namespace RosettaStone::Battlegrounds
@@ -5,8 +5,12 @@
 // property of any third parties.
 
 #include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Battlegrounds/Models/Battle.hpp>
 #include <Rosetta/Battlegrounds/Models/Player.hpp>
 
+#include <stdexcept>
+
 namespace RosettaStone::Battlegrounds
 {
 FieldZone& Player::GetField()
@@ -14,17 +18,27 @@ FieldZone& Player::GetField()
     return isInCombat ? battleField : recruitField;
 }
 
+Player& Player::GetOpponentPlayer()
+{
+    if (battle != nullptr)
+    {
+        return battle->GetOpponentPlayer(*this);
+    }
+
+    return game->GetOpponentPlayer(*this);
+}
+
 void Player::SelectHero(std::size_t idx)
 {
-    const auto heroCard = Cards::FindCardByDbfID(heroChoices.at(idx));
+    const auto& heroCard = Cards::FindCardByDbfID(heroChoices.at(idx));
     hero.Initialize(heroCard);
 
-    selectHeroCallback(*this);
+    game->ProcessSelectHero();
 }
 
 void Player::PrepareTavern()
 {
-    prepareTavernMinionsCallback(*this);
+    game->GetGameState().minionPool.AddMinionsToTavern(*this, tavern);
 }
 
 void Player::PurchaseMinion(std::size_t idx)
@@ -34,7 +48,8 @@ void Player::PurchaseMinion(std::size_t idx)
         return;
     }
 
-    purchaseMinionCallback(*this, idx);
+    Minion minion = tavern.fieldZone.Remove(tavern.fieldZone[idx]);
+    hand.Add(minion, -1);
 
     remainCoin -= NUM_COIN_PURCHASE_MINION;
 }
@@ -60,24 +75,26 @@ void Player::PlayCard(std::size_t handIdx, std::size_t fieldIdx, int targetIdx)
         CardData card = hand.Remove(hand[handIdx]);
 
         auto minion = std::get<Minion>(card);
-        minion.getPlayerCallback = [&]() -> Player& { return *this; };
-        minion.SetIndex(getNextCardIndexCallback());
+        minion.owner = this;
+        minion.SetIndex(game->GetNextCardIndex());
 
-        Player& opponent = getOpponentPlayerCallback(*this);
+        Player& opponent = GetOpponentPlayer();
 
         if (targetIdx == -1)
         {
             recruitField.Add(minion, fieldIdx);
 
-            recruitField.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::SUMMON,
-                                                    minion);
-            });
+            recruitField.ForEachAliveWithTrigger(
+                TriggerType::SUMMON, [&](MinionData& aliveMinion) {
+                    aliveMinion.value().ActivateTrigger(TriggerType::SUMMON,
+                                                        minion);
+                });
 
-            opponent.recruitField.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::SUMMON,
-                                                    minion);
-            });
+            opponent.recruitField.ForEachAliveWithTrigger(
+                TriggerType::SUMMON, [&](MinionData& aliveMinion) {
+                    aliveMinion.value().ActivateTrigger(TriggerType::SUMMON,
+                                                        minion);
+                });
 
             minion.ActivateTask(PowerType::POWER, *this);
         }
@@ -87,23 +104,26 @@ void Player::PlayCard(std::size_t handIdx, std::size_t fieldIdx, int targetIdx)
 
             recruitField.Add(minion, fieldIdx);
 
-            recruitField.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::SUMMON,
-                                                    minion);
-            });
+            recruitField.ForEachAliveWithTrigger(
+                TriggerType::SUMMON, [&](MinionData& aliveMinion) {
+                    aliveMinion.value().ActivateTrigger(TriggerType::SUMMON,
+                                                        minion);
+                });
 
-            opponent.recruitField.ForEachAlive([&](MinionData& aliveMinion) {
-                aliveMinion.value().ActivateTrigger(TriggerType::SUMMON,
-                                                    minion);
-            });
+            opponent.recruitField.ForEachAliveWithTrigger(
+                TriggerType::SUMMON, [&](MinionData& aliveMinion) {
+                    aliveMinion.value().ActivateTrigger(TriggerType::SUMMON,
+                                                        minion);
+                });
 
             minion.ActivateTask(PowerType::POWER, *this, target);
         }
 
-        recruitField.ForEachAlive([&](MinionData& aliveMinion) {
-            aliveMinion.value().ActivateTrigger(TriggerType::AFTER_PLAY_MINION,
-                                                minion);
-        });
+        recruitField.ForEachAliveWithTrigger(
+            TriggerType::AFTER_PLAY_MINION, [&](MinionData& aliveMinion) {
+                aliveMinion.value().ActivateTrigger(
+                    TriggerType::AFTER_PLAY_MINION, minion);
+            });
     }
     else
     {
@@ -114,7 +134,7 @@ void Player::PlayCard(std::size_t handIdx, std::size_t fieldIdx, int targetIdx)
 void Player::SellMinion(std::size_t idx)
 {
     const auto minion = recruitField.Remove(recruitField[idx]);
-    returnMinionCallback(minion.GetPoolIndex());
+    game->GetGameState().minionPool.ReturnMinion(minion.GetPoolIndex());
 
     remainCoin += 1;
 }
@@ -127,7 +147,28 @@ void Player::UpgradeTavern()
     }
 
     remainCoin -= coinToUpgradeTavern;
-    upgradeTavernCallback(*this);
+    ++currentTier;
+
+    // Set the value of coin to upgrade player's Tavern to the next tier
+    switch (currentTier)
+    {
+        case 2:
+            coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_3;
+            break;
+        case 3:
+            coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_4;
+            break;
+        case 4:
+            coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_5;
+            break;
+        case 5:
+            coinToUpgradeTavern = NUM_COIN_UPGRADE_TAVERN_TIER_6;
+            break;
+        case 6:
+            break;
+        default:
+            throw std::logic_error("Invalid player's current tier");
+    }
 }
 
 void Player::RefreshTavern()
@@ -137,10 +178,19 @@ void Player::RefreshTavern()
         return;
     }
 
-    clearTavernMinionsCallback(*this);
+    ClearTavern();
     remainCoin -= NUM_COIN_REFRESH_TAVERN;
 
-    prepareTavernMinionsCallback(*this);
+    PrepareTavern();
+}
+
+void Player::ClearTavern()
+{
+    while (!tavern.fieldZone.IsEmpty())
+    {
+        Minion minion = tavern.fieldZone.Remove(tavern.fieldZone[0]);
+        game->GetGameState().minionPool.ReturnMinion(minion.GetPoolIndex());
+    }
 }
 
 void Player::FreezeTavern()
@@ -162,11 +212,15 @@ void Player::RearrangeMinion(std::size_t curIdx, std::size_t newIdx)
 
 void Player::CompleteRecruit() const
 {
-    completeRecruitCallback();
+    game->ProcessCompleteRecruit();
 }
 
 void Player::ProcessDefeat()
 {
-    processDefeatCallback(*this);
+    // NOTE: A player without a game has nothing to process.
+    if (game != nullptr)
+    {
+        game->ProcessDefeat(*this);
+    }
 }
 }  // namespace RosettaStone::Battlegrounds
@@ -6,11 +6,9 @@
 
 #include <Rosetta/Battlegrounds/Models/Spell.hpp>
 
-#include <utility>
-
 namespace RosettaStone::Battlegrounds
 {
-Spell::Spell(Card card) : m_card(std::move(card))
+Spell::Spell(const Card& card) : m_card(&card)
 {
     // Do nothing
 }
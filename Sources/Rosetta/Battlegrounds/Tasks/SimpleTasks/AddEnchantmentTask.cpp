@@ -28,7 +28,7 @@ TaskStatus AddEnchantmentTask::Run(Player& player, Minion& source)
     }
 
     auto minions = IncludeTask::GetMinions(m_entityType, player, source);
-    Card enchantmentCard = Cards::FindCardByID(m_cardID);
+    const Card& enchantmentCard = Cards::FindCardByID(m_cardID);
 
     for (auto& minion : minions)
     {
@@ -43,7 +43,7 @@ TaskStatus AddEnchantmentTask::Run(Player& player, Minion& source,
 {
     auto minions =
         IncludeTask::GetMinions(m_entityType, player, source, target);
-    Card enchantmentCard = Cards::FindCardByID(m_cardID);
+    const Card& enchantmentCard = Cards::FindCardByID(m_cardID);
 
     for (auto& minion : minions)
     {
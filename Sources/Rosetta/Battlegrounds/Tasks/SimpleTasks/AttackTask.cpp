@@ -19,7 +19,7 @@ AttackTask::AttackTask(EntityType attacker) : m_attacker(attacker)
 
 TaskStatus AttackTask::Run(Player& player, Minion& source)
 {
-    Battle& battle = player.getBattleCallback();
+    Battle& battle = *player.battle;
 
     auto attackers = IncludeTask::GetMinions(m_attacker, player, source);
     for (auto& attacker : attackers)
@@ -36,7 +36,7 @@ TaskStatus AttackTask::Run(Player& player, Minion& source)
 
 TaskStatus AttackTask::Run(Player& player, Minion& source, Minion& target)
 {
-    Battle& battle = player.getBattleCallback();
+    Battle& battle = *player.battle;
 
     auto attackers =
         IncludeTask::GetMinions(m_attacker, player, source, target);
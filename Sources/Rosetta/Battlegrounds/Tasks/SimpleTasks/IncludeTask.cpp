@@ -43,7 +43,7 @@ std::vector<std::reference_wrapper<Minion>> IncludeTask::GetMinions(
             break;
         case EntityType::ENEMY_MINIONS:
         {
-            Player& opponent = player.getOpponentPlayerCallback(player);
+            Player& opponent = player.GetOpponentPlayer();
             opponent.GetField().ForEachAlive([&](MinionData& minion) {
                 minions.emplace_back(minion.value());
             });
@@ -69,7 +69,7 @@ int SummonTask::GetPosition(Minion& source, SummonSide side)
 
 TaskStatus SummonTask::Run(Player& player, Minion& source)
 {
-    const Card card = Cards::FindCardByID(m_cardID);
+    const Card& card = Cards::FindCardByID(m_cardID);
 
     for (int i = 0; i < m_amount; ++i)
     {
@@ -80,6 +80,7 @@ TaskStatus SummonTask::Run(Player& player, Minion& source)
     }
 
     Minion summonMinion{ card };
+    summonMinion.owner = &player;
 
     int summonPos = GetPosition(source, m_side);
     if (summonPos > player.GetField().GetCount())
@@ -100,7 +101,7 @@ TaskStatus SummonTask::Run(Player& player, Minion& source)
 TaskStatus SummonTask::Run(Player& player, Minion& source,
                            [[maybe_unused]] Minion& target)
 {
-    const Card card = Cards::FindCardByID(m_cardID);
+    const Card& card = Cards::FindCardByID(m_cardID);
 
     for (int i = 0; i < m_amount; ++i)
     {
@@ -111,6 +112,7 @@ TaskStatus SummonTask::Run(Player& player, Minion& source,
     }
 
     Minion summonMinion{ card };
+    summonMinion.owner = &player;
 
     int summonPos = GetPosition(source, m_side);
     if (summonPos > player.GetField().GetCount())
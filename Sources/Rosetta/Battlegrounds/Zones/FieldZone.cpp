@@ -19,6 +19,7 @@ FieldZone& FieldZone::operator=(const FieldZone& rhs)
 
     m_minions = rhs.m_minions;
     m_count = rhs.m_count;
+    m_triggerMasks = rhs.m_triggerMasks;
 
     return *this;
 }
@@ -66,6 +67,7 @@ void FieldZone::Add(Minion& minion, int zonePos)
     m_minions[pos].value().SetZoneType(m_type);
 
     Reposition(zonePos);
+    UpdateTriggerMasks();
 }
 
 const Minion FieldZone::Remove(Minion& minion)
@@ -93,6 +95,7 @@ const Minion FieldZone::Remove(Minion& minion)
     m_count = count;
 
     Reposition(pos);
+    UpdateTriggerMasks();
 
     return result;
 }
@@ -132,6 +135,11 @@ bool FieldZone::IsFull() const
     return m_count == MAX_FIELD_SIZE;
 }
 
+bool FieldZone::HasTrigger(TriggerType type) const
+{
+    return m_triggerMasks[static_cast<std::size_t>(type)] != 0;
+}
+
 std::vector<std::reference_wrapper<Minion>> FieldZone::GetAll()
 {
     std::vector<std::reference_wrapper<Minion>> result;
@@ -147,4 +155,16 @@ std::vector<std::reference_wrapper<Minion>> FieldZone::GetAll()
 
     return result;
 }
+
+void FieldZone::UpdateTriggerMasks()
+{
+    m_triggerMasks.fill(0);
+
+    for (int i = 0; i < m_count; ++i)
+    {
+        const auto typeIdx =
+            static_cast<std::size_t>(m_minions[i].value().GetTriggerType());
+        m_triggerMasks[typeIdx] |= static_cast<std::uint8_t>(1 << i);
+    }
+}
 }  // namespace RosettaStone::Battlegrounds
@@ -0,0 +1,239 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/StartupProfiler.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace RosettaStone
+{
+namespace
+{
+std::mutex g_phasesMutex;
+std::vector<StartupPhase> g_phases;
+
+thread_local std::string t_currentPath;
+thread_local std::size_t t_currentDepth = 0;
+
+// NOTE: The counters are trivial thread_local values, so the global
+// operator new can update them without atomics or dynamic initialization.
+thread_local std::size_t t_numAllocations = 0;
+thread_local std::size_t t_allocatedBytes = 0;
+}  // namespace
+
+StartupProfiler::ScopedPhase::ScopedPhase(std::string_view name)
+    : m_name(t_currentPath.empty() ? std::string{ name }
+                                   : t_currentPath + "/" + std::string{ name })
+{
+    {
+        std::lock_guard<std::mutex> lock(g_phasesMutex);
+
+        // NOTE: A phase is added when it is entered for the first time,
+        // so the list keeps the order that phases were entered.
+        const auto iter = std::find_if(
+            g_phases.begin(), g_phases.end(),
+            [this](const StartupPhase& phase) { return phase.name == m_name; });
+        m_phaseIdx = static_cast<std::size_t>(iter - g_phases.begin());
+
+        if (iter == g_phases.end())
+        {
+            StartupPhase phase;
+            phase.name = m_name;
+            phase.depth = t_currentDepth;
+            g_phases.emplace_back(phase);
+        }
+    }
+
+    t_currentPath = m_name;
+    ++t_currentDepth;
+
+    m_startNumAllocations = t_numAllocations;
+    m_startAllocatedBytes = t_allocatedBytes;
+    m_startTime = std::chrono::steady_clock::now();
+}
+
+StartupProfiler::ScopedPhase::~ScopedPhase()
+{
+    const auto endTime = std::chrono::steady_clock::now();
+    const std::size_t numAllocations = t_numAllocations - m_startNumAllocations;
+    const std::size_t allocatedBytes = t_allocatedBytes - m_startAllocatedBytes;
+
+    const double elapsedMs =
+        std::chrono::duration<double, std::milli>(endTime - m_startTime)
+            .count();
+
+    {
+        std::lock_guard<std::mutex> lock(g_phasesMutex);
+
+        // NOTE: Reset() may be called while the phase is open.
+        if (m_phaseIdx < g_phases.size() &&
+            g_phases[m_phaseIdx].name == m_name)
+        {
+            StartupPhase& phase = g_phases[m_phaseIdx];
+            phase.numCalls += 1;
+            phase.elapsedMs += elapsedMs;
+            phase.numAllocations += numAllocations;
+            phase.allocatedBytes += allocatedBytes;
+        }
+    }
+
+    --t_currentDepth;
+    const auto pos = m_name.rfind('/');
+    t_currentPath = (pos == std::string::npos) ? "" : m_name.substr(0, pos);
+}
+
+void StartupProfiler::WorkerAllocations::AddToCurrentThread()
+{
+    t_numAllocations += m_numAllocations.exchange(0, std::memory_order_relaxed);
+    t_allocatedBytes += m_allocatedBytes.exchange(0, std::memory_order_relaxed);
+}
+
+std::vector<StartupPhase> StartupProfiler::GetPhases()
+{
+    std::lock_guard<std::mutex> lock(g_phasesMutex);
+    return g_phases;
+}
+
+StartupPhase StartupProfiler::FindPhase(std::string_view name)
+{
+    std::lock_guard<std::mutex> lock(g_phasesMutex);
+
+    for (const auto& phase : g_phases)
+    {
+        if (phase.name == name)
+        {
+            return phase;
+        }
+    }
+
+    return StartupPhase{};
+}
+
+void StartupProfiler::Reset()
+{
+    std::lock_guard<std::mutex> lock(g_phasesMutex);
+    g_phases.clear();
+}
+
+std::string StartupProfiler::ToString()
+{
+    std::string result;
+    char line[256];
+
+    // NOTE: The allocation columns are hidden if allocations are not counted,
+    // because their values are always 0.
+    const bool countsAllocations = IsCountingAllocations();
+
+    if (countsAllocations)
+    {
+        std::snprintf(line, sizeof(line), "%-56s %8s %12s %14s %14s\n",
+                      "Phase", "Calls", "Time (ms)", "Allocations", "Bytes");
+    }
+    else
+    {
+        std::snprintf(line, sizeof(line), "%-56s %8s %12s\n", "Phase",
+                      "Calls", "Time (ms)");
+    }
+    result += line;
+
+    for (const auto& phase : GetPhases())
+    {
+        const auto pos = phase.name.rfind('/');
+        const std::string name =
+            std::string(phase.depth * 2, ' ') +
+            (pos == std::string::npos ? phase.name
+                                      : phase.name.substr(pos + 1));
+
+        if (countsAllocations)
+        {
+            std::snprintf(line, sizeof(line),
+                          "%-56s %8zu %12.3f %14zu %14zu\n", name.c_str(),
+                          phase.numCalls, phase.elapsedMs,
+                          phase.numAllocations, phase.allocatedBytes);
+        }
+        else
+        {
+            std::snprintf(line, sizeof(line), "%-56s %8zu %12.3f\n",
+                          name.c_str(), phase.numCalls, phase.elapsedMs);
+        }
+        result += line;
+    }
+
+    return result;
+}
+
+bool StartupProfiler::IsCountingAllocations()
+{
+#ifdef ROSETTASTONE_COUNT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::size_t StartupProfiler::GetNumThreadAllocations() noexcept
+{
+    return t_numAllocations;
+}
+
+std::size_t StartupProfiler::GetThreadAllocatedBytes() noexcept
+{
+    return t_allocatedBytes;
+}
+
+void StartupProfiler::CountAllocation(std::size_t size) noexcept
+{
+    ++t_numAllocations;
+    t_allocatedBytes += size;
+}
+}  // namespace RosettaStone
+
+#ifdef ROSETTASTONE_COUNT_ALLOCATIONS
+// NOTE: Replaces the global allocation functions to count allocations of
+// startup phases. It affects every program that links the library, so it is
+// built only with the CMake option ROSETTASTONE_COUNT_ALLOCATIONS. It costs
+// two increments of thread_local counters per allocation.
+void* operator new(std::size_t size)
+{
+    RosettaStone::StartupProfiler::CountAllocation(size);
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, [[maybe_unused]] std::size_t size) noexcept
+{
+    std::free(ptr);
+}
+#endif  // ROSETTASTONE_COUNT_ALLOCATIONS
@@ -0,0 +1,75 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/ThreadPool.hpp>
+
+namespace RosettaStone
+{
+ThreadPool::ThreadPool(std::size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = GetHardwareConcurrency();
+    }
+
+    m_workers.reserve(numThreads);
+
+    for (std::size_t i = 0; i < numThreads; ++i)
+    {
+        m_workers.emplace_back([this]() { Run(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_condition.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+std::size_t ThreadPool::GetHardwareConcurrency()
+{
+    const unsigned int numThreads = std::thread::hardware_concurrency();
+    return numThreads == 0 ? 1 : static_cast<std::size_t>(numThreads);
+}
+
+std::size_t ThreadPool::GetNumThreads() const
+{
+    return m_workers.size();
+}
+
+void ThreadPool::Run()
+{
+    while (true)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock,
+                             [this]() { return m_stop || !m_tasks.empty(); });
+
+            if (m_stop && m_tasks.empty())
+            {
+                return;
+            }
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+
+        task();
+    }
+}
+}  // namespace RosettaStone
@@ -5,7 +5,6 @@
 
 #include <Rosetta/PlayMode/Actions/CastSpell.hpp>
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Models/Player.hpp>
 #include <Rosetta/PlayMode/Zones/GraveyardZone.hpp>
@@ -71,7 +70,8 @@ void CastSpell(Player* player, Spell* spell, Character* target, int chooseOne)
         if (spell->IsTwinspell())
         {
             const auto twinspell = Entity::GetFromCard(
-                player, Cards::FindCardByID(spell->card->id + "ts"));
+                player, player->game->GetCardDatabase().FindCardByID(
+                    spell->card->id + "ts"));
             AddCardToHand(player, twinspell);
 
             // If player has extra cast spell,
@@ -79,7 +79,8 @@ void CastSpell(Player* player, Spell* spell, Character* target, int chooseOne)
             if (player->ExtraCastSpell())
             {
                 const auto extraTwinspell = Entity::GetFromCard(
-                    player, Cards::FindCardByID(spell->card->id + "ts"));
+                    player, player->game->GetCardDatabase().FindCardByID(
+                        spell->card->id + "ts"));
                 AddCardToHand(player, extraTwinspell);
             }
         }
@@ -124,7 +125,8 @@ void CastRandomSpell(Player* player, Spell* spell, Character* target,
         if (spell->IsTwinspell())
         {
             const auto twinspell = Entity::GetFromCard(
-                player, Cards::FindCardByID(spell->card->id + "ts"));
+                player, player->game->GetCardDatabase().FindCardByID(
+                    spell->card->id + "ts"));
             AddCardToHand(player, twinspell);
         }
 
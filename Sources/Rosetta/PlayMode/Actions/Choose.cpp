@@ -8,7 +8,6 @@
 #include <Rosetta/PlayMode/Actions/Copy.hpp>
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
 #include <Rosetta/PlayMode/Actions/Summon.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/ITask.hpp>
 #include <Rosetta/PlayMode/Zones/DeckZone.hpp>
@@ -20,7 +19,7 @@
 
 #include <algorithm>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::Generic
 {
@@ -114,7 +113,7 @@ bool ChoicePick(Player* player, int choice)
                 "ChoicePick() - Invalid choice action!");
         case ChoiceAction::CHANGE_HERO_POWER:
         {
-            delete player->GetHero()->heroPower;
+            player->DeleteHeroPower();
             player->GetSetasideZone()->Remove(playable);
             playable->SetGameTag(GameTag::ZONE,
                                  static_cast<int>(ZoneType::PLAY));
@@ -284,8 +283,9 @@ bool ChoicePick(Player* player, int choice)
         {
             if (playable->card->id == "ULD_209t")
             {
-                std::vector<Card*> allCards = Cards::GetDiscoverCards(
-                    player->baseClass, player->game->GetFormatType());
+                std::vector<Card*> allCards =
+                    player->game->GetCardDatabase().GetDiscoverCards(
+                        player->baseClass, player->game->GetFormatType());
 
                 std::vector<Card*> spellCards;
                 for (auto& card : allCards)
@@ -7,7 +7,6 @@
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
 #include <Rosetta/PlayMode/Actions/PlayCard.hpp>
 #include <Rosetta/PlayMode/Actions/Summon.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Zones/DeckZone.hpp>
 #include <Rosetta/PlayMode/Zones/FieldZone.hpp>
@@ -61,7 +60,7 @@ void PlayCard(Player* player, Playable* source, Character* target, int fieldPos,
     {
         if (playable->HasCorrupt() && source->GetCost() > playable->GetCost())
         {
-            Card* newCard = Cards::FindCardByDbfID(
+            Card* newCard = player->game->GetCardDatabase().FindCardByDbfID(
                 playable->GetGameTag(GameTag::CORRUPTEDCARD));
             if (newCard && !newCard->name.empty())
             {
@@ -209,7 +208,8 @@ void PlayHero(Player* player, Hero* hero, Character* target, int chooseOne)
     player->GetSetasideZone()->Add(oldHero->heroPower);
     hero->weapon = oldHero->weapon;
     hero->heroPower = dynamic_cast<HeroPower*>(Entity::GetFromCard(
-        player, Cards::FindCardByDbfID(hero->GetGameTag(GameTag::HERO_POWER))));
+        player, player->game->GetCardDatabase().FindCardByDbfID(
+            hero->GetGameTag(GameTag::HERO_POWER))));
 
     player->SetHero(hero);
 
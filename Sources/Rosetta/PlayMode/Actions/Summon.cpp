@@ -4,7 +4,6 @@
 // Copyright (c) 2017-2021 Chris Ohk
 
 #include <Rosetta/PlayMode/Actions/Summon.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/SummonTask.hpp>
 #include <Rosetta/PlayMode/Zones/FieldZone.hpp>
@@ -84,7 +83,8 @@ void SummonAppendages(
     for (auto& appendage : appendages)
     {
         const auto appendageMinion = dynamic_cast<Minion*>(Entity::GetFromCard(
-            summoner->player, Cards::FindCardByID(std::get<0>(appendage)),
+            summoner->player, summoner->game->GetCardDatabase().FindCardByID(
+                std::get<0>(appendage)),
             std::nullopt, summoner->player->GetFieldZone()));
         int alternateCount = 0;
         const int summonPos = SummonTask::GetPosition(
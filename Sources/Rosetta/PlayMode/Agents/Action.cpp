@@ -0,0 +1,268 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Agents/Action.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Models/Choice.hpp>
+#include <Rosetta/PlayMode/Models/Hero.hpp>
+#include <Rosetta/PlayMode/Models/HeroPower.hpp>
+#include <Rosetta/PlayMode/Models/Minion.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/AttackTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/ChooseTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/EndTurnTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/HeroPowerTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/TradeCardTask.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+//! Calls \p func for each action that plays \p playable with a valid target.
+//! \param player The current player.
+//! \param playable The card or the hero power to play.
+//! \param chooseOne The option of a choose one card or 0.
+//! \param action The action that has the type and the index.
+//! \param func The function to call with each action.
+void ForEachPlayAction(Player* player, Playable* playable, int chooseOne,
+                       Action action,
+                       const std::function<void(const Action&)>& func)
+{
+    action.chooseOne = chooseOne;
+    bool hasTargets = false;
+
+    // NOTE: Characters are visited by index instead of building the list of
+    // GetValidPlayTargets().
+    for (int charIdx = 0; charIdx < NUM_CHARACTERS; ++charIdx)
+    {
+        Character* target = GetCharacter(player, charIdx);
+        if (!target || !playable->IsInValidPlayTargets(target))
+        {
+            continue;
+        }
+
+        hasTargets = true;
+        if (playable->IsValidPlayTarget(target, chooseOne))
+        {
+            action.target = charIdx;
+            func(action);
+        }
+    }
+
+    if (!hasTargets && playable->IsValidPlayTarget(nullptr, chooseOne))
+    {
+        func(action);
+    }
+}
+}  // namespace
+
+bool operator==(const Action& lhs, const Action& rhs)
+{
+    return lhs.type == rhs.type && lhs.index == rhs.index &&
+           lhs.target == rhs.target && lhs.position == rhs.position &&
+           lhs.chooseOne == rhs.chooseOne;
+}
+
+bool operator!=(const Action& lhs, const Action& rhs)
+{
+    return !(lhs == rhs);
+}
+
+Character* GetCharacter(Player* player, int charIdx)
+{
+    if (charIdx < 0 || charIdx >= NUM_CHARACTERS)
+    {
+        return nullptr;
+    }
+
+    Player* owner = charIdx <= MAX_FIELD_SIZE ? player : player->opponent;
+    const int pos = charIdx % (MAX_FIELD_SIZE + 1);
+
+    if (pos == 0)
+    {
+        return owner->GetHero();
+    }
+
+    FieldZone& field = *owner->GetFieldZone();
+    return pos <= field.GetCount() ? field[pos - 1] : nullptr;
+}
+
+int GetCharacterIndex(const Player* player, const Character* character)
+{
+    const int base = character->player == player ? 0 : MAX_FIELD_SIZE + 1;
+
+    if (character == character->player->GetHero())
+    {
+        return base;
+    }
+
+    return base + character->GetZonePosition() + 1;
+}
+
+void ForEachLegalAction(Game& game,
+                        const std::function<void(const Action&)>& func)
+{
+    Player* player = game.GetCurrentPlayer();
+
+    if (player->choice)
+    {
+        const int numChoices = static_cast<int>(player->choice->choices.size());
+        for (int i = 0; i < numChoices; ++i)
+        {
+            func(Action{ ActionType::CHOOSE, i });
+        }
+
+        return;
+    }
+
+    const bool isFieldFull = player->GetFieldZone()->IsFull();
+    const bool isDeckEmpty = player->GetDeckZone()->IsEmpty();
+    HandZone& hand = *player->GetHandZone();
+
+    for (int i = 0; i < hand.GetCount(); ++i)
+    {
+        Playable* playable = hand[i];
+
+        if (playable->HasTradeable() && !isDeckEmpty &&
+            player->GetRemainingMana() >= 1)
+        {
+            func(Action{ ActionType::TRADE_CARD, i });
+        }
+
+        if ((isFieldFull &&
+             playable->card->GetCardType() == CardType::MINION) ||
+            !playable->IsPlayableByPlayer())
+        {
+            continue;
+        }
+
+        const Action action{ ActionType::PLAY_CARD, i };
+        if (playable->HasChooseOne() && !player->ChooseBoth())
+        {
+            for (int chooseOne = 1; chooseOne <= 2; ++chooseOne)
+            {
+                if (playable->IsPlayableByCardReq(chooseOne))
+                {
+                    ForEachPlayAction(player, playable, chooseOne, action,
+                                      func);
+                }
+            }
+        }
+        else if (playable->IsPlayableByCardReq())
+        {
+            ForEachPlayAction(player, playable, 0, action, func);
+        }
+    }
+
+    for (int attacker = 0; attacker <= MAX_FIELD_SIZE; ++attacker)
+    {
+        Character* character = GetCharacter(player, attacker);
+        if (!character || !character->CanAttack())
+        {
+            continue;
+        }
+
+        for (int target = MAX_FIELD_SIZE + 1; target < NUM_CHARACTERS;
+             ++target)
+        {
+            Character* defender = GetCharacter(player, target);
+            if (defender &&
+                character->IsValidAttackTarget(player->opponent, defender))
+            {
+                func(Action{ ActionType::ATTACK, attacker, target });
+            }
+        }
+    }
+
+    if (HeroPower& power = player->GetHeroPower();
+        !power.IsExhausted() && power.IsPlayableByPlayer() &&
+        power.IsPlayableByCardReq())
+    {
+        ForEachPlayAction(player, &power, 0, Action{ ActionType::HERO_POWER },
+                          func);
+    }
+
+    func(Action{ ActionType::END_TURN });
+}
+
+std::vector<Action> GetLegalActions(Game& game)
+{
+    std::vector<Action> actions;
+    ForEachLegalAction(game, [&actions](const Action& action) {
+        actions.emplace_back(action);
+    });
+
+    return actions;
+}
+
+std::tuple<PlayState, PlayState> ApplyAction(Game& game, const Action& action)
+{
+    using namespace PlayerTasks;
+
+    Player* player = game.GetCurrentPlayer();
+    Playable* target = GetCharacter(player, action.target);
+
+    switch (action.type)
+    {
+        case ActionType::PLAY_CARD:
+        case ActionType::TRADE_CARD:
+        {
+            HandZone& hand = *player->GetHandZone();
+            if (action.index < 0 || action.index >= hand.GetCount())
+            {
+                throw std::invalid_argument("Invalid hand position");
+            }
+
+            if (action.type == ActionType::TRADE_CARD)
+            {
+                return game.Process(player, TradeCardTask(hand[action.index]));
+            }
+
+            return game.Process(
+                player, PlayCardTask(hand[action.index], target,
+                                     action.position, action.chooseOne));
+        }
+        case ActionType::ATTACK:
+        {
+            Character* attacker = action.index <= MAX_FIELD_SIZE
+                                      ? GetCharacter(player, action.index)
+                                      : nullptr;
+            if (!attacker || !target)
+            {
+                throw std::invalid_argument("Invalid attacker or defender");
+            }
+
+            return game.Process(player, AttackTask(attacker, target));
+        }
+        case ActionType::HERO_POWER:
+            return game.Process(player, HeroPowerTask(target));
+        case ActionType::CHOOSE:
+        {
+            if (!player->choice || action.index < 0 ||
+                action.index >=
+                    static_cast<int>(player->choice->choices.size()))
+            {
+                throw std::invalid_argument("Invalid choice");
+            }
+
+            return game.Process(
+                player,
+                ChooseTask::Pick(player,
+                                 player->choice->choices[action.index]));
+        }
+        case ActionType::END_TURN:
+            return game.Process(player, EndTurnTask());
+        default:
+            throw std::invalid_argument("Invalid action type");
+    }
+}
+}  // namespace RosettaStone::PlayMode
@@ -9,7 +9,7 @@
 
 #include <cassert>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode
 {
@@ -18,17 +18,13 @@ void RandomAgent::SetPlayerType(PlayerType playerType)
     m_playerType = playerType;
 }
 
-std::vector<int> RandomAgent::GetActionForMulligan(Game& state) const
+std::vector<int> RandomAgent::GetActionForMulligan(
+    const ObservationView& view) const
 {
-    assert(m_playerType == PlayerType::PLAYER1 ||
-           m_playerType == PlayerType::PLAYER2);
-
-    const Player* player = m_playerType == PlayerType::PLAYER1
-                               ? state.GetPlayer1()
-                               : state.GetPlayer2();
+    assert(view.GetPlayer().GetPlayerType() == m_playerType);
 
     std::vector<int> indices;
-    for (std::size_t i = 0; i < player->choice->choices.size(); ++i)
+    for (int i = 0; i < view.GetNumChoices(); ++i)
     {
         if (Random::get<std::size_t>(0, 1) == 1)
         {
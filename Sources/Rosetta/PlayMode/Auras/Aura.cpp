@@ -309,7 +309,7 @@ Aura::Aura(const Aura& prototype, Playable& owner)
       restless(prototype.restless),
       m_type(prototype.m_type),
       m_owner(&owner),
-      m_enchantmentCard(prototype.m_enchantmentCard),
+      m_enchantmentCard(owner.game->FindCard(prototype.m_enchantmentCard)),
       m_effects(prototype.m_effects),
       m_turnOn(prototype.m_turnOn)
 {
@@ -51,7 +51,8 @@ void BlackTempleCardsGen::AddHeroPowers(std::map<std::string, CardDef>& cards)
             Player* player = playable->player;
 
             const int dbfID = player->GetGameTag(GameTag::HERO_POWER_OLD);
-            const auto heroPowerCard = Cards::FindCardByDbfID(dbfID);
+            const auto heroPowerCard =
+                player->game->GetCardDatabase().FindCardByDbfID(dbfID);
 
             const auto& changeHeroPowerTask =
                 std::make_shared<ChangeHeroPowerTask>(heroPowerCard->id);
@@ -177,11 +177,14 @@ void DalaranCardsGen::AddDruid(std::map<std::string, CardDef>& cards)
             const std::shared_ptr<IEffect> costEffect =
                 Cost::Effect(EffectOperator::SET, target->card->GetCost());
 
+            const CardDatabase& cardDatabase =
+                player->game->GetCardDatabase();
+
             for (auto& chooseCardID : target->card->chooseCardIDs)
             {
                 const auto chooseCard = Entity::GetFromCard(
-                    player, Cards::FindCardByID(chooseCardID), std::nullopt,
-                    player->GetSetasideZone());
+                    player, cardDatabase.FindCardByID(chooseCardID),
+                    std::nullopt, player->GetSetasideZone());
                 const auto copy =
                     Generic::Copy(player, chooseCard, ZoneType::HAND);
                 costEffect->ApplyTo(copy);
@@ -1012,8 +1015,8 @@ void DalaranCardsGen::AddPaladin(std::map<std::string, CardDef>& cards)
 
             auto allCards =
                 player->game->GetFormatType() == FormatType::STANDARD
-                    ? Cards::GetAllStandardCards()
-                    : Cards::GetAllWildCards();
+                    ? player->game->GetCardDatabase().GetAllStandardCards()
+                    : player->game->GetCardDatabase().GetAllWildCards();
 
             std::vector<Card*> secrets;
             for (auto& card : allCards)
@@ -1251,8 +1254,8 @@ void DalaranCardsGen::AddPaladinNonCollect(
 
             auto allCards =
                 player->game->GetFormatType() == FormatType::STANDARD
-                    ? Cards::GetAllStandardCards()
-                    : Cards::GetAllWildCards();
+                    ? player->game->GetCardDatabase().GetAllStandardCards()
+                    : player->game->GetCardDatabase().GetAllWildCards();
 
             std::vector<Card*> secrets;
             for (auto& card : allCards)
@@ -2032,9 +2035,10 @@ void DalaranCardsGen::AddShaman(std::map<std::string, CardDef>& cards)
                     GameTag::TAG_SCRIPT_DATA_ENT_2,
                     source->GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2));
 
-                Playable* horror =
-                    Entity::GetFromCard(player, Cards::FindCardByID("DAL_431t"),
-                                        tags, player->GetHandZone());
+                Card* horrorCard =
+                    player->game->GetCardDatabase().FindCardByID("DAL_431t");
+                Playable* horror = Entity::GetFromCard(
+                    player, horrorCard, tags, player->GetHandZone());
                 Generic::AddCardToHand(player, horror);
             }
         }));
@@ -2128,17 +2132,20 @@ void DalaranCardsGen::AddShamanNonCollect(std::map<std::string, CardDef>& cards)
     cardDef.ClearData();
     cardDef.power.AddPowerTask(std::make_shared<CustomTask>(
         [](Player* player, const Entity* source, Playable* target) {
+            const CardDatabase& cardDatabase =
+                player->game->GetCardDatabase();
+
             const int dbfID1 =
                 source->GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_1);
-            Playable* playable1 =
-                Entity::GetFromCard(player, Cards::FindCardByDbfID(dbfID1));
+            Playable* playable1 = Entity::GetFromCard(
+                player, cardDatabase.FindCardByDbfID(dbfID1));
             Generic::CastSpell(player, dynamic_cast<Spell*>(playable1),
                                dynamic_cast<Character*>(target), 0);
 
             const int dbfID2 =
                 source->GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2);
-            Playable* playable2 =
-                Entity::GetFromCard(player, Cards::FindCardByDbfID(dbfID2));
+            Playable* playable2 = Entity::GetFromCard(
+                player, cardDatabase.FindCardByDbfID(dbfID2));
             Generic::CastSpell(player, dynamic_cast<Spell*>(playable2),
                                dynamic_cast<Character*>(target), 0);
         }));
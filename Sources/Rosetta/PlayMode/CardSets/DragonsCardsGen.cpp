@@ -550,6 +550,8 @@ void DragonsCardsGen::AddDruid(std::map<std::string, CardDef>& cards)
         std::make_shared<CustomTask>([](const Player* player, Entity* source,
                                         [[maybe_unused]] Playable* target) {
             const auto deckCards = player->GetDeckZone()->GetAll();
+            Card* enchantCard =
+                player->game->GetCardDatabase().FindCardByID("DRG_315e2");
 
             for (auto& deckCard : deckCards)
             {
@@ -560,7 +562,7 @@ void DragonsCardsGen::AddDruid(std::map<std::string, CardDef>& cards)
 
                 if (deckCard->GetCost() < 10)
                 {
-                    Generic::AddEnchantment(Cards::FindCardByID("DRG_315e2"),
+                    Generic::AddEnchantment(enchantCard,
                                             dynamic_cast<Playable*>(source),
                                             deckCard, 0, 0, 0);
                 }
@@ -180,7 +180,8 @@ void LegacyCardsGen::AddHeroPowers(std::map<std::string, CardDef>& cards)
 
                 if (!exist)
                 {
-                    totemCards.emplace_back(Cards::FindCardByID(id));
+                    totemCards.emplace_back(
+                        playable->game->GetCardDatabase().FindCardByID(id));
                 }
             }
 
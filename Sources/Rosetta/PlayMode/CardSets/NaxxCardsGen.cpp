@@ -534,7 +534,8 @@ void NaxxCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
             if (isFeugenDead && !player->GetFieldZone()->IsFull())
             {
                 const auto thaddius = Entity::GetFromCard(
-                    player, Cards::FindCardByID("FP1_014t"));
+                    player,
+                    player->game->GetCardDatabase().FindCardByID("FP1_014t"));
                 Generic::Summon(dynamic_cast<Minion*>(thaddius), -1, playable);
             }
 
@@ -583,7 +584,8 @@ void NaxxCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
             if (isFeugenDead && !player->GetFieldZone()->IsFull())
             {
                 const auto thaddius = Entity::GetFromCard(
-                    player, Cards::FindCardByID("FP1_014t"));
+                    player,
+                    player->game->GetCardDatabase().FindCardByID("FP1_014t"));
                 Generic::Summon(dynamic_cast<Minion*>(thaddius), -1, playable);
             }
 
@@ -2186,9 +2186,10 @@ void ScholomanceCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
                 const int entityID =
                     selectedMinions[i]->GetGameTag(GameTag::ENTITY_ID);
 
-                Generic::AddEnchantment(Cards::FindCardByID("SCH_162e"),
-                                        dynamic_cast<Playable*>(source),
-                                        whelps[i], entityID, 0, entityID);
+                Generic::AddEnchantment(
+                    player->game->GetCardDatabase().FindCardByID("SCH_162e"),
+                    dynamic_cast<Playable*>(source), whelps[i], entityID, 0,
+                    entityID);
             }
         }));
     cards.emplace("SCH_162", cardDef);
@@ -2338,11 +2339,12 @@ void ScholomanceCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
             if (!deckZone->IsEmpty())
             {
                 TaskStack& stack = player->game->taskStack;
+                Card* cardToDiscover =
+                    player->game->GetCardDatabase().FindCardByID("SCH_259t");
 
                 stack.AddPlayables(
                     { deckZone->GetTopCard(),
-                      Entity::GetFromCard(player,
-                                          Cards::FindCardByID("SCH_259t")) });
+                      Entity::GetFromCard(player, cardToDiscover) });
 
                 const auto& discoverTask = std::make_shared<DiscoverTask>(
                     DiscoverType::FROM_STACK, 2, 1, false);
@@ -2579,15 +2581,16 @@ void ScholomanceCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
             Card* leftInchantmentCard;
             Card* rightInchantmentCard;
 
+            const CardDatabase& cardDatabase = player->game->GetCardDatabase();
             if (leftDbfID == chosen->card->dbfID)
             {
-                leftInchantmentCard = Cards::FindCardByID("SCH_351a");
-                rightInchantmentCard = Cards::FindCardByID("SCH_351b");
+                leftInchantmentCard = cardDatabase.FindCardByID("SCH_351a");
+                rightInchantmentCard = cardDatabase.FindCardByID("SCH_351b");
             }
             else
             {
-                leftInchantmentCard = Cards::FindCardByID("SCH_351b");
-                rightInchantmentCard = Cards::FindCardByID("SCH_351a");
+                leftInchantmentCard = cardDatabase.FindCardByID("SCH_351b");
+                rightInchantmentCard = cardDatabase.FindCardByID("SCH_351a");
             }
 
             Generic::AddEnchantment(leftInchantmentCard,
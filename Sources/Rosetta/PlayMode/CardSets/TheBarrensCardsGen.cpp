@@ -2192,19 +2192,22 @@ void TheBarrensCardsGen::AddShaman(std::map<std::string, CardDef>& cards)
     cardDef.power.AddPowerTask(
         std::make_shared<CustomTask>([](const Player* player, Entity* source,
                                         [[maybe_unused]] Playable* target) {
+            const CardDatabase& cardDatabase =
+                player->game->GetCardDatabase();
+
             for (const auto& minion : player->GetFieldZone()->GetAll())
             {
                 if (minion->card->GetRace() == Race::MURLOC)
                 {
-                    Generic::AddEnchantment(Cards::FindCardByID("BAR_041e2"),
-                                            dynamic_cast<Playable*>(source),
-                                            minion);
+                    Generic::AddEnchantment(
+                        cardDatabase.FindCardByID("BAR_041e2"),
+                        dynamic_cast<Playable*>(source), minion);
                 }
                 else
                 {
-                    Generic::AddEnchantment(Cards::FindCardByID("BAR_041e"),
-                                            dynamic_cast<Playable*>(source),
-                                            minion);
+                    Generic::AddEnchantment(
+                        cardDatabase.FindCardByID("BAR_041e"),
+                        dynamic_cast<Playable*>(source), minion);
                 }
             }
         }));
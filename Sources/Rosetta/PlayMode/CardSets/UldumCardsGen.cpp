@@ -1578,11 +1578,13 @@ void UldumCardsGen::AddRogue(std::map<std::string, CardDef>& cards)
             std::map<GameTag, int> tags;
             tags.emplace(GameTag::TAG_SCRIPT_DATA_NUM_1, target->card->dbfID);
 
+            Card* shadowCard =
+                player->game->GetCardDatabase().FindCardByID("ULD_286t");
+
             for (int i = 0; i < 3; i++)
             {
-                Playable* shadow =
-                    Entity::GetFromCard(player, Cards::FindCardByID("ULD_286t"),
-                                        tags, player->GetDeckZone());
+                Playable* shadow = Entity::GetFromCard(
+                    player, shadowCard, tags, player->GetDeckZone());
                 Generic::ShuffleIntoDeck(player, source, shadow);
             }
         }));
@@ -1724,8 +1726,8 @@ void UldumCardsGen::AddRogueNonCollect(std::map<std::string, CardDef>& cards)
                                         [[maybe_unused]] Playable* target) {
             const int dbfID =
                 source->GetGameTag(GameTag::TAG_SCRIPT_DATA_NUM_1);
-            Playable* minion =
-                Entity::GetFromCard(player, Cards::FindCardByDbfID(dbfID));
+            Playable* minion = Entity::GetFromCard(
+                player, player->game->GetCardDatabase().FindCardByDbfID(dbfID));
             Generic::Summon(dynamic_cast<Minion*>(minion), -1, player);
         }));
     cardDef.power.AddPowerTask(
@@ -1733,8 +1735,8 @@ void UldumCardsGen::AddRogueNonCollect(std::map<std::string, CardDef>& cards)
                                         [[maybe_unused]] Playable* target) {
             const int dbfID =
                 source->GetGameTag(GameTag::TAG_SCRIPT_DATA_NUM_1);
-            Playable* minion =
-                Entity::GetFromCard(player, Cards::FindCardByDbfID(dbfID));
+            Playable* minion = Entity::GetFromCard(
+                player, player->game->GetCardDatabase().FindCardByDbfID(dbfID));
             Generic::Summon(dynamic_cast<Minion*>(minion), -1, player);
         }));
     cards.emplace("ULD_286t", cardDef);
@@ -2614,13 +2616,15 @@ void UldumCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
            [[maybe_unused]] Playable* target) {
             const int dbfID1 =
                 source->GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_1);
-            Generic::AddEnchantment(Cards::FindCardByDbfID(dbfID1),
-                                    dynamic_cast<Playable*>(source), source);
+            Generic::AddEnchantment(
+                player->game->GetCardDatabase().FindCardByDbfID(dbfID1),
+                dynamic_cast<Playable*>(source), source);
 
             const int dbfID2 =
                 source->GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2);
-            Generic::AddEnchantment(Cards::FindCardByDbfID(dbfID2),
-                                    dynamic_cast<Playable*>(source), source);
+            Generic::AddEnchantment(
+                player->game->GetCardDatabase().FindCardByDbfID(dbfID2),
+                dynamic_cast<Playable*>(source), source);
         }));
     cards.emplace("ULD_178", cardDef);
 
@@ -14,6 +14,46 @@
 
 namespace RosettaStone::PlayMode
 {
+namespace
+{
+//! The kinds of characters that a targeting type includes.
+struct TargetingFlags
+{
+    bool friendlyMinions = false;
+    bool enemyMinions = false;
+    bool hero = false;
+    bool enemyHero = false;
+};
+
+//! Returns the kinds of characters that \p targetingType includes.
+//! \param targetingType The targeting type of a card.
+//! \return The kinds of characters that can be targeted.
+TargetingFlags GetTargetingFlags(TargetingType targetingType)
+{
+    switch (targetingType)
+    {
+        case TargetingType::ALL:
+            return { true, true, true, true };
+        case TargetingType::CHARACTERS_EXCEPT_HERO:
+            return { true, true, false, true };
+        case TargetingType::FRIENDLY_CHARACTERS:
+            return { true, false, true, false };
+        case TargetingType::ENEMY_CHARACTERS:
+            return { false, true, false, true };
+        case TargetingType::ALL_MINIONS:
+            return { true, true, false, false };
+        case TargetingType::FRIENDLY_MINIONS:
+            return { true, false, false, false };
+        case TargetingType::ENEMY_MINIONS:
+            return { false, true, false, false };
+        case TargetingType::HEROES:
+            return { false, false, true, true };
+        default:
+            return {};
+    }
+}
+}  // namespace
+
 void Card::Initialize()
 {
     maxAllowedInDeck = (GetRarity() == Rarity::LEGENDARY) ? 1 : 2;
@@ -621,80 +661,32 @@ std::vector<Character*> Card::GetValidPlayTargets(Player* player)
 {
     std::vector<Character*> ret;
 
-    if (!targetingAvailabilityPredicate.empty())
+    if (!IsTargetingAvailable(player))
     {
-        for (auto& predicate : targetingAvailabilityPredicate)
-        {
-            if (!predicate(player, this))
-            {
-                return ret;
-            }
-        }
+        return ret;
     }
 
-    bool friendlyMinions = false, enemyMinions = false;
-    bool hero = false, enemyHero = false;
-
-    switch (targetingType)
-    {
-        case TargetingType::NONE:
-            // If this is a non-targeting card, return an empty list
-            return ret;
-        case TargetingType::ALL:
-            friendlyMinions = true;
-            enemyMinions = true;
-            hero = true;
-            enemyHero = true;
-            break;
-        case TargetingType::CHARACTERS_EXCEPT_HERO:
-            friendlyMinions = true;
-            enemyMinions = true;
-            enemyHero = true;
-            break;
-        case TargetingType::FRIENDLY_CHARACTERS:
-            friendlyMinions = true;
-            hero = true;
-            break;
-        case TargetingType::ENEMY_CHARACTERS:
-            enemyMinions = true;
-            enemyHero = true;
-            break;
-        case TargetingType::ALL_MINIONS:
-            friendlyMinions = true;
-            enemyMinions = true;
-            break;
-        case TargetingType::FRIENDLY_MINIONS:
-            friendlyMinions = true;
-            break;
-        case TargetingType::ENEMY_MINIONS:
-            enemyMinions = true;
-            break;
-        case TargetingType::HEROES:
-            hero = true;
-            enemyHero = true;
-            break;
-    }
+    const auto [friendlyMinions, enemyMinions, hero, enemyHero] =
+        GetTargetingFlags(targetingType);
 
     if (friendlyMinions)
     {
-        for (auto& minion : player->GetFieldZone()->GetAll())
-        {
+        player->GetFieldZone()->ForEach([&](Minion* minion) {
             if (TargetingRequirements(player, minion))
             {
                 ret.emplace_back(minion);
             }
-        }
+        });
     }
 
     if (enemyMinions)
     {
-        for (auto& minion : player->opponent->GetFieldZone()->GetAll())
-        {
+        player->opponent->GetFieldZone()->ForEach([&](Minion* minion) {
             if (TargetingRequirements(player, minion))
             {
                 ret.emplace_back(minion);
             }
-        }
+        });
     }
 
     if (hero)
@@ -715,4 +707,38 @@ std::vector<Character*> Card::GetValidPlayTargets(Player* player)
 
     return ret;
 }
+
+bool Card::IsInValidPlayTargets(Player* player, Character* target)
+{
+    if (!IsTargetingAvailable(player))
+    {
+        return false;
+    }
+
+    const auto [friendlyMinions, enemyMinions, hero, enemyHero] =
+        GetTargetingFlags(targetingType);
+    const bool isFriendly = target->player == player;
+    const bool isHero = target == target->player->GetHero();
+
+    if (isHero ? (isFriendly ? !hero : !enemyHero)
+               : (isFriendly ? !friendlyMinions : !enemyMinions))
+    {
+        return false;
+    }
+
+    return TargetingRequirements(player, target);
+}
+
+bool Card::IsTargetingAvailable(Player* player)
+{
+    for (auto& predicate : targetingAvailabilityPredicate)
+    {
+        if (!predicate(player, this))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
 }  // namespace RosettaStone::PlayMode
@@ -0,0 +1,605 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/StartupProfiler.hpp>
+#include <Rosetta/Common/Utils.hpp>
+#include <Rosetta/PlayMode/Cards/CardDatabase.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Loaders/CardImage.hpp>
+#include <Rosetta/PlayMode/Loaders/CardLoader.hpp>
+#include <Rosetta/PlayMode/Loaders/InternalCardLoader.hpp>
+
+namespace RosettaStone::PlayMode
+{
+Card emptyCard;
+
+void CardDatabase::Load(const std::string& path, const CardDatabase* base,
+                        ThreadPool* pool)
+{
+    std::vector<Card*> cards;
+
+    {
+        StartupProfiler::ScopedPhase phase("CardLoader::Load");
+        CardLoader::Load(path, cards, pool);
+    }
+
+    Build(cards, base, pool);
+}
+
+void CardDatabase::Load(const CardImage& image, const CardDatabase* base,
+                        ThreadPool* pool)
+{
+    std::vector<Card*> cards;
+
+    {
+        StartupProfiler::ScopedPhase phase("CardImage::Load");
+        image.Load(cards);
+    }
+
+    Build(cards, base, pool);
+}
+
+std::size_t CardDatabase::GetNumSharedCards() const
+{
+    return m_numSharedCards;
+}
+
+std::uint64_t CardDatabase::GetVersion() const
+{
+    return m_version;
+}
+
+const std::vector<Card*>& CardDatabase::GetAllCards() const
+{
+    return m_cards;
+}
+
+const std::vector<Card*>& CardDatabase::GetStandardCards(
+    CardClass cardClass) const
+{
+    // NOTE: Subtract 2 because of CardClass::DRUID = 2
+    return m_standardCards[static_cast<int>(cardClass) - 2];
+}
+
+const std::vector<Card*>& CardDatabase::GetWildCards(CardClass cardClass) const
+{
+    // NOTE: Subtract 2 because of CardClass::DRUID = 2
+    return m_wildCards[static_cast<int>(cardClass) - 2];
+}
+
+const std::vector<Card*>& CardDatabase::GetAllStandardCards() const
+{
+    return m_allStandardCards;
+}
+
+const std::vector<Card*>& CardDatabase::GetAllWildCards() const
+{
+    return m_allWildCards;
+}
+
+const std::vector<Card*> CardDatabase::GetDiscoverCards(
+    CardClass baseClass, FormatType format) const
+{
+    std::vector<Card*> result;
+
+    // NOTE: Assume there is no card that has 'CardType::SPELL' and
+    // 'CardClass::NEUTRAL'.
+    if (format == FormatType::STANDARD)
+    {
+        for (const auto& card : GetAllStandardCards())
+        {
+            if ((card->IsCardClass(baseClass) && !card->IsQuest() &&
+                 card->GetCardType() != CardType::HERO) ||
+                (card->GetCardType() != CardType::SPELL &&
+                 card->GetCardClass() == CardClass::NEUTRAL))
+            {
+                result.emplace_back(card);
+            }
+        }
+    }
+    else
+    {
+        for (const auto& card : GetAllWildCards())
+        {
+            if ((card->IsCardClass(baseClass) && !card->IsQuest() &&
+                 card->GetCardType() != CardType::HERO) ||
+                (card->GetCardType() != CardType::SPELL &&
+                 card->GetCardClass() == CardClass::NEUTRAL))
+            {
+                result.emplace_back(card);
+            }
+        }
+    }
+
+    return result;
+}
+
+std::vector<Card*> CardDatabase::GetBasicTotems() const
+{
+    return m_basicTotems;
+}
+
+std::vector<Card*> CardDatabase::GetLackeys() const
+{
+    return m_lackeys;
+}
+
+std::vector<Card*> CardDatabase::GetPoisons() const
+{
+    return m_poisons;
+}
+
+Card* CardDatabase::FindCardByID(const std::string_view& id) const
+{
+    const auto iter = m_cardsByID.find(id);
+    return iter != m_cardsByID.end() ? m_cards[iter->second] : &emptyCard;
+}
+
+Card* CardDatabase::FindCardByDbfID(int dbfID) const
+{
+    const auto iter = m_cardsByDbfID.find(dbfID);
+    return iter != m_cardsByDbfID.end() ? m_cards[iter->second] : &emptyCard;
+}
+
+std::vector<Card*> CardDatabase::FindCardByRarity(Rarity rarity) const
+{
+    std::vector<Card*> result;
+
+    for (Card* card : m_cards)
+    {
+        if (card->GetRarity() == rarity)
+        {
+            result.emplace_back(card);
+        }
+    }
+
+    return result;
+}
+
+std::vector<Card*> CardDatabase::FindCardByClass(CardClass cardClass) const
+{
+    std::vector<Card*> result;
+
+    for (Card* card : m_cards)
+    {
+        if (card->GetCardClass() == cardClass)
+        {
+            result.emplace_back(card);
+        }
+    }
+
+    return result;
+}
+
+std::vector<Card*> CardDatabase::FindCardBySet(CardSet cardSet) const
+{
+    std::vector<Card*> result;
+
+    for (Card* card : m_cards)
+    {
+        if (card->GetCardSet() == cardSet)
+        {
+            result.emplace_back(card);
+        }
+    }
+
+    return result;
+}
+
+std::vector<Card*> CardDatabase::FindCardByType(CardType cardType) const
+{
+    std::vector<Card*> result;
+
+    for (Card* card : m_cards)
+    {
+        if (card->GetCardType() == cardType)
+        {
+            result.emplace_back(card);
+        }
+    }
+
+    return result;
+}
+
+std::vector<Card*> CardDatabase::FindCardByRace(Race race) const
+{
+    std::vector<Card*> result;
+
+    for (Card* card : m_cards)
+    {
+        if (card->GetRace() == race)
+        {
+            result.emplace_back(card);
+        }
+    }
+
+    return result;
+}
+
+Card* CardDatabase::FindCardByName(const std::string_view& name,
+                                   FormatType format) const
+{
+    std::vector<Card*> cards;
+
+    switch (format)
+    {
+        case FormatType::STANDARD:
+            cards = m_allStandardCards;
+            break;
+        case FormatType::WILD:
+            cards = m_allWildCards;
+            break;
+        case FormatType::CLASSIC:
+            cards = m_allClassicCards;
+            break;
+        case FormatType::UNKNOWN:
+            break;
+    }
+
+    for (Card* card : cards)
+    {
+        if (card->name == name && card->IsCollectible())
+        {
+            return card;
+        }
+    }
+
+    return &emptyCard;
+}
+
+std::vector<Card*> CardDatabase::FindCardByCost(int minVal, int maxVal) const
+{
+    std::vector<Card*> result;
+
+    for (Card* card : m_cards)
+    {
+        if (card->gameTags.at(GameTag::COST) >= minVal &&
+            card->gameTags.at(GameTag::COST) <= maxVal)
+        {
+            result.emplace_back(card);
+        }
+    }
+
+    return result;
+}
+
+std::vector<Card*> CardDatabase::FindCardByAttack(int minVal, int maxVal) const
+{
+    std::vector<Card*> result;
+
+    for (Card* card : m_cards)
+    {
+        if (!(card->GetCardType() == CardType::MINION) &&
+            !(card->GetCardType() == CardType::WEAPON))
+        {
+            continue;
+        }
+
+        if (card->gameTags.at(GameTag::ATK) >= minVal &&
+            card->gameTags.at(GameTag::ATK) <= maxVal)
+        {
+            result.emplace_back(card);
+        }
+    }
+
+    return result;
+}
+
+std::vector<Card*> CardDatabase::FindCardByHealth(int minVal, int maxVal) const
+{
+    std::vector<Card*> result;
+
+    for (Card* card : m_cards)
+    {
+        if (!(card->GetCardType() == CardType::MINION) &&
+            !(card->GetCardType() == CardType::HERO))
+        {
+            continue;
+        }
+
+        if (card->gameTags.at(GameTag::HEALTH) >= minVal &&
+            card->gameTags.at(GameTag::HEALTH) <= maxVal)
+        {
+            result.emplace_back(card);
+        }
+    }
+
+    return result;
+}
+
+std::vector<Card*> CardDatabase::FindCardBySpellPower(int minVal,
+                                                     int maxVal) const
+{
+    std::vector<Card*> result;
+
+    for (Card* card : m_cards)
+    {
+        if (card->gameTags.find(GameTag::SPELLPOWER) == card->gameTags.end())
+        {
+            continue;
+        }
+
+        if (card->gameTags.at(GameTag::SPELLPOWER) >= minVal &&
+            card->gameTags.at(GameTag::SPELLPOWER) <= maxVal)
+        {
+            result.emplace_back(card);
+        }
+    }
+
+    return result;
+}
+
+std::vector<Card*> CardDatabase::FindCardByGameTag(
+    std::vector<GameTag> gameTags) const
+{
+    std::vector<Card*> result;
+
+    for (auto& card : m_cards)
+    {
+        auto cardGameTags = card->gameTags;
+
+        for (const auto gameTag : gameTags)
+        {
+            if (cardGameTags.find(gameTag) != cardGameTags.end())
+            {
+                result.emplace_back(card);
+            }
+        }
+    }
+
+    return result;
+}
+
+Card* CardDatabase::GetHeroCard(CardClass cardClass) const
+{
+    switch (cardClass)
+    {
+        case CardClass::DRUID:
+            return FindCardByID("HERO_06");
+        case CardClass::HUNTER:
+            return FindCardByID("HERO_05");
+        case CardClass::MAGE:
+            return FindCardByID("HERO_08");
+        case CardClass::PALADIN:
+            return FindCardByID("HERO_04");
+        case CardClass::PRIEST:
+            return FindCardByID("HERO_09");
+        case CardClass::ROGUE:
+            return FindCardByID("HERO_03");
+        case CardClass::SHAMAN:
+            return FindCardByID("HERO_02");
+        case CardClass::WARLOCK:
+            return FindCardByID("HERO_07");
+        case CardClass::WARRIOR:
+            return FindCardByID("HERO_01");
+        case CardClass::DEMONHUNTER:
+            return FindCardByID("HERO_10");
+        default:
+            return &emptyCard;
+    }
+}
+
+Card* CardDatabase::GetDefaultHeroPower(CardClass cardClass) const
+{
+    switch (cardClass)
+    {
+        case CardClass::DRUID:
+            return FindCardByID("HERO_06bp");
+        case CardClass::HUNTER:
+            return FindCardByID("HERO_05bp");
+        case CardClass::MAGE:
+            return FindCardByID("HERO_08bp");
+        case CardClass::PALADIN:
+            return FindCardByID("HERO_04bp");
+        case CardClass::PRIEST:
+            return FindCardByID("HERO_09bp");
+        case CardClass::ROGUE:
+            return FindCardByID("HERO_03bp");
+        case CardClass::SHAMAN:
+            return FindCardByID("HERO_02bp");
+        case CardClass::WARLOCK:
+            return FindCardByID("HERO_07bp");
+        case CardClass::WARRIOR:
+            return FindCardByID("HERO_01bp");
+        case CardClass::DEMONHUNTER:
+            return FindCardByID("HERO_10bp");
+        default:
+            return &emptyCard;
+    }
+}
+
+void CardDatabase::Build(std::vector<Card*>& cards, const CardDatabase* base,
+                         ThreadPool* pool)
+{
+    // NOTE: Powers of CardDefs find cards of the default database when they
+    // are created, so the default database must be loaded first.
+    if (this != &Cards::GetDatabase())
+    {
+        Cards::GetInstance();
+    }
+
+    m_records.clear();
+    m_records.reserve(cards.size());
+
+    for (Card* card : cards)
+    {
+        m_records.emplace_back(card);
+    }
+
+    m_cards = cards;
+    m_numSharedCards = 0;
+
+    // NOTE: The indices are built before loading powers because powers of
+    // the default database find its cards while they are created.
+    BuildIndices();
+
+    {
+        StartupProfiler::ScopedPhase phase("InternalCardLoader::Load");
+        InternalCardLoader::Load(m_cards);
+    }
+
+    {
+        StartupProfiler::ScopedPhase phase("Card::Initialize");
+
+        // NOTE: Initialize() only changes the card itself.
+        if (pool != nullptr && pool->GetNumThreads() > 1)
+        {
+            StartupProfiler::WorkerAllocations workerAllocations;
+
+            pool->ParallelFor(m_cards.size(), [&](std::size_t idx) {
+                workerAllocations.Run([&] { m_cards[idx]->Initialize(); });
+            });
+
+            workerAllocations.AddToCurrentThread();
+        }
+        else
+        {
+            for (Card* card : m_cards)
+            {
+                card->Initialize();
+            }
+        }
+    }
+
+    if (base != nullptr)
+    {
+        StartupProfiler::ScopedPhase phase("Share cards");
+
+        for (std::size_t i = 0; i < m_records.size(); ++i)
+        {
+            const Card* card = m_cards[i];
+            const auto iter = base->m_cardsByDbfID.find(card->dbfID);
+
+            if (iter == base->m_cardsByDbfID.end())
+            {
+                continue;
+            }
+
+            const auto& baseRecord = base->m_records[iter->second];
+
+            if (baseRecord->id == card->id && baseRecord->name == card->name &&
+                baseRecord->text == card->text &&
+                baseRecord->gameTags == card->gameTags)
+            {
+                m_records[i] = baseRecord;
+                m_cards[i] = baseRecord.get();
+                ++m_numSharedCards;
+            }
+        }
+
+        BuildIndices();
+    }
+
+    StartupProfiler::ScopedPhase phase("Build card lists");
+    BuildCardLists();
+    BuildVersion();
+}
+
+void CardDatabase::BuildIndices()
+{
+    m_cardsByID.clear();
+    m_cardsByDbfID.clear();
+    m_cardsByID.reserve(m_cards.size());
+    m_cardsByDbfID.reserve(m_cards.size());
+
+    // NOTE: emplace() keeps the first card of duplicated keys, which is the
+    // card that the linear search found.
+    for (std::size_t i = 0; i < m_cards.size(); ++i)
+    {
+        m_cardsByID.emplace(m_cards[i]->id, i);
+        m_cardsByDbfID.emplace(m_cards[i]->dbfID, i);
+    }
+}
+
+void CardDatabase::BuildCardLists()
+{
+    for (auto& cards : m_standardCards)
+    {
+        cards.clear();
+    }
+    for (auto& cards : m_wildCards)
+    {
+        cards.clear();
+    }
+    m_allStandardCards.clear();
+    m_allWildCards.clear();
+    m_allClassicCards.clear();
+    m_basicTotems.clear();
+    m_lackeys.clear();
+    m_poisons.clear();
+
+    for (Card* card : m_cards)
+    {
+        // NOTE: Subtract 2 because of CardClass::DRUID = 2
+        // NOTE: CardClass::DEMONHUNTER = 14
+        const auto cardClass = card->GetCardClass() == CardClass::DEMONHUNTER
+                                   ? static_cast<int>(card->GetCardClass()) - 5
+                                   : static_cast<int>(card->GetCardClass()) - 2;
+
+        if (card->IsCollectible())
+        {
+            if (card->IsStandardSet())
+            {
+                if (card->GetCardClass() != CardClass::NEUTRAL)
+                {
+                    m_standardCards[cardClass].emplace_back(card);
+                }
+                m_allStandardCards.emplace_back(card);
+            }
+
+            if (card->IsWildSet())
+            {
+                if (card->GetCardClass() != CardClass::NEUTRAL)
+                {
+                    m_wildCards[cardClass].emplace_back(card);
+                }
+                m_allWildCards.emplace_back(card);
+            }
+
+            // NOTE: Duplicated name 'Shadow Bolt' (Story_09_Shadowbolt) exists!
+            if (card->IsClassicSet() && card->dbfID != 75913)
+            {
+                m_allClassicCards.emplace_back(card);
+            }
+        }
+
+        if (card->IsBasicTotem())
+        {
+            m_basicTotems.emplace_back(card);
+        }
+
+        if (card->IsLackey())
+        {
+            m_lackeys.emplace_back(card);
+        }
+
+        if (card->IsPoison())
+        {
+            m_poisons.emplace_back(card);
+        }
+    }
+}
+
+void CardDatabase::BuildVersion()
+{
+    m_version = HASH_OFFSET_BASIS;
+
+    for (const Card* card : m_cards)
+    {
+        m_version = HashCombine(m_version, card->id);
+        m_version =
+            HashCombine(m_version, static_cast<std::uint64_t>(card->dbfID));
+
+        for (const auto& [tag, value] : card->gameTags)
+        {
+            m_version =
+                HashCombine(m_version, static_cast<std::uint64_t>(tag));
+            m_version =
+                HashCombine(m_version, static_cast<std::uint64_t>(value));
+        }
+    }
+}
+}  // namespace RosettaStone::PlayMode
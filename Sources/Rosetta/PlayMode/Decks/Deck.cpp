@@ -8,6 +8,7 @@
 #include <Rosetta/PlayMode/Decks/Deck.hpp>
 
 #include <algorithm>
+#include <utility>
 
 namespace RosettaStone::PlayMode
 {
@@ -60,13 +61,19 @@ std::pair<std::string, std::size_t> Deck::GetCard(std::size_t idx) const
 }
 
 std::array<Card*, START_DECK_SIZE> Deck::GetCards() const
+{
+    return GetCards(Cards::GetDatabase());
+}
+
+std::array<Card*, START_DECK_SIZE> Deck::GetCards(
+    const CardDatabase& cardDatabase) const
 {
     std::array<Card*, START_DECK_SIZE> deck{};
     std::size_t cardIdx = 0;
 
     for (const auto& [id, num] : m_cards)
     {
-        Card* card = Cards::GetInstance().FindCardByID(id);
+        Card* card = cardDatabase.FindCardByID(id);
 
         for (std::size_t i = 0; i < num; ++i)
         {
@@ -79,7 +86,13 @@ std::array<Card*, START_DECK_SIZE> Deck::GetCards() const
 
 bool Deck::AddCard(std::string cardID, std::size_t numCardToAdd)
 {
-    const Card* card = Cards::GetInstance().FindCardByID(cardID);
+    return AddCard(std::move(cardID), numCardToAdd, Cards::GetDatabase());
+}
+
+bool Deck::AddCard(std::string cardID, std::size_t numCardToAdd,
+                   const CardDatabase& cardDatabase)
+{
+    const Card* card = cardDatabase.FindCardByID(cardID);
 
     const CardClass cardClass = card->GetCardClass();
     if ((cardClass != GetClass() && cardClass != CardClass::NEUTRAL) ||
@@ -13,6 +13,12 @@
 namespace RosettaStone::PlayMode
 {
 std::shared_ptr<Enchant> Enchants::GetEnchantFromText(const std::string& cardID)
+{
+    return GetEnchantFromText(cardID, Cards::GetDatabase());
+}
+
+std::shared_ptr<Enchant> Enchants::GetEnchantFromText(
+    const std::string& cardID, const CardDatabase& cardDatabase)
 {
     std::vector<std::shared_ptr<IEffect>> effects;
     bool isOneTurn = false;
@@ -23,7 +29,7 @@ std::shared_ptr<Enchant> Enchants::GetEnchantFromText(const std::string& cardID)
     static std::regex attackRegex("([\\+\\-][[:digit:]]+) Attack");
     static std::regex healthRegex("([\\+\\-][[:digit:]]+) Health");
 
-    const auto card = Cards::FindCardByID(cardID);
+    Card* card = cardDatabase.FindCardByID(cardID);
     const std::string text = card->text;
     std::smatch values;
 
@@ -0,0 +1,173 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Evaluators/BatchEvaluator.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode
+{
+BatchEvaluator::BatchEvaluator(std::size_t inputSize, std::size_t outputSize,
+                               std::size_t maxBatchSize,
+                               std::chrono::microseconds maxDelay,
+                               BatchFunc batchFunc)
+    : m_inputSize(inputSize),
+      m_outputSize(outputSize),
+      m_maxBatchSize(maxBatchSize),
+      m_maxDelay(maxDelay),
+      m_batchFunc(std::move(batchFunc))
+{
+    if (m_inputSize == 0 || m_outputSize == 0 || m_maxBatchSize == 0 ||
+        !m_batchFunc)
+    {
+        throw std::invalid_argument(
+            "BatchEvaluator::BatchEvaluator() - Invalid argument");
+    }
+
+    m_batchOutputs.resize(m_maxBatchSize * m_outputSize);
+    m_thread = std::thread(&BatchEvaluator::Run, this);
+}
+
+BatchEvaluator::~BatchEvaluator()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_condition.notify_one();
+    m_thread.join();
+}
+
+std::future<void> BatchEvaluator::Submit(const float* input, float* output)
+{
+    std::future<void> future;
+    bool doNotify = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_pendingOutputs.empty())
+        {
+            m_oldestTime = std::chrono::steady_clock::now();
+            doNotify = true;
+        }
+
+        m_pendingInputs.insert(m_pendingInputs.end(), input,
+                               input + m_inputSize);
+        m_pendingOutputs.emplace_back(output);
+        future = m_pendingPromises.emplace_back().get_future();
+
+        // NOTE: The background thread waits for the first state to start the
+        // deadline and for a full batch to stop waiting.
+        doNotify = doNotify || m_pendingOutputs.size() == m_maxBatchSize;
+    }
+
+    if (doNotify)
+    {
+        m_condition.notify_one();
+    }
+
+    return future;
+}
+
+void BatchEvaluator::Evaluate(const float* input, float* output)
+{
+    Submit(input, output).get();
+}
+
+std::size_t BatchEvaluator::GetInputSize() const
+{
+    return m_inputSize;
+}
+
+std::size_t BatchEvaluator::GetOutputSize() const
+{
+    return m_outputSize;
+}
+
+std::size_t BatchEvaluator::GetNumBatches() const
+{
+    return m_numBatches;
+}
+
+std::size_t BatchEvaluator::GetNumEvaluations() const
+{
+    return m_numEvaluations;
+}
+
+void BatchEvaluator::Run()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(
+                lock, [this] { return m_stop || !m_pendingOutputs.empty(); });
+
+            if (m_pendingOutputs.empty())
+            {
+                return;
+            }
+
+            m_condition.wait_until(lock, m_oldestTime + m_maxDelay, [this] {
+                return m_stop || m_pendingOutputs.size() >= m_maxBatchSize;
+            });
+
+            // NOTE: The taken buffers are empty, so swapping them reuses the
+            // capacity of both sides.
+            m_takenInputs.swap(m_pendingInputs);
+            m_takenOutputs.swap(m_pendingOutputs);
+            m_takenPromises.swap(m_pendingPromises);
+        }
+
+        EvaluateTaken();
+    }
+}
+
+void BatchEvaluator::EvaluateTaken()
+{
+    const std::size_t numTaken = m_takenOutputs.size();
+
+    for (std::size_t begin = 0; begin < numTaken; begin += m_maxBatchSize)
+    {
+        const std::size_t batchSize =
+            std::min(m_maxBatchSize, numTaken - begin);
+
+        try
+        {
+            m_batchFunc(batchSize, &m_takenInputs[begin * m_inputSize],
+                        m_batchOutputs.data());
+        }
+        catch (...)
+        {
+            for (std::size_t i = begin; i < begin + batchSize; ++i)
+            {
+                m_takenPromises[i].set_exception(std::current_exception());
+            }
+            continue;
+        }
+
+        // NOTE: The counts are updated before the futures are ready, so a
+        // search that waited for its state sees its evaluation counted.
+        ++m_numBatches;
+        m_numEvaluations += batchSize;
+
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            const float* output = &m_batchOutputs[i * m_outputSize];
+            std::copy(output, output + m_outputSize,
+                      m_takenOutputs[begin + i]);
+            m_takenPromises[begin + i].set_value();
+        }
+    }
+
+    m_takenInputs.clear();
+    m_takenOutputs.clear();
+    m_takenPromises.clear();
+}
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,271 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Evaluators/HeuristicEvaluator.hpp>
+
+#include <json/json.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+using Encoder = ObservationEncoder;
+
+// The indices of features in the blocks of ObservationEncoder.
+constexpr std::size_t TOTAL_MANA = 1;
+constexpr std::size_t REMAINING_MANA = 2;
+constexpr std::size_t HAND_COUNT = 5;
+constexpr std::size_t SECRET_COUNT = 7;
+constexpr std::size_t IS_CURRENT_PLAYER = 8;
+
+constexpr std::size_t HERO_HEALTH = Encoder::BLOCK_HERO_OFFSET + 1;
+constexpr std::size_t HERO_ARMOR = Encoder::BLOCK_HERO_OFFSET + 2;
+constexpr std::size_t HERO_ATTACK = Encoder::BLOCK_HERO_OFFSET + 3;
+constexpr std::size_t HERO_CAN_ATTACK = Encoder::BLOCK_HERO_OFFSET + 4;
+
+constexpr std::size_t WEAPON_ATTACK = Encoder::BLOCK_WEAPON_OFFSET + 2;
+constexpr std::size_t WEAPON_DURABILITY = Encoder::BLOCK_WEAPON_OFFSET + 3;
+
+constexpr std::size_t MINION_PRESENT = 0;
+constexpr std::size_t MINION_ATTACK = 2;
+constexpr std::size_t MINION_HEALTH = 3;
+constexpr std::size_t MINION_SPELL_POWER = 6;
+constexpr std::size_t MINION_CAN_ATTACK = 7;
+constexpr std::size_t MINION_TAUNT = 8;
+constexpr std::size_t MINION_DIVINE_SHIELD = 9;
+constexpr std::size_t MINION_WINDFURY = 12;
+constexpr std::size_t MINION_STEALTH = 13;
+constexpr std::size_t MINION_POISONOUS = 14;
+constexpr std::size_t MINION_LIFESTEAL = 15;
+constexpr std::size_t MINION_FROZEN = 16;
+constexpr std::size_t MINION_DEATHRATTLE = 17;
+constexpr std::size_t MINION_REBORN = 18;
+
+struct WeightName
+{
+    const char* name;
+    float HeuristicWeights::*weight;
+};
+
+constexpr WeightName WEIGHT_NAMES[] = {
+    { "hero_health", &HeuristicWeights::heroHealth },
+    { "hero_armor", &HeuristicWeights::heroArmor },
+    { "weapon_attack", &HeuristicWeights::weaponAttack },
+    { "weapon_durability", &HeuristicWeights::weaponDurability },
+    { "minion", &HeuristicWeights::minion },
+    { "minion_attack", &HeuristicWeights::minionAttack },
+    { "minion_health", &HeuristicWeights::minionHealth },
+    { "spell_power", &HeuristicWeights::spellPower },
+    { "taunt", &HeuristicWeights::taunt },
+    { "divine_shield", &HeuristicWeights::divineShield },
+    { "windfury", &HeuristicWeights::windfury },
+    { "stealth", &HeuristicWeights::stealth },
+    { "poisonous", &HeuristicWeights::poisonous },
+    { "lifesteal", &HeuristicWeights::lifesteal },
+    { "frozen", &HeuristicWeights::frozen },
+    { "deathrattle", &HeuristicWeights::deathrattle },
+    { "reborn", &HeuristicWeights::reborn },
+    { "hand_size", &HeuristicWeights::handSize },
+    { "secret", &HeuristicWeights::secret },
+    { "spent_mana", &HeuristicWeights::spentMana },
+    { "lethal", &HeuristicWeights::lethal },
+    { "lethal_threat", &HeuristicWeights::lethalThreat },
+    { "win", &HeuristicWeights::win },
+};
+
+//! Returns the minion at \p slot of \p block.
+const float* GetMinion(const float* block, std::size_t slot)
+{
+    return block + Encoder::BLOCK_FIELD_OFFSET +
+           slot * Encoder::NUM_MINION_FEATURES;
+}
+
+//! Returns the damage the player of \p block can deal to the enemy hero.
+//! \param block The block of the player.
+//! \param isThisTurn true to count the characters that can attack now,
+//! false to count the characters that can attack next turn.
+float GetDamage(const float* block, bool isThisTurn)
+{
+    float damage = isThisTurn ? block[HERO_ATTACK] * block[HERO_CAN_ATTACK]
+                              : block[WEAPON_ATTACK];
+
+    for (std::size_t slot = 0; slot < MAX_FIELD_SIZE; ++slot)
+    {
+        const float* minion = GetMinion(block, slot);
+        const float canAttack =
+            isThisTurn
+                ? minion[MINION_CAN_ATTACK]
+                : minion[MINION_PRESENT] * (1.0f - minion[MINION_FROZEN]);
+        damage += minion[MINION_ATTACK] * canAttack *
+                  (1.0f + minion[MINION_WINDFURY]);
+    }
+
+    return damage;
+}
+
+//! Returns whether the player of \p attacker can kill the hero of
+//! \p defender. A taunt minion of \p defender blocks lethal.
+bool HasLethal(const float* attacker, const float* defender, bool isThisTurn)
+{
+    for (std::size_t slot = 0; slot < MAX_FIELD_SIZE; ++slot)
+    {
+        if (GetMinion(defender, slot)[MINION_TAUNT] > 0.0f)
+        {
+            return false;
+        }
+    }
+
+    return GetDamage(attacker, isThisTurn) >=
+           defender[HERO_HEALTH] + defender[HERO_ARMOR];
+}
+}  // namespace
+
+HeuristicWeights HeuristicWeights::Load(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Can't open heuristic weights: " + path);
+    }
+
+    nlohmann::json j;
+    file >> j;
+
+    if (!j.is_object())
+    {
+        throw std::runtime_error("Heuristic weights must be an object: " +
+                                 path);
+    }
+
+    HeuristicWeights weights;
+
+    for (auto item = j.begin(); item != j.end(); ++item)
+    {
+        const std::string& key = item.key();
+        const auto iter =
+            std::find_if(std::begin(WEIGHT_NAMES), std::end(WEIGHT_NAMES),
+                         [&](const WeightName& weightName) {
+                             return key == weightName.name;
+                         });
+
+        // NOTE: An unknown key is an error so that a typo in a tuned file
+        // doesn't silently keep the default weight.
+        if (iter == std::end(WEIGHT_NAMES))
+        {
+            throw std::runtime_error("Unknown heuristic weight: " + key);
+        }
+
+        if (!item.value().is_number())
+        {
+            throw std::runtime_error("Heuristic weight is not a number: " +
+                                     key);
+        }
+
+        weights.*(iter->weight) = item.value().get<float>();
+    }
+
+    return weights;
+}
+
+HeuristicEvaluator::HeuristicEvaluator(const HeuristicWeights& weights)
+    : m_weights(weights)
+{
+    m_blockWeights[HAND_COUNT] = m_weights.handSize;
+    m_blockWeights[SECRET_COUNT] = m_weights.secret;
+    m_blockWeights[HERO_HEALTH] = m_weights.heroHealth;
+    m_blockWeights[HERO_ARMOR] = m_weights.heroArmor;
+    m_blockWeights[WEAPON_ATTACK] = m_weights.weaponAttack;
+    m_blockWeights[WEAPON_DURABILITY] = m_weights.weaponDurability;
+
+    for (std::size_t slot = 0; slot < MAX_FIELD_SIZE; ++slot)
+    {
+        float* minion = &m_blockWeights[Encoder::BLOCK_FIELD_OFFSET +
+                                        slot * Encoder::NUM_MINION_FEATURES];
+        minion[MINION_PRESENT] = m_weights.minion;
+        minion[MINION_ATTACK] = m_weights.minionAttack;
+        minion[MINION_HEALTH] = m_weights.minionHealth;
+        minion[MINION_SPELL_POWER] = m_weights.spellPower;
+        minion[MINION_TAUNT] = m_weights.taunt;
+        minion[MINION_DIVINE_SHIELD] = m_weights.divineShield;
+        minion[MINION_WINDFURY] = m_weights.windfury;
+        minion[MINION_STEALTH] = m_weights.stealth;
+        minion[MINION_POISONOUS] = m_weights.poisonous;
+        minion[MINION_LIFESTEAL] = m_weights.lifesteal;
+        minion[MINION_FROZEN] = m_weights.frozen;
+        minion[MINION_DEATHRATTLE] = m_weights.deathrattle;
+        minion[MINION_REBORN] = m_weights.reborn;
+    }
+}
+
+const HeuristicWeights& HeuristicEvaluator::GetWeights() const
+{
+    return m_weights;
+}
+
+float HeuristicEvaluator::Evaluate(const float* observation) const
+{
+    const float* player = observation + Encoder::PLAYER_OFFSET;
+    const float* opponent = observation + Encoder::OPPONENT_OFFSET;
+
+    const bool isPlayerDead = player[HERO_HEALTH] <= 0.0f;
+    const bool isOpponentDead = opponent[HERO_HEALTH] <= 0.0f;
+    if (isPlayerDead || isOpponentDead)
+    {
+        return isPlayerDead == isOpponentDead
+                   ? 0.0f
+                   : (isOpponentDead ? m_weights.win : -m_weights.win);
+    }
+
+    float value = 0.0f;
+    for (std::size_t i = 0; i < Encoder::NUM_BLOCK_FEATURES; ++i)
+    {
+        value += m_blockWeights[i] * (player[i] - opponent[i]);
+    }
+
+    value += m_weights.spentMana *
+             (player[TOTAL_MANA] - player[REMAINING_MANA]);
+
+    // NOTE: The current player attacks first, so the lethal of the other
+    // player only matters if the current player has no lethal.
+    const bool isPlayerTurn = player[IS_CURRENT_PLAYER] > 0.0f;
+    const float* current = isPlayerTurn ? player : opponent;
+    const float* other = isPlayerTurn ? opponent : player;
+    const float sign = isPlayerTurn ? 1.0f : -1.0f;
+
+    if (HasLethal(current, other, true))
+    {
+        value += sign * m_weights.lethal;
+    }
+    else if (HasLethal(other, current, false))
+    {
+        value -= sign * m_weights.lethalThreat;
+    }
+
+    return value;
+}
+
+float HeuristicEvaluator::Evaluate(const Player& player) const
+{
+    std::array<float, Encoder::NUM_FEATURES> observation;
+    Encoder::Encode(player, observation.data());
+
+    return Evaluate(observation.data());
+}
+
+void HeuristicEvaluator::EvaluateBatch(std::size_t batchSize,
+                                       const float* observations,
+                                       float* values) const
+{
+    for (std::size_t i = 0; i < batchSize; ++i)
+    {
+        values[i] = Evaluate(observations + i * Encoder::NUM_FEATURES);
+    }
+}
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,55 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Evaluators/StubModel.hpp>
+
+#include <thread>
+
+namespace RosettaStone::PlayMode
+{
+StubModel::StubModel(std::size_t inputSize, std::size_t outputSize,
+                     std::chrono::microseconds latency)
+    : m_inputSize(inputSize),
+      m_outputSize(outputSize),
+      m_latency(latency),
+      m_weights(inputSize * outputSize)
+{
+    // NOTE: The weights are small and fixed, so outputs are deterministic
+    // and stay in range for any observation.
+    for (std::size_t i = 0; i < m_weights.size(); ++i)
+    {
+        m_weights[i] = static_cast<float>(static_cast<int>(i % 7) - 3) * 1e-3f;
+    }
+}
+
+void StubModel::operator()(std::size_t batchSize, const float* inputs,
+                           float* outputs) const
+{
+    if (m_latency.count() > 0)
+    {
+        std::this_thread::sleep_for(m_latency);
+    }
+
+    for (std::size_t b = 0; b < batchSize; ++b)
+    {
+        const float* input = inputs + b * m_inputSize;
+        float* output = outputs + b * m_outputSize;
+
+        for (std::size_t j = 0; j < m_outputSize; ++j)
+        {
+            const float* weights = &m_weights[j * m_inputSize];
+            float sum = 0.0f;
+
+            for (std::size_t i = 0; i < m_inputSize; ++i)
+            {
+                sum += weights[i] * input[i];
+            }
+
+            output[j] = sum;
+        }
+    }
+}
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,271 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/Utils.hpp>
+#include <Rosetta/PlayMode/Actions/Generic.hpp>
+#include <Rosetta/PlayMode/Cards/Card.hpp>
+#include <Rosetta/PlayMode/Games/Determinizer.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Models/Spell.hpp>
+#include <Rosetta/PlayMode/Triggers/Trigger.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+#include <Rosetta/PlayMode/Zones/SecretZone.hpp>
+
+#include <effolkronium/random.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+using Random = effolkronium::random_thread_local;
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+//! Returns whether \p playable is revealed to the opponent.
+bool IsRevealed(const Playable* playable)
+{
+    return playable->GetGameTag(GameTag::REVEALED) == 1;
+}
+
+//! Removes the element at \p idx of \p cards without keeping the order.
+Card* SwapRemove(std::vector<Card*>& cards, std::size_t idx)
+{
+    Card* card = cards[idx];
+    cards[idx] = cards.back();
+    cards.pop_back();
+
+    return card;
+}
+}  // namespace
+
+Determinizer::Determinizer(PlayerType playerType,
+                           std::vector<Card*> deckPrior,
+                           std::vector<Card*> cardPool)
+    : m_playerType(playerType),
+      m_deckPrior(std::move(deckPrior)),
+      m_cardPool(std::move(cardPool))
+{
+    if (m_playerType != PlayerType::PLAYER1 &&
+        m_playerType != PlayerType::PLAYER2)
+    {
+        throw std::invalid_argument(
+            "Determinizer::Determinizer() - Invalid player type");
+    }
+
+    if (m_cardPool.empty())
+    {
+        throw std::invalid_argument(
+            "Determinizer::Determinizer() - The card pool is empty");
+    }
+
+    // NOTE: A deck may have null slots that are filled by the game.
+    m_deckPrior.erase(
+        std::remove(m_deckPrior.begin(), m_deckPrior.end(), nullptr),
+        m_deckPrior.end());
+
+    for (Card* card : m_cardPool)
+    {
+        if (card->IsSecret())
+        {
+            m_secretPool.emplace_back(card);
+        }
+    }
+}
+
+std::unique_ptr<Game> Determinizer::Sample(const GameRecord& record,
+                                           unsigned int seed) const
+{
+    // NOTE: Game::Replay() and the sampling reseed the engine, so the state
+    // of the engine of the caller is restored afterwards.
+    const RandomStateGuard randomStateGuard;
+
+    auto game = Game::Replay(record);
+
+    Random::seed(seed);
+    Determinize(*game);
+
+    return game;
+}
+
+void Determinizer::Determinize(Game& game) const
+{
+    Player* player = m_playerType == PlayerType::PLAYER1 ? game.GetPlayer1()
+                                                         : game.GetPlayer2();
+    Player* opponent = player->opponent;
+
+    std::vector<Card*> cards = GetUnplayedCards(*opponent);
+    Random::shuffle(cards);
+
+    // Resample the secrets first because they can only be secrets of their
+    // class that the opponent doesn't have yet.
+    std::vector<Spell*> secrets;
+    std::vector<Card*> excluded;
+    opponent->GetSecretZone()->ForEach([&](Spell* spell) {
+        if (spell->card->IsSecret() && !IsRevealed(spell))
+        {
+            secrets.emplace_back(spell);
+        }
+        else
+        {
+            excluded.emplace_back(spell->card);
+        }
+    });
+
+    for (Spell* secret : secrets)
+    {
+        Card* card = DrawSecret(cards, secret->card->GetCardClass(), excluded);
+
+        // NOTE: If there is no other secret, the opponent can only have
+        // this one.
+        if (!card)
+        {
+            card = secret->card;
+        }
+
+        excluded.emplace_back(card);
+        if (card == secret->card)
+        {
+            continue;
+        }
+
+        const int id = secret->GetGameTag(GameTag::ENTITY_ID);
+        Generic::ChangeEntity(opponent, secret, card, true);
+        secret->SetExhausted(true);
+
+        if (const auto trigger = card->power.GetTrigger(); trigger)
+        {
+            trigger->Activate(secret);
+        }
+
+        for (auto& history : opponent->playHistory)
+        {
+            if (history.sourceID == id)
+            {
+                history.sourceCard = card;
+            }
+        }
+    }
+
+    std::vector<Playable*> hiddenCards;
+    opponent->GetHandZone()->ForEach([&](Playable* playable) {
+        if (!IsRevealed(playable))
+        {
+            hiddenCards.emplace_back(playable);
+        }
+    });
+
+    for (Playable* playable : hiddenCards)
+    {
+        if (Card* card = DrawCard(cards); card != playable->card)
+        {
+            Generic::ChangeEntity(opponent, playable, card, true);
+        }
+    }
+
+    hiddenCards = opponent->GetDeckZone()->GetAll();
+    for (Playable* playable : hiddenCards)
+    {
+        Card* card = DrawCard(cards);
+        if (card == playable->card)
+        {
+            continue;
+        }
+
+        const int id = playable->GetGameTag(GameTag::ENTITY_ID);
+        Generic::ChangeEntity(opponent, playable, card, true);
+
+        // NOTE: Generic::ChangeEntity() only activates the triggers of
+        // entities in hand or on the field.
+        if (const auto trigger = card->power.GetTrigger(); trigger)
+        {
+            trigger->Activate(game.entityList[id], TriggerActivation::DECK);
+        }
+    }
+
+    player->GetDeckZone()->Shuffle();
+    opponent->GetDeckZone()->Shuffle();
+
+    game.UpdateAura();
+}
+
+std::vector<Card*> Determinizer::GetUnplayedCards(const Player& opponent) const
+{
+    std::vector<Card*> cards = m_deckPrior;
+    const auto& entityList = opponent.game->entityList;
+
+    for (const auto& history : opponent.playHistory)
+    {
+        // NOTE: The card of a secret that isn't revealed is unknown, so it
+        // can't be taken out of the deck list.
+        if (history.sourceCard->IsSecret())
+        {
+            const auto iter = entityList.find(history.sourceID);
+            if (iter == entityList.end() || !IsRevealed(iter->second))
+            {
+                continue;
+            }
+        }
+
+        const auto iter = std::find_if(
+            cards.begin(), cards.end(), [&](const Card* card) {
+                return card->dbfID == history.sourceCard->dbfID;
+            });
+        if (iter != cards.end())
+        {
+            SwapRemove(cards, iter - cards.begin());
+        }
+    }
+
+    return cards;
+}
+
+Card* Determinizer::DrawCard(std::vector<Card*>& cards) const
+{
+    if (cards.empty())
+    {
+        return *Random::get(m_cardPool);
+    }
+
+    Card* card = cards.back();
+    cards.pop_back();
+
+    return card;
+}
+
+Card* Determinizer::DrawSecret(std::vector<Card*>& cards, CardClass cardClass,
+                               const std::vector<Card*>& excluded) const
+{
+    const auto isCandidate = [&](const Card* card) {
+        return card->IsSecret() && card->GetCardClass() == cardClass &&
+               std::find_if(excluded.begin(), excluded.end(),
+                            [&](const Card* secret) {
+                                return secret->dbfID == card->dbfID;
+                            }) == excluded.end();
+    };
+
+    // NOTE: The cards are shuffled, so the last candidate is random.
+    for (std::size_t i = cards.size(); i > 0; --i)
+    {
+        if (isCandidate(cards[i - 1]))
+        {
+            return SwapRemove(cards, i - 1);
+        }
+    }
+
+    std::vector<Card*> candidates;
+    for (Card* card : m_secretPool)
+    {
+        if (isCandidate(card))
+        {
+            candidates.emplace_back(card);
+        }
+    }
+
+    return candidates.empty() ? nullptr : *Random::get(candidates);
+}
+}  // namespace RosettaStone::PlayMode
@@ -3,13 +3,16 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2017-2021 Chris Ohk
 
+#include <Rosetta/Common/Utils.hpp>
 #include <Rosetta/PlayMode/Actions/Choose.hpp>
 #include <Rosetta/PlayMode/Actions/Draw.hpp>
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
 #include <Rosetta/PlayMode/Actions/Summon.hpp>
+#include <Rosetta/PlayMode/Agents/Action.hpp>
 #include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Enchants/Power.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GameRecorder.hpp>
 #include <Rosetta/PlayMode/Managers/GameManager.hpp>
 #include <Rosetta/PlayMode/Models/Enchantment.hpp>
 #include <Rosetta/PlayMode/Tasks/ITask.hpp>
@@ -23,12 +26,32 @@
 #include <effolkronium/random.hpp>
 
 #include <algorithm>
+#include <stdexcept>
+#include <string>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 using namespace RosettaStone::PlayMode::PlayerTasks;
 
 namespace RosettaStone::PlayMode
 {
+namespace
+{
+//! Mixes the card and the game tags of \p entity into \p hash.
+std::uint64_t HashEntity(std::uint64_t hash, const Entity& entity)
+{
+    hash = HashCombine(
+        hash, static_cast<std::uint64_t>(entity.card ? entity.card->dbfID : 0));
+
+    for (const auto& [tag, value] : entity.GetGameTags())
+    {
+        hash = HashCombine(hash, static_cast<std::uint64_t>(tag));
+        hash = HashCombine(hash, static_cast<std::uint64_t>(value));
+    }
+
+    return hash;
+}
+}  // namespace
+
 Game::Game()
 {
     Initialize();
@@ -44,11 +67,11 @@ Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
 
     // Add hero and hero power
     GetPlayer1()->AddHeroAndPower(
-        Cards::GetHeroCard(gameConfig.player1Class),
-        Cards::GetDefaultHeroPower(gameConfig.player1Class));
+        GetCardDatabase().GetHeroCard(gameConfig.player1Class),
+        GetCardDatabase().GetDefaultHeroPower(gameConfig.player1Class));
     GetPlayer2()->AddHeroAndPower(
-        Cards::GetHeroCard(gameConfig.player2Class),
-        Cards::GetDefaultHeroPower(gameConfig.player2Class));
+        GetCardDatabase().GetHeroCard(gameConfig.player2Class),
+        GetCardDatabase().GetDefaultHeroPower(gameConfig.player2Class));
 
     // Set base class
     GetPlayer1()->baseClass = gameConfig.player1Class;
@@ -107,7 +130,7 @@ Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
         {
             for (auto& cardID : m_gameConfig.fillCardIDs)
             {
-                Card* card = Cards::FindCardByID(cardID);
+                Card* card = GetCardDatabase().FindCardByID(cardID);
                 Playable* playable = Entity::GetFromCard(&p, card);
                 p.GetDeckZone()->Add(playable);
             }
@@ -170,6 +193,24 @@ FormatType Game::GetFormatType() const
     return m_gameConfig.formatType;
 }
 
+const CardDatabase& Game::GetCardDatabase() const
+{
+    return m_gameConfig.cardDatabase != nullptr ? *m_gameConfig.cardDatabase
+                                                : Cards::GetDatabase();
+}
+
+Card* Game::FindCard(Card* card) const
+{
+    // NOTE: Most games use the default database, whose cards are the ones
+    // that powers refer to, so no lookup is needed for them.
+    if (card == nullptr || m_gameConfig.cardDatabase == nullptr)
+    {
+        return card;
+    }
+
+    return m_gameConfig.cardDatabase->FindCardByID(card->id);
+}
+
 Player* Game::GetPlayer1()
 {
     return &m_players[0];
@@ -311,9 +352,12 @@ void Game::BeginMulligan()
 void Game::MainBegin()
 {
     // Give "The Coin" card to second player
-    Card* coin = Cards::FindCardByID("GAME_005");
-    GetOpponentPlayer()->GetHandZone()->Add(
-        Entity::GetFromCard(GetOpponentPlayer(), coin));
+    Card* coin = GetCardDatabase().FindCardByID("GAME_005");
+    Playable* coinEntity = Entity::GetFromCard(GetOpponentPlayer(), coin);
+
+    // NOTE: Both players see the coin given to the second player.
+    coinEntity->SetGameTag(GameTag::REVEALED, 1);
+    GetOpponentPlayer()->GetHandZone()->Add(coinEntity);
 
     // Process tasks
     ProcessTasks();
@@ -680,7 +724,7 @@ void Game::ProcessGraveyard()
                     if (playable->GetNumInfuse() ==
                         playable->GetGameTag(GameTag::NUM_MINIONS_TO_INFUSE))
                     {
-                        Card* newCard = Cards::FindCardByDbfID(
+                        Card* newCard = GetCardDatabase().FindCardByDbfID(
                             playable->GetGameTag(GameTag::INFUSEDCARD));
                         if (newCard && !newCard->name.empty())
                         {
@@ -785,6 +829,104 @@ void Game::ProcessUntil(Step untilStep)
     }
 }
 
+std::uint64_t Game::GetStateHash() const
+{
+    std::uint64_t hash = HASH_OFFSET_BASIS;
+    hash = HashCombine(hash, static_cast<std::uint64_t>(state));
+    hash = HashCombine(hash, static_cast<std::uint64_t>(step));
+    hash = HashCombine(hash, static_cast<std::uint64_t>(nextStep));
+    hash = HashCombine(hash, static_cast<std::uint64_t>(m_turn));
+    hash = HashCombine(hash, static_cast<std::uint64_t>(m_entityID));
+    hash = HashCombine(hash, static_cast<std::uint64_t>(m_oopIndex));
+    hash = HashCombine(hash, static_cast<std::uint64_t>(m_currentPlayer));
+
+    for (const auto& player : m_players)
+    {
+        hash = HashCombine(hash, static_cast<std::uint64_t>(player.playState));
+        hash = HashEntity(hash, player);
+
+        if (player.choice)
+        {
+            for (const int entityID : player.choice->choices)
+            {
+                hash = HashCombine(hash, static_cast<std::uint64_t>(entityID));
+            }
+        }
+    }
+
+    // NOTE: The list is ordered by ID, so the order doesn't depend on
+    // addresses. A lookup with operator[] inserts a null entry for an ID
+    // that has no entity, so null entries are skipped.
+    for (const auto& [id, playable] : entityList)
+    {
+        if (!playable)
+        {
+            continue;
+        }
+
+        hash = HashCombine(hash, static_cast<std::uint64_t>(id));
+        hash = HashCombine(hash,
+                           static_cast<std::uint64_t>(playable->GetZoneType()));
+        hash = HashEntity(hash, *playable);
+    }
+
+    return hash;
+}
+
+std::unique_ptr<Game> Game::Replay(const GameRecord& record)
+{
+    const GameConfig& config = record.gameConfig;
+    const CardDatabase& cardDatabase = config.cardDatabase != nullptr
+                                           ? *config.cardDatabase
+                                           : Cards::GetDatabase();
+
+    if (cardDatabase.GetVersion() != record.cardDatabaseVersion)
+    {
+        throw std::runtime_error(
+            "The game was recorded with another version of card database");
+    }
+
+    // NOTE: Each step reseeds the engine, so the state of the engine of the
+    // caller is restored afterwards.
+    const RandomStateGuard randomStateGuard;
+
+    const auto diverged = [](std::size_t actionIdx, const std::string& what) {
+        return std::runtime_error("Replay diverged at action " +
+                                  std::to_string(actionIdx) + ": " + what);
+    };
+
+    GameRecorder::SeedStep(record.seed, 0);
+    auto game = std::make_unique<Game>(config);
+    game->Start();
+
+    for (std::size_t i = 0; i < record.actions.size(); ++i)
+    {
+        if (game->state == State::COMPLETE)
+        {
+            throw diverged(i, "the game is over");
+        }
+
+        GameRecorder::SeedStep(record.seed, i + 1);
+
+        try
+        {
+            ApplyAction(*game, record.actions[i]);
+        }
+        catch (const std::exception& e)
+        {
+            throw diverged(i, e.what());
+        }
+    }
+
+    if (game->GetStateHash() != record.stateHash)
+    {
+        throw std::runtime_error(
+            "Replay diverged: the state hash of the final state differs");
+    }
+
+    return game;
+}
+
 std::tuple<PlayState, PlayState> Game::CheckGameOver()
 {
     // Check hero of two players is destroyed
@@ -0,0 +1,306 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Cards/CardDatabase.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/GameRecord.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace RosettaStone::PlayMode::GameRecordFile
+{
+namespace
+{
+//! The flags of GameConfig in a payload.
+enum ConfigFlags : std::uint8_t
+{
+    DO_FILL_DECKS = 1 << 0,
+    DO_SHUFFLE = 1 << 1,
+    SKIP_MULLIGAN = 1 << 2,
+    AUTO_RUN = 1 << 3,
+};
+
+//! Appends \p value as a LEB128 variable-length integer.
+void PutUInt(std::uint64_t value, std::vector<char>& dst)
+{
+    while (value >= 0x80)
+    {
+        dst.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    dst.push_back(static_cast<char>(value));
+}
+
+//! Appends \p value as a zigzag-encoded variable-length integer.
+void PutInt(std::int64_t value, std::vector<char>& dst)
+{
+    PutUInt((static_cast<std::uint64_t>(value) << 1) ^
+                static_cast<std::uint64_t>(value >> 63),
+            dst);
+}
+
+//! Appends the 8 bytes of \p value.
+void PutFixed(std::uint64_t value, std::vector<char>& dst)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        dst.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+}
+
+//! Appends the dbfIDs of the cards of \p deck except empty slots.
+void PutDeck(const std::array<Card*, START_DECK_SIZE>& deck,
+             std::vector<char>& dst)
+{
+    std::uint64_t numCards = 0;
+    for (const Card* card : deck)
+    {
+        numCards += card && !card->id.empty() ? 1 : 0;
+    }
+
+    PutUInt(numCards, dst);
+    for (const Card* card : deck)
+    {
+        if (card && !card->id.empty())
+        {
+            PutInt(card->dbfID, dst);
+        }
+    }
+}
+
+//!
+//! \brief Cursor class.
+//!
+//! This class reads the values of a payload in order and throws
+//! std::runtime_error if the payload ends or a value is out of range.
+//!
+class Cursor
+{
+ public:
+    //! Constructs cursor at the start of \p srcSize bytes of \p src.
+    Cursor(const char* src, std::size_t srcSize)
+        : m_cur(src), m_end(src + srcSize)
+    {
+        // Do nothing
+    }
+
+    //! Returns the next variable-length integer.
+    std::uint64_t GetUInt()
+    {
+        std::uint64_t value = 0;
+
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            const auto byte = static_cast<std::uint8_t>(GetByte());
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+
+        throw std::runtime_error("Corrupted game record: invalid integer");
+    }
+
+    //! Returns the next zigzag-encoded variable-length integer.
+    std::int64_t GetInt()
+    {
+        const std::uint64_t value = GetUInt();
+        return static_cast<std::int64_t>(value >> 1) ^
+               -static_cast<std::int64_t>(value & 1);
+    }
+
+    //! Returns the next integer, which must be in [\p minVal, \p maxVal].
+    int GetInt(int minVal, int maxVal)
+    {
+        const std::int64_t value = GetInt();
+        if (value < minVal || value > maxVal)
+        {
+            throw std::runtime_error("Corrupted game record: out of range");
+        }
+
+        return static_cast<int>(value);
+    }
+
+    //! Returns the next 8-byte integer.
+    std::uint64_t GetFixed()
+    {
+        std::uint64_t value = 0;
+        for (int i = 0; i < 8; ++i)
+        {
+            value |= static_cast<std::uint64_t>(
+                         static_cast<std::uint8_t>(GetByte()))
+                     << (i * 8);
+        }
+
+        return value;
+    }
+
+    //! Returns the next byte.
+    char GetByte()
+    {
+        if (m_cur == m_end)
+        {
+            throw std::runtime_error("Corrupted game record: unexpected end");
+        }
+
+        return *m_cur++;
+    }
+
+    //! Reads the next string into \p str.
+    void GetString(std::string& str)
+    {
+        const std::uint64_t size = GetUInt();
+        if (size > static_cast<std::uint64_t>(m_end - m_cur))
+        {
+            throw std::runtime_error("Corrupted game record: unexpected end");
+        }
+
+        str.assign(m_cur, static_cast<std::size_t>(size));
+        m_cur += size;
+    }
+
+    //! Reads the next deck into \p deck with the cards of \p cardDatabase.
+    void GetDeck(const CardDatabase& cardDatabase,
+                 std::array<Card*, START_DECK_SIZE>& deck)
+    {
+        const int numCards = GetInt(0, START_DECK_SIZE);
+
+        deck.fill(nullptr);
+        for (int i = 0; i < numCards; ++i)
+        {
+            const int dbfID = GetInt(0, INT32_MAX);
+            Card* card = cardDatabase.FindCardByDbfID(dbfID);
+            if (card->id.empty())
+            {
+                throw std::runtime_error("Unknown card in game record: " +
+                                         std::to_string(dbfID));
+            }
+
+            deck[i] = card;
+        }
+    }
+
+    //! Returns whether all bytes are read.
+    bool IsEnd() const
+    {
+        return m_cur == m_end;
+    }
+
+ private:
+    const char* m_cur;
+    const char* m_end;
+};
+}  // namespace
+
+void Encode(const GameRecord& record, std::vector<char>& dst)
+{
+    const GameConfig& config = record.gameConfig;
+
+    PutFixed(record.cardDatabaseVersion, dst);
+    PutUInt(record.seed, dst);
+    PutInt(static_cast<int>(config.formatType), dst);
+    PutInt(static_cast<int>(config.startPlayer), dst);
+    PutInt(static_cast<int>(config.player1Class), dst);
+    PutInt(static_cast<int>(config.player2Class), dst);
+
+    const auto flags = static_cast<std::uint8_t>(
+        (config.doFillDecks ? DO_FILL_DECKS : 0) |
+        (config.doShuffle ? DO_SHUFFLE : 0) |
+        (config.skipMulligan ? SKIP_MULLIGAN : 0) |
+        (config.autoRun ? AUTO_RUN : 0));
+    dst.push_back(static_cast<char>(flags));
+
+    PutDeck(config.player1Deck, dst);
+    PutDeck(config.player2Deck, dst);
+
+    if (config.doFillDecks)
+    {
+        for (const auto& cardID : config.fillCardIDs)
+        {
+            PutUInt(cardID.size(), dst);
+            dst.insert(dst.end(), cardID.begin(), cardID.end());
+        }
+    }
+
+    PutUInt(record.actions.size(), dst);
+    for (const auto& action : record.actions)
+    {
+        dst.push_back(static_cast<char>(action.type));
+        PutInt(action.index, dst);
+        PutInt(action.target, dst);
+        PutInt(action.position, dst);
+        PutInt(action.chooseOne, dst);
+    }
+
+    PutFixed(record.stateHash, dst);
+}
+
+void Decode(const char* src, std::size_t srcSize,
+            const CardDatabase* cardDatabase, GameRecord& record)
+{
+    Cursor cursor(src, srcSize);
+    GameConfig& config = record.gameConfig;
+
+    record.cardDatabaseVersion = cursor.GetFixed();
+    record.seed = static_cast<unsigned int>(cursor.GetUInt());
+    config.formatType =
+        static_cast<FormatType>(cursor.GetInt(INT32_MIN, INT32_MAX));
+    config.startPlayer =
+        static_cast<PlayerType>(cursor.GetInt(INT32_MIN, INT32_MAX));
+    config.player1Class =
+        static_cast<CardClass>(cursor.GetInt(INT32_MIN, INT32_MAX));
+    config.player2Class =
+        static_cast<CardClass>(cursor.GetInt(INT32_MIN, INT32_MAX));
+
+    const auto flags = static_cast<std::uint8_t>(cursor.GetByte());
+    config.doFillDecks = (flags & DO_FILL_DECKS) != 0;
+    config.doShuffle = (flags & DO_SHUFFLE) != 0;
+    config.skipMulligan = (flags & SKIP_MULLIGAN) != 0;
+    config.autoRun = (flags & AUTO_RUN) != 0;
+
+    config.cardDatabase = cardDatabase;
+    const CardDatabase& database =
+        cardDatabase != nullptr ? *cardDatabase : Cards::GetDatabase();
+    cursor.GetDeck(database, config.player1Deck);
+    cursor.GetDeck(database, config.player2Deck);
+
+    if (config.doFillDecks)
+    {
+        for (auto& cardID : config.fillCardIDs)
+        {
+            cursor.GetString(cardID);
+        }
+    }
+
+    const std::uint64_t numActions = cursor.GetUInt();
+    if (numActions > srcSize)
+    {
+        throw std::runtime_error("Corrupted game record: unexpected end");
+    }
+
+    record.actions.resize(static_cast<std::size_t>(numActions));
+    for (auto& action : record.actions)
+    {
+        action.type = static_cast<ActionType>(cursor.GetByte());
+        action.index = cursor.GetInt(INT32_MIN, INT32_MAX);
+        action.target = cursor.GetInt(INT32_MIN, INT32_MAX);
+        action.position = cursor.GetInt(INT32_MIN, INT32_MAX);
+        action.chooseOne = cursor.GetInt(INT32_MIN, INT32_MAX);
+    }
+
+    record.stateHash = cursor.GetFixed();
+    if (!cursor.IsEnd())
+    {
+        throw std::runtime_error("Corrupted game record: trailing bytes");
+    }
+}
+}  // namespace RosettaStone::PlayMode::GameRecordFile
@@ -0,0 +1,60 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/Utils.hpp>
+#include <Rosetta/PlayMode/Cards/CardDatabase.hpp>
+#include <Rosetta/PlayMode/Games/GameRecorder.hpp>
+
+#include <effolkronium/random.hpp>
+
+using Random = effolkronium::random_thread_local;
+
+namespace RosettaStone::PlayMode
+{
+GameRecorder::GameRecorder(const GameConfig& gameConfig, unsigned int seed)
+{
+    m_record.gameConfig = gameConfig;
+    m_record.gameConfig.skipMulligan = true;
+    m_record.gameConfig.autoRun = true;
+    m_record.seed = seed;
+
+    SeedStep(seed, 0);
+    m_game = std::make_unique<Game>(m_record.gameConfig);
+    m_game->Start();
+
+    m_record.cardDatabaseVersion = m_game->GetCardDatabase().GetVersion();
+}
+
+Game& GameRecorder::GetGame()
+{
+    return *m_game;
+}
+
+std::tuple<PlayState, PlayState> GameRecorder::Apply(const Action& action)
+{
+    SeedStep(m_record.seed, m_record.actions.size() + 1);
+    const auto result = ApplyAction(*m_game, action);
+
+    // NOTE: An action is recorded only if it is applied, so an illegal
+    // action that throws is not replayed.
+    m_record.actions.emplace_back(action);
+
+    return result;
+}
+
+GameRecord GameRecorder::GetRecord() const
+{
+    GameRecord record = m_record;
+    record.stateHash = m_game->GetStateHash();
+
+    return record;
+}
+
+void GameRecorder::SeedStep(unsigned int seed, std::size_t stepIdx)
+{
+    Random::seed(MixSeed(seed, stepIdx));
+}
+}  // namespace RosettaStone::PlayMode
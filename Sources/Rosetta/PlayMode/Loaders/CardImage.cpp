@@ -0,0 +1,411 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/Macros.hpp>
+#include <Rosetta/PlayMode/Loaders/CardImage.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+
+#ifndef ROSETTASTONE_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+constexpr char CARD_IMAGE_MAGIC[8] = { 'R', 'S', 'C', 'A', 'R', 'D', 'S', 0 };
+constexpr std::uint32_t CARD_IMAGE_VERSION = 1;
+
+std::size_t Align(std::size_t offset)
+{
+    return (offset + 7) & ~static_cast<std::size_t>(7);
+}
+
+#ifndef ROSETTASTONE_WINDOWS
+std::pair<const char*, std::size_t> MapReadOnly(int fd, const std::string& name)
+{
+    struct stat st
+    {
+    };
+
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        throw std::runtime_error("Can't read card image: " + name);
+    }
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+        throw std::runtime_error("Can't map card image: " + name);
+    }
+
+    return { static_cast<const char*>(addr), size };
+}
+#endif
+}  // namespace
+
+CardImage::~CardImage()
+{
+    Close();
+}
+
+std::vector<char> CardImage::Build(const std::vector<Card*>& cards)
+{
+    std::size_t numTags = 0;
+    std::size_t stringsSize = 0;
+
+    for (const auto& card : cards)
+    {
+        numTags += card->gameTags.size();
+        stringsSize += card->id.size() + card->name.size() + card->text.size();
+    }
+
+    Header header{};
+    std::memcpy(header.magic, CARD_IMAGE_MAGIC, sizeof(header.magic));
+    header.version = CARD_IMAGE_VERSION;
+    header.numCards = static_cast<std::uint32_t>(cards.size());
+    header.recordsOffset = Align(sizeof(Header));
+    header.dbfIndexOffset =
+        Align(header.recordsOffset + sizeof(Record) * cards.size());
+    header.tagsOffset =
+        Align(header.dbfIndexOffset + sizeof(DbfIndexEntry) * cards.size());
+    header.stringsOffset =
+        Align(header.tagsOffset + sizeof(TagEntry) * numTags);
+    header.size = header.stringsOffset + stringsSize;
+
+    std::vector<char> image(header.size, 0);
+    std::memcpy(image.data(), &header, sizeof(Header));
+
+    auto* records =
+        reinterpret_cast<Record*>(image.data() + header.recordsOffset);
+    auto* dbfIndex =
+        reinterpret_cast<DbfIndexEntry*>(image.data() + header.dbfIndexOffset);
+    auto* tags = reinterpret_cast<TagEntry*>(image.data() + header.tagsOffset);
+    char* strings = image.data() + header.stringsOffset;
+
+    std::uint32_t tagIdx = 0;
+    std::uint32_t stringOffset = 0;
+
+    auto addString = [&](const std::string& str) {
+        const StringRef ref{ stringOffset,
+                             static_cast<std::uint32_t>(str.size()) };
+        std::memcpy(strings + stringOffset, str.data(), str.size());
+        stringOffset += ref.length;
+        return ref;
+    };
+
+    for (std::size_t i = 0; i < cards.size(); ++i)
+    {
+        const Card* card = cards[i];
+        Record& record = records[i];
+
+        record.dbfID = card->dbfID;
+        record.id = addString(card->id);
+        record.name = addString(card->name);
+        record.text = addString(card->text);
+        record.tagsBegin = tagIdx;
+        record.numTags = static_cast<std::uint32_t>(card->gameTags.size());
+
+        // NOTE: std::map keeps game tags sorted, so GetGameTag() can use
+        // binary search on them.
+        for (const auto& [tag, value] : card->gameTags)
+        {
+            tags[tagIdx++] = { static_cast<std::int32_t>(tag), value };
+        }
+
+        dbfIndex[i] = { card->dbfID, static_cast<std::uint32_t>(i) };
+    }
+
+    std::stable_sort(dbfIndex, dbfIndex + cards.size(),
+                     [](const DbfIndexEntry& a, const DbfIndexEntry& b) {
+                         return a.dbfID < b.dbfID;
+                     });
+
+    return image;
+}
+
+void CardImage::Save(const std::vector<Card*>& cards, const std::string& path)
+{
+    const auto image = Build(cards);
+
+    // Write to a temporary file and rename it so that readers never see
+    // a partially written image
+    const std::string tmpPath = path + ".tmp";
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Can't write card image: " + path);
+    }
+
+    file.write(image.data(), static_cast<std::streamsize>(image.size()));
+    file.close();
+
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        throw std::runtime_error("Can't write card image: " + path);
+    }
+}
+
+void CardImage::Publish(const std::vector<Card*>& cards,
+                        const std::string& name)
+{
+#ifndef ROSETTASTONE_WINDOWS
+    const auto image = Build(cards);
+
+    // NOTE: An existing segment may be mapped by workers, and truncating it
+    // would make their reads fail with SIGBUS. So the segment is never
+    // overwritten, and Unpublish() must be called to replace it.
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0)
+    {
+        throw std::runtime_error(
+            errno == EEXIST ? "Shared memory already exists: " + name
+                            : "Can't create shared memory: " + name);
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(image.size())) != 0)
+    {
+        close(fd);
+        shm_unlink(name.c_str());
+        throw std::runtime_error("Can't resize shared memory: " + name);
+    }
+
+    void* addr =
+        mmap(nullptr, image.size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+        shm_unlink(name.c_str());
+        throw std::runtime_error("Can't map shared memory: " + name);
+    }
+
+    // NOTE: The header is written last, so a process that attaches while the
+    // image is being written fails validation instead of reading a partial
+    // image.
+    auto* dest = static_cast<char*>(addr);
+    std::memcpy(dest + sizeof(Header), image.data() + sizeof(Header),
+                image.size() - sizeof(Header));
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(dest, image.data(), sizeof(Header));
+    munmap(addr, image.size());
+#else
+    (void)cards;
+    throw std::runtime_error("Shared memory is not supported: " + name);
+#endif
+}
+
+void CardImage::Unpublish(const std::string& name)
+{
+#ifndef ROSETTASTONE_WINDOWS
+    shm_unlink(name.c_str());
+#else
+    (void)name;
+#endif
+}
+
+void CardImage::Open(const std::string& path)
+{
+    Close();
+
+#ifndef ROSETTASTONE_WINDOWS
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Can't open card image: " + path);
+    }
+
+    std::tie(m_data, m_size) = MapReadOnly(fd, path);
+    m_isMapped = true;
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Can't open card image: " + path);
+    }
+
+    m_buffer.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+#endif
+
+    Validate();
+}
+
+void CardImage::Attach(const std::string& name)
+{
+    Close();
+
+#ifndef ROSETTASTONE_WINDOWS
+    const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Can't open shared memory: " + name);
+    }
+
+    std::tie(m_data, m_size) = MapReadOnly(fd, name);
+    m_isMapped = true;
+#else
+    throw std::runtime_error("Shared memory is not supported: " + name);
+#endif
+
+    Validate();
+    std::atomic_thread_fence(std::memory_order_acquire);
+}
+
+void CardImage::Close()
+{
+#ifndef ROSETTASTONE_WINDOWS
+    if (m_isMapped)
+    {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+
+    m_buffer.clear();
+    m_data = nullptr;
+    m_size = 0;
+    m_isMapped = false;
+}
+
+bool CardImage::IsOpen() const
+{
+    return m_data != nullptr;
+}
+
+std::size_t CardImage::GetCount() const
+{
+    return IsOpen() ? reinterpret_cast<const Header*>(m_data)->numCards : 0;
+}
+
+const CardImage::Record& CardImage::GetRecord(std::size_t idx) const
+{
+    const auto* header = reinterpret_cast<const Header*>(m_data);
+    const auto* records =
+        reinterpret_cast<const Record*>(m_data + header->recordsOffset);
+
+    return records[idx];
+}
+
+std::string_view CardImage::GetString(const StringRef& ref) const
+{
+    const auto* header = reinterpret_cast<const Header*>(m_data);
+
+    return std::string_view{ m_data + header->stringsOffset + ref.offset,
+                             ref.length };
+}
+
+int CardImage::GetGameTag(std::size_t idx, GameTag tag) const
+{
+    const auto* header = reinterpret_cast<const Header*>(m_data);
+    const auto* tags =
+        reinterpret_cast<const TagEntry*>(m_data + header->tagsOffset);
+    const Record& record = GetRecord(idx);
+
+    const TagEntry* begin = tags + record.tagsBegin;
+    const TagEntry* end = begin + record.numTags;
+    const auto key = static_cast<std::int32_t>(tag);
+
+    const auto iter =
+        std::lower_bound(begin, end, key,
+                         [](const TagEntry& entry, std::int32_t val) {
+                             return entry.tag < val;
+                         });
+
+    return (iter != end && iter->tag == key) ? iter->value : 0;
+}
+
+int CardImage::FindIndexByDbfID(int dbfID) const
+{
+    const auto* header = reinterpret_cast<const Header*>(m_data);
+    const auto* begin =
+        reinterpret_cast<const DbfIndexEntry*>(m_data + header->dbfIndexOffset);
+    const auto* end = begin + header->numCards;
+
+    const auto iter = std::lower_bound(
+        begin, end, dbfID, [](const DbfIndexEntry& entry, int val) {
+            return entry.dbfID < val;
+        });
+
+    return (iter != end && iter->dbfID == dbfID)
+               ? static_cast<int>(iter->recordIdx)
+               : -1;
+}
+
+void CardImage::Load(std::vector<Card*>& cards) const
+{
+    const auto* header = reinterpret_cast<const Header*>(m_data);
+    const auto* tags =
+        reinterpret_cast<const TagEntry*>(m_data + header->tagsOffset);
+
+    cards.reserve(cards.size() + header->numCards);
+
+    for (std::size_t i = 0; i < header->numCards; ++i)
+    {
+        const Record& record = GetRecord(i);
+
+        Card* card = new Card();
+        card->id = GetString(record.id);
+        card->dbfID = record.dbfID;
+        card->name = GetString(record.name);
+        card->text = GetString(record.text);
+
+        for (std::uint32_t j = 0; j < record.numTags; ++j)
+        {
+            const TagEntry& entry = tags[record.tagsBegin + j];
+            card->gameTags.emplace_hint(card->gameTags.end(),
+                                        static_cast<GameTag>(entry.tag),
+                                        entry.value);
+        }
+
+        cards.emplace_back(card);
+    }
+}
+
+void CardImage::Validate() const
+{
+    if (m_size < sizeof(Header))
+    {
+        throw std::runtime_error("Invalid card image: too small");
+    }
+
+    const auto* header = reinterpret_cast<const Header*>(m_data);
+
+    if (std::memcmp(header->magic, CARD_IMAGE_MAGIC, sizeof(header->magic)) !=
+        0)
+    {
+        throw std::runtime_error("Invalid card image: bad magic");
+    }
+
+    if (header->version != CARD_IMAGE_VERSION)
+    {
+        throw std::runtime_error("Invalid card image: unsupported version");
+    }
+
+    if (header->size > m_size || header->stringsOffset > header->size)
+    {
+        throw std::runtime_error("Invalid card image: truncated");
+    }
+}
+}  // namespace RosettaStone::PlayMode
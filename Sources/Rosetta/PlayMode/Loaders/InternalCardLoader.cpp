@@ -4,14 +4,36 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Common/StartupProfiler.hpp>
 #include <Rosetta/PlayMode/Cards/CardDefs.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Loaders/InternalCardLoader.hpp>
 
+#include <string_view>
+#include <unordered_map>
+
 namespace RosettaStone::PlayMode
 {
 void InternalCardLoader::Load(const std::vector<Card*>& cards)
 {
+    {
+        StartupProfiler::ScopedPhase phase("CardDefs");
+        CardDefs::GetInstance();
+    }
+
+    // NOTE: Finds the cards in the list being loaded, not in Cards, so that
+    // a card database of another version refers to its own cards.
+    std::unordered_map<std::string_view, int> dbfIDs;
+    dbfIDs.reserve(cards.size());
+    for (const auto& card : cards)
+    {
+        dbfIDs.emplace(card->id, card->dbfID);
+    }
+
+    const auto findDbfID = [&dbfIDs](const std::string& id) {
+        const auto iter = dbfIDs.find(id);
+        return iter != dbfIDs.end() ? iter->second : 0;
+    };
+
     for (const auto& card : cards)
     {
         const auto cardDef = CardDefs::GetInstance().FindCardDefByID(card->id);
@@ -25,11 +47,11 @@ void InternalCardLoader::Load(const std::vector<Card*>& cards)
             cardDef.property.questProgressTotal;
         card->gameTags[GameTag::HERO_POWER] = cardDef.property.heroPowerDbfID;
         card->gameTags[GameTag::CORRUPTEDCARD] =
-            Cards::FindCardByID(cardDef.property.corruptCardID)->dbfID;
+            findDbfID(cardDef.property.corruptCardID);
         card->gameTags[GameTag::NUM_MINIONS_TO_INFUSE] =
             cardDef.property.numMinionsToInfuse;
         card->gameTags[GameTag::INFUSEDCARD] =
-            Cards::FindCardByID(cardDef.property.infusedCardID)->dbfID;
+            findDbfID(cardDef.property.infusedCardID);
 
         // NOTE: Load some game tag data
         // Scheme series
@@ -0,0 +1,178 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Managers/ActionEncoder.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+//! Returns the index of \p action or NUM_ACTIONS if it is out of the action
+//! space.
+//! \param action The action to encode.
+//! \return The index of \p action or NUM_ACTIONS.
+std::size_t ToIndex(const Action& action)
+{
+    using Encoder = ActionEncoder;
+
+    const auto isIn = [](int value, std::size_t size) {
+        return value >= 0 && static_cast<std::size_t>(value) < size;
+    };
+    // NOTE: Target 0 means no target and defenders are opponent characters.
+    const int target = action.target + 1;
+    const int defender =
+        action.target - static_cast<int>(Encoder::NUM_SIDE_CHARACTERS);
+
+    switch (action.type)
+    {
+        case ActionType::PLAY_CARD:
+            if (!isIn(action.index, MAX_HAND_SIZE) ||
+                !isIn(action.chooseOne, Encoder::NUM_CHOOSE_ONE_OPTIONS) ||
+                !isIn(target, Encoder::NUM_TARGETS) || action.position != -1)
+            {
+                break;
+            }
+            return Encoder::PLAY_CARD_OFFSET +
+                   (action.index * Encoder::NUM_CHOOSE_ONE_OPTIONS +
+                    action.chooseOne) *
+                       Encoder::NUM_TARGETS +
+                   target;
+        case ActionType::ATTACK:
+            if (!isIn(action.index, Encoder::NUM_SIDE_CHARACTERS) ||
+                !isIn(defender, Encoder::NUM_SIDE_CHARACTERS))
+            {
+                break;
+            }
+            return Encoder::ATTACK_OFFSET +
+                   action.index * Encoder::NUM_SIDE_CHARACTERS + defender;
+        case ActionType::HERO_POWER:
+            if (!isIn(target, Encoder::NUM_TARGETS))
+            {
+                break;
+            }
+            return Encoder::HERO_POWER_OFFSET + target;
+        case ActionType::TRADE_CARD:
+            if (!isIn(action.index, MAX_HAND_SIZE))
+            {
+                break;
+            }
+            return Encoder::TRADE_CARD_OFFSET + action.index;
+        case ActionType::CHOOSE:
+            if (!isIn(action.index, Encoder::NUM_CHOICES))
+            {
+                break;
+            }
+            return Encoder::CHOOSE_OFFSET + action.index;
+        case ActionType::END_TURN:
+            return Encoder::END_TURN_OFFSET;
+    }
+
+    return Encoder::NUM_ACTIONS;
+}
+}  // namespace
+
+ActionEncoder::ActionEncoder(std::size_t numThreads) : m_pool(numThreads)
+{
+    // Do nothing
+}
+
+std::size_t ActionEncoder::Encode(const Action& action)
+{
+    const std::size_t actionIdx = ToIndex(action);
+    if (actionIdx == NUM_ACTIONS)
+    {
+        throw std::invalid_argument(
+            "The action is out of the action space");
+    }
+
+    return actionIdx;
+}
+
+Action ActionEncoder::Decode(std::size_t actionIdx)
+{
+    if (actionIdx >= NUM_ACTIONS)
+    {
+        throw std::out_of_range("The index is out of the action space");
+    }
+
+    Action action;
+
+    if (actionIdx < ATTACK_OFFSET)
+    {
+        const std::size_t idx = actionIdx - PLAY_CARD_OFFSET;
+        action.type = ActionType::PLAY_CARD;
+        action.index = static_cast<int>(
+            idx / (NUM_CHOOSE_ONE_OPTIONS * NUM_TARGETS));
+        action.chooseOne = static_cast<int>(
+            idx / NUM_TARGETS % NUM_CHOOSE_ONE_OPTIONS);
+        action.target = static_cast<int>(idx % NUM_TARGETS) - 1;
+    }
+    else if (actionIdx < HERO_POWER_OFFSET)
+    {
+        const std::size_t idx = actionIdx - ATTACK_OFFSET;
+        action.type = ActionType::ATTACK;
+        action.index = static_cast<int>(idx / NUM_SIDE_CHARACTERS);
+        action.target =
+            static_cast<int>(idx % NUM_SIDE_CHARACTERS + NUM_SIDE_CHARACTERS);
+    }
+    else if (actionIdx < TRADE_CARD_OFFSET)
+    {
+        action.type = ActionType::HERO_POWER;
+        action.target = static_cast<int>(actionIdx - HERO_POWER_OFFSET) - 1;
+    }
+    else if (actionIdx < CHOOSE_OFFSET)
+    {
+        action.type = ActionType::TRADE_CARD;
+        action.index = static_cast<int>(actionIdx - TRADE_CARD_OFFSET);
+    }
+    else if (actionIdx < END_TURN_OFFSET)
+    {
+        action.type = ActionType::CHOOSE;
+        action.index = static_cast<int>(actionIdx - CHOOSE_OFFSET);
+    }
+
+    return action;
+}
+
+void ActionEncoder::WriteMask(Game& game, std::uint8_t* mask)
+{
+    std::fill(mask, mask + NUM_ACTIONS, 0);
+
+    // NOTE: The lambda only captures a pointer, so std::function stores it
+    // without allocation.
+    ForEachLegalAction(game, [mask](const Action& action) {
+        if (const std::size_t actionIdx = ToIndex(action);
+            actionIdx < NUM_ACTIONS)
+        {
+            mask[actionIdx] = 1;
+        }
+    });
+}
+
+void ActionEncoder::WriteMaskBatch(const std::vector<Game*>& games,
+                                   std::uint8_t* masks)
+{
+    const auto write = [&](std::size_t gameIdx) {
+        WriteMask(*games[gameIdx], masks + gameIdx * NUM_ACTIONS);
+    };
+
+    if (m_pool.GetNumThreads() > 1)
+    {
+        m_pool.ParallelFor(games.size(), write);
+    }
+    else
+    {
+        for (std::size_t gameIdx = 0; gameIdx < games.size(); ++gameIdx)
+        {
+            write(gameIdx);
+        }
+    }
+}
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,69 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Managers/GameRecordReader.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode
+{
+GameRecordReader::GameRecordReader(const std::string& path,
+                                   const CardDatabase* cardDatabase)
+    : m_path(path),
+      m_file(path, std::ios::binary),
+      m_cardDatabase(cardDatabase)
+{
+    GameRecordFile::FileHeader header{};
+    m_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    if (!m_file || std::memcmp(header.magic, GameRecordFile::MAGIC,
+                               sizeof(header.magic)) != 0)
+    {
+        throw std::runtime_error("Invalid game record file: " + path);
+    }
+
+    if (header.version != GameRecordFile::VERSION)
+    {
+        throw std::runtime_error("Unsupported game record file version: " +
+                                 std::to_string(header.version));
+    }
+}
+
+bool GameRecordReader::Read(GameRecord& record)
+{
+    std::uint32_t size = 0;
+    m_file.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (m_file.gcount() != sizeof(size))
+    {
+        return false;
+    }
+
+    if (size > GameRecordFile::MAX_RECORD_SIZE)
+    {
+        throw std::runtime_error("Corrupted game record: invalid size");
+    }
+
+    m_buffer.resize(size);
+    m_file.read(m_buffer.data(), static_cast<std::streamsize>(size));
+    if (m_file.gcount() != static_cast<std::streamsize>(size))
+    {
+        return false;
+    }
+
+    GameRecordFile::Decode(m_buffer.data(), m_buffer.size(), m_cardDatabase,
+                           record);
+    ++m_numRecords;
+
+    return true;
+}
+
+std::size_t GameRecordReader::GetNumRecords() const
+{
+    return m_numRecords;
+}
+}  // namespace RosettaStone::PlayMode
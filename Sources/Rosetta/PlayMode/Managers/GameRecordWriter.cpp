@@ -0,0 +1,112 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Managers/GameRecordWriter.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode
+{
+GameRecordWriter::GameRecordWriter(const std::string& path)
+    : m_path(path), m_file(path, std::ios::binary | std::ios::trunc)
+{
+    GameRecordFile::FileHeader header{};
+    std::memcpy(header.magic, GameRecordFile::MAGIC, sizeof(header.magic));
+    header.version = GameRecordFile::VERSION;
+
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!m_file)
+    {
+        throw std::runtime_error("Can't write game record file: " + path);
+    }
+    m_numBytes = sizeof(header);
+}
+
+GameRecordWriter::~GameRecordWriter()
+{
+    try
+    {
+        Close();
+    }
+    catch (...)
+    {
+        // NOTE: The error can't be reported from the destructor.
+    }
+}
+
+void GameRecordWriter::Write(const GameRecord& record)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_file.is_open())
+    {
+        throw std::runtime_error("Game record file is closed: " + m_path);
+    }
+
+    // NOTE: The size is written in front of the payload after encoding, so
+    // its bytes are reserved first.
+    m_buffer.assign(sizeof(std::uint32_t), 0);
+    GameRecordFile::Encode(record, m_buffer);
+
+    const std::size_t payloadSize = m_buffer.size() - sizeof(std::uint32_t);
+    if (payloadSize > GameRecordFile::MAX_RECORD_SIZE)
+    {
+        throw std::length_error("Game record is too large");
+    }
+
+    const auto size = static_cast<std::uint32_t>(payloadSize);
+    std::memcpy(m_buffer.data(), &size, sizeof(size));
+
+    m_file.write(m_buffer.data(),
+                 static_cast<std::streamsize>(m_buffer.size()));
+    if (!m_file)
+    {
+        throw std::runtime_error("Can't write game record file: " + m_path);
+    }
+
+    ++m_numRecords;
+    m_numBytes += m_buffer.size();
+}
+
+void GameRecordWriter::Flush()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_file.is_open() && !m_file.flush())
+    {
+        throw std::runtime_error("Can't write game record file: " + m_path);
+    }
+}
+
+void GameRecordWriter::Close()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_file.is_open())
+    {
+        return;
+    }
+
+    m_file.close();
+    if (!m_file)
+    {
+        throw std::runtime_error("Can't write game record file: " + m_path);
+    }
+}
+
+std::size_t GameRecordWriter::GetNumRecords() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numRecords;
+}
+
+std::uint64_t GameRecordWriter::GetNumBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numBytes;
+}
+}  // namespace RosettaStone::PlayMode
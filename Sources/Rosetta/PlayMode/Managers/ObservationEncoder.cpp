@@ -0,0 +1,164 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Cards/Card.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Managers/ObservationEncoder.hpp>
+
+#include <algorithm>
+
+namespace RosettaStone::PlayMode
+{
+namespace
+{
+//! Converts \p value to a feature.
+template <typename T>
+float ToFeature(T value)
+{
+    return static_cast<float>(value);
+}
+
+//! Writes the minion on the field.
+//! \param minion The minion to write.
+//! \param features The buffer of NUM_MINION_FEATURES elements.
+void WriteMinion(const EntityView& minion, float* features)
+{
+    features[0] = 1.0f;
+    features[1] = ToFeature(minion.GetCard().dbfID);
+    features[2] = ToFeature(minion.GetAttack());
+    features[3] = ToFeature(minion.GetHealth());
+    features[4] = ToFeature(minion.GetBaseHealth());
+    features[5] = ToFeature(minion.GetCost());
+    features[6] = ToFeature(minion.GetSpellPower());
+    features[7] = ToFeature(minion.CanAttack());
+    features[8] = ToFeature(minion.HasTaunt());
+    features[9] = ToFeature(minion.HasDivineShield());
+    features[10] = ToFeature(minion.HasCharge());
+    features[11] = ToFeature(minion.HasRush());
+    features[12] = ToFeature(minion.HasWindfury());
+    features[13] = ToFeature(minion.HasStealth());
+    features[14] = ToFeature(minion.HasPoisonous());
+    features[15] = ToFeature(minion.HasLifesteal());
+    features[16] = ToFeature(minion.IsFrozen());
+    features[17] = ToFeature(minion.HasDeathrattle());
+    features[18] = ToFeature(minion.HasReborn());
+    features[19] = ToFeature(minion.IsSilenced());
+}
+
+//! Writes the block of the player.
+//! \param player The view of the player to write.
+//! \param features The buffer of NUM_BLOCK_FEATURES elements.
+void WriteBlock(const PlayerView& player, float* features)
+{
+    features[0] = ToFeature(player.GetClass());
+    features[1] = ToFeature(player.GetTotalMana());
+    features[2] = ToFeature(player.GetRemainingMana());
+    features[3] = ToFeature(player.GetOverloadOwed());
+    features[4] = ToFeature(player.GetOverloadLocked());
+    features[5] = ToFeature(player.GetHandCount());
+    features[6] = ToFeature(player.GetDeckCount());
+    features[7] = ToFeature(player.GetSecretCount());
+    features[8] = ToFeature(player.IsCurrentPlayer());
+    features += ObservationEncoder::NUM_PLAYER_FEATURES;
+
+    const EntityView hero = player.GetHero();
+    features[0] = ToFeature(hero.GetCard().dbfID);
+    features[1] = ToFeature(hero.GetHealth());
+    features[2] = ToFeature(hero.GetArmor());
+    features[3] = ToFeature(hero.GetAttack());
+    features[4] = ToFeature(hero.CanAttack());
+    features[5] = ToFeature(hero.IsFrozen());
+    features[6] = ToFeature(hero.IsImmune());
+    features[7] = ToFeature(hero.HasStealth());
+    features += ObservationEncoder::NUM_HERO_FEATURES;
+
+    const EntityView heroPower = player.GetHeroPower();
+    features[0] = ToFeature(heroPower.GetCard().dbfID);
+    features[1] = ToFeature(heroPower.GetCost());
+    features[2] = ToFeature(heroPower.IsExhausted());
+    features += ObservationEncoder::NUM_HERO_POWER_FEATURES;
+
+    if (player.HasWeapon())
+    {
+        const EntityView weapon = player.GetWeapon();
+        features[0] = 1.0f;
+        features[1] = ToFeature(weapon.GetCard().dbfID);
+        features[2] = ToFeature(weapon.GetAttack());
+        features[3] = ToFeature(weapon.GetDurability());
+    }
+    features += ObservationEncoder::NUM_WEAPON_FEATURES;
+
+    player.ForEachMinion([&](const EntityView& minion) {
+        WriteMinion(minion, features);
+        features += ObservationEncoder::NUM_MINION_FEATURES;
+    });
+}
+
+//! Writes the cards in hand of the player.
+//! \param player The view of the player to write.
+//! \param features The buffer of MAX_HAND_SIZE * NUM_HAND_FEATURES elements.
+void WriteHand(const PlayerView& player, float* features)
+{
+    player.ForEachHandCard([&](const EntityView* card) {
+        features[0] = 1.0f;
+        features[1] = ToFeature(card->GetCard().dbfID);
+        features[2] = ToFeature(card->GetCost());
+        features[3] = ToFeature(card->GetCard().GetCardType());
+        features[4] = ToFeature(card->GetAttack());
+
+        const bool isWeapon = card->GetCard().GetCardType() == CardType::WEAPON;
+        features[5] =
+            ToFeature(isWeapon ? card->GetDurability() : card->GetHealth());
+
+        features += ObservationEncoder::NUM_HAND_FEATURES;
+    });
+}
+}  // namespace
+
+ObservationEncoder::ObservationEncoder(std::size_t numThreads)
+    : m_pool(numThreads)
+{
+    // Do nothing
+}
+
+void ObservationEncoder::Encode(const ObservationView& view,
+                                float* observation)
+{
+    std::fill(observation, observation + NUM_FEATURES, 0.0f);
+
+    const PlayerView player = view.GetPlayer();
+    observation[GAME_OFFSET] = ToFeature(view.GetTurn());
+    WriteBlock(player, observation + PLAYER_OFFSET);
+    WriteBlock(view.GetOpponent(), observation + OPPONENT_OFFSET);
+    WriteHand(player, observation + HAND_OFFSET);
+}
+
+void ObservationEncoder::Encode(const Player& player, float* observation)
+{
+    Encode(ObservationView(player), observation);
+}
+
+void ObservationEncoder::EncodeBatch(const std::vector<Game*>& games,
+                                     float* observations)
+{
+    const auto encode = [&](std::size_t gameIdx) {
+        Encode(*games[gameIdx]->GetCurrentPlayer(),
+               observations + gameIdx * NUM_FEATURES);
+    };
+
+    if (m_pool.GetNumThreads() > 1)
+    {
+        m_pool.ParallelFor(games.size(), encode);
+    }
+    else
+    {
+        for (std::size_t gameIdx = 0; gameIdx < games.size(); ++gameIdx)
+        {
+            encode(gameIdx);
+        }
+    }
+}
+}  // namespace RosettaStone::PlayMode
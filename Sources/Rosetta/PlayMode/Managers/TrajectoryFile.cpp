@@ -0,0 +1,115 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Managers/TrajectoryFile.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace RosettaStone::PlayMode::TrajectoryFile
+{
+namespace
+{
+//! A token below it is a literal run of (token + 1) bytes and a token from
+//! it is a zero run of (token - ZERO_RUN + 1) bytes.
+constexpr unsigned char ZERO_RUN = 0x80;
+constexpr std::size_t MAX_RUN = 0x80;
+}  // namespace
+
+void Compress(const void* src, std::size_t rowSize, std::size_t numRows,
+              std::vector<char>& dst)
+{
+    const auto* bytes = static_cast<const unsigned char*>(src);
+    const std::size_t size = rowSize * numRows;
+
+    const auto delta = [&](std::size_t idx) {
+        return static_cast<unsigned char>(
+            idx < rowSize ? bytes[idx] : bytes[idx] ^ bytes[idx - rowSize]);
+    };
+
+    std::size_t idx = 0;
+    while (idx < size)
+    {
+        std::size_t runSize = 0;
+
+        if (delta(idx) == 0)
+        {
+            while (idx + runSize < size && runSize < MAX_RUN &&
+                   delta(idx + runSize) == 0)
+            {
+                ++runSize;
+            }
+
+            dst.emplace_back(static_cast<char>(ZERO_RUN + runSize - 1));
+        }
+        else
+        {
+            while (idx + runSize < size && runSize < MAX_RUN &&
+                   delta(idx + runSize) != 0)
+            {
+                ++runSize;
+            }
+
+            dst.emplace_back(static_cast<char>(runSize - 1));
+            for (std::size_t i = 0; i < runSize; ++i)
+            {
+                dst.emplace_back(static_cast<char>(delta(idx + i)));
+            }
+        }
+
+        idx += runSize;
+    }
+}
+
+void Decompress(const char* src, std::size_t srcSize, std::size_t rowSize,
+                std::size_t numRows, void* dst)
+{
+    auto* bytes = static_cast<unsigned char*>(dst);
+    const std::size_t size = rowSize * numRows;
+
+    std::size_t srcIdx = 0;
+    std::size_t idx = 0;
+
+    while (srcIdx < srcSize)
+    {
+        const auto token = static_cast<unsigned char>(src[srcIdx++]);
+
+        if (token >= ZERO_RUN)
+        {
+            const std::size_t runSize = token - ZERO_RUN + 1u;
+            if (idx + runSize > size)
+            {
+                throw std::runtime_error("Corrupted trajectory column");
+            }
+
+            std::memset(bytes + idx, 0, runSize);
+            idx += runSize;
+        }
+        else
+        {
+            const std::size_t runSize = token + 1u;
+            if (idx + runSize > size || srcIdx + runSize > srcSize)
+            {
+                throw std::runtime_error("Corrupted trajectory column");
+            }
+
+            std::memcpy(bytes + idx, src + srcIdx, runSize);
+            idx += runSize;
+            srcIdx += runSize;
+        }
+    }
+
+    if (idx != size)
+    {
+        throw std::runtime_error("Corrupted trajectory column");
+    }
+
+    for (std::size_t i = rowSize; i < size; ++i)
+    {
+        bytes[i] ^= bytes[i - rowSize];
+    }
+}
+}  // namespace RosettaStone::PlayMode::TrajectoryFile
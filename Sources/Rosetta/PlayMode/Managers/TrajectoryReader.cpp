@@ -0,0 +1,210 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/Macros.hpp>
+#include <Rosetta/PlayMode/Managers/TrajectoryReader.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#ifndef ROSETTASTONE_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace RosettaStone::PlayMode
+{
+TrajectoryReader::~TrajectoryReader()
+{
+    Close();
+}
+
+void TrajectoryReader::Open(const std::string& path)
+{
+    using namespace TrajectoryFile;
+
+    Close();
+
+#ifndef ROSETTASTONE_WINDOWS
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Can't open trajectory file: " + path);
+    }
+
+    struct stat st
+    {
+    };
+
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        throw std::runtime_error("Can't read trajectory file: " + path);
+    }
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (addr == MAP_FAILED)
+    {
+        throw std::runtime_error("Can't map trajectory file: " + path);
+    }
+
+    m_data = static_cast<const char*>(addr);
+    m_size = size;
+    m_isMapped = true;
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Can't open trajectory file: " + path);
+    }
+
+    m_buffer.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+#endif
+
+    if (m_size < sizeof(FileHeader))
+    {
+        Close();
+        throw std::runtime_error("Invalid trajectory file: " + path);
+    }
+
+    std::memcpy(&m_header, m_data, sizeof(FileHeader));
+    if (std::memcmp(m_header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        m_header.version != VERSION)
+    {
+        Close();
+        throw std::runtime_error("Invalid trajectory file: " + path);
+    }
+
+    std::size_t offset = sizeof(FileHeader);
+    while (offset + sizeof(ChunkHeader) <= m_size)
+    {
+        const ChunkHeader header = ReadChunkHeader(offset);
+
+        std::size_t chunkSize = sizeof(ChunkHeader);
+        for (const auto columnSize : header.columnSizes)
+        {
+            chunkSize += columnSize;
+        }
+
+        // NOTE: The last chunk may be partially written.
+        if (offset + chunkSize > m_size)
+        {
+            break;
+        }
+
+        m_chunkOffsets.emplace_back(offset);
+        m_numSteps += header.numSteps;
+        offset += chunkSize;
+    }
+}
+
+void TrajectoryReader::Close()
+{
+#ifndef ROSETTASTONE_WINDOWS
+    if (m_isMapped)
+    {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+
+    m_buffer.clear();
+    m_data = nullptr;
+    m_size = 0;
+    m_isMapped = false;
+
+    m_header = {};
+    m_chunkOffsets.clear();
+    m_numSteps = 0;
+}
+
+bool TrajectoryReader::IsOpen() const
+{
+    return m_data != nullptr;
+}
+
+std::size_t TrajectoryReader::GetNumFeatures() const
+{
+    return m_header.numFeatures;
+}
+
+std::size_t TrajectoryReader::GetNumActions() const
+{
+    return m_header.numActions;
+}
+
+std::size_t TrajectoryReader::GetNumChunks() const
+{
+    return m_chunkOffsets.size();
+}
+
+std::size_t TrajectoryReader::GetNumSteps() const
+{
+    return m_numSteps;
+}
+
+std::size_t TrajectoryReader::GetNumSteps(std::size_t chunkIdx) const
+{
+    return ReadChunkHeader(m_chunkOffsets.at(chunkIdx)).numSteps;
+}
+
+void TrajectoryReader::ReadChunk(std::size_t chunkIdx,
+                                 TrajectoryChunk& chunk) const
+{
+    using namespace TrajectoryFile;
+
+    const std::size_t offset = m_chunkOffsets.at(chunkIdx);
+    const ChunkHeader header = ReadChunkHeader(offset);
+    const std::size_t numSteps = header.numSteps;
+
+    chunk.numSteps = numSteps;
+    chunk.observations.resize(numSteps * m_header.numFeatures);
+    chunk.envs.resize(numSteps);
+    chunk.actions.resize(numSteps);
+    chunk.actionMasks.resize(numSteps * m_header.numActions);
+    chunk.rewards.resize(numSteps);
+    chunk.dones.resize(numSteps);
+
+    const std::pair<void*, std::size_t> columns[NUM_COLUMNS] = {
+        { chunk.observations.data(), sizeof(float) * m_header.numFeatures },
+        { chunk.envs.data(), sizeof(std::uint32_t) },
+        { chunk.actions.data(), sizeof(std::int32_t) },
+        { chunk.actionMasks.data(), m_header.numActions },
+        { chunk.rewards.data(), sizeof(float) },
+        { chunk.dones.data(), sizeof(std::uint8_t) },
+    };
+
+    const char* src = m_data + offset + sizeof(ChunkHeader);
+    for (std::size_t i = 0; i < NUM_COLUMNS; ++i)
+    {
+        const auto columnSize =
+            static_cast<std::size_t>(header.columnSizes[i]);
+        Decompress(src, columnSize, columns[i].second, numSteps,
+                   columns[i].first);
+        src += columnSize;
+    }
+}
+
+TrajectoryFile::ChunkHeader TrajectoryReader::ReadChunkHeader(
+    std::size_t offset) const
+{
+    // NOTE: Chunks are not aligned, so the header is copied.
+    TrajectoryFile::ChunkHeader header{};
+    std::memcpy(&header, m_data + offset, sizeof(header));
+
+    return header;
+}
+}  // namespace RosettaStone::PlayMode
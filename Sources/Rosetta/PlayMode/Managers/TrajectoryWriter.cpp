@@ -0,0 +1,344 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Managers/ActionEncoder.hpp>
+#include <Rosetta/PlayMode/Managers/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Managers/TrajectoryWriter.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace RosettaStone::PlayMode
+{
+TrajectoryWriter::TrajectoryWriter(const std::string& path,
+                                   std::size_t chunkSize,
+                                   std::size_t maxPendingChunks)
+    : m_path(path),
+      m_file(path, std::ios::binary | std::ios::trunc),
+      m_chunkSize(chunkSize),
+      m_maxPendingChunks(maxPendingChunks)
+{
+    TrajectoryFile::FileHeader header{};
+    std::memcpy(header.magic, TrajectoryFile::MAGIC, sizeof(header.magic));
+    header.version = TrajectoryFile::VERSION;
+    header.numFeatures =
+        static_cast<std::uint32_t>(ObservationEncoder::NUM_FEATURES);
+    header.numActions = static_cast<std::uint32_t>(ActionEncoder::NUM_ACTIONS);
+
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!m_file || m_chunkSize == 0 || m_maxPendingChunks == 0)
+    {
+        throw std::runtime_error("Can't write trajectory file: " + path);
+    }
+    m_numBytes = sizeof(header);
+
+    m_chunk = MakeChunk();
+    m_thread = std::thread(&TrajectoryWriter::Run, this);
+}
+
+TrajectoryWriter::~TrajectoryWriter()
+{
+    try
+    {
+        Close();
+    }
+    catch (...)
+    {
+        // NOTE: The error was already reported by Append() or Flush(), or
+        // it can't be reported from the destructor.
+    }
+}
+
+void TrajectoryWriter::Append(std::size_t envIdx, const float* observation,
+                              int actionIdx, const std::uint8_t* actionMask,
+                              float reward, bool done)
+{
+    constexpr std::size_t NUM_FEATURES = ObservationEncoder::NUM_FEATURES;
+    constexpr std::size_t NUM_ACTIONS = ActionEncoder::NUM_ACTIONS;
+
+    std::lock_guard<std::mutex> lock(m_appendMutex);
+
+    if (!m_chunk)
+    {
+        throw std::runtime_error("Trajectory file is closed: " + m_path);
+    }
+
+    // NOTE: A full chunk is handed over here rather than right after it is
+    // filled, so a chunk that failed to be handed over is never overfilled.
+    if (m_chunk->numSteps == m_chunkSize)
+    {
+        PushChunk();
+    }
+
+    TrajectoryChunk& chunk = *m_chunk;
+    const std::size_t stepIdx = chunk.numSteps++;
+
+    std::copy_n(observation, NUM_FEATURES,
+                &chunk.observations[stepIdx * NUM_FEATURES]);
+    chunk.envs[stepIdx] = static_cast<std::uint32_t>(envIdx);
+    chunk.actions[stepIdx] = actionIdx;
+    std::copy_n(actionMask, NUM_ACTIONS,
+                &chunk.actionMasks[stepIdx * NUM_ACTIONS]);
+    chunk.rewards[stepIdx] = reward;
+    chunk.dones[stepIdx] = done ? 1 : 0;
+
+    ++m_numSteps;
+}
+
+void TrajectoryWriter::AppendBatch(std::size_t numEnvs,
+                                   const float* observations,
+                                   const std::int32_t* actionIndices,
+                                   const std::uint8_t* actionMasks,
+                                   const float* rewards,
+                                   const std::uint8_t* dones)
+{
+    for (std::size_t envIdx = 0; envIdx < numEnvs; ++envIdx)
+    {
+        Append(envIdx, observations + envIdx * ObservationEncoder::NUM_FEATURES,
+               actionIndices[envIdx],
+               actionMasks + envIdx * ActionEncoder::NUM_ACTIONS,
+               rewards[envIdx], dones[envIdx] != 0);
+    }
+}
+
+void TrajectoryWriter::Flush()
+{
+    std::uint64_t flushRequest = 0;
+
+    {
+        std::lock_guard<std::mutex> appendLock(m_appendMutex);
+
+        if (!m_chunk)
+        {
+            return;
+        }
+
+        if (m_chunk->numSteps > 0)
+        {
+            PushChunk();
+        }
+
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        CheckError();
+
+        flushRequest = ++m_numFlushRequests;
+        m_flushTarget = m_numPushedChunks;
+    }
+
+    m_queueCondition.notify_one();
+
+    // NOTE: m_appendMutex is released, so Append() can fill the next chunk
+    // while the background thread writes and flushes the file.
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+    m_writtenCondition.wait(lock, [this, flushRequest] {
+        return m_numFlushes >= flushRequest || m_error;
+    });
+    CheckError();
+}
+
+void TrajectoryWriter::Close()
+{
+    // NOTE: The background thread is stopped even if the steps can't be
+    // written, so that the destructor never leaves it running.
+    std::exception_ptr error;
+    try
+    {
+        Flush();
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    {
+        std::lock_guard<std::mutex> appendLock(m_appendMutex);
+        if (!m_chunk)
+        {
+            return;
+        }
+        m_chunk.reset();
+
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stop = true;
+    }
+
+    m_queueCondition.notify_one();
+    m_thread.join();
+    m_file.close();
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+std::size_t TrajectoryWriter::GetNumSteps() const
+{
+    return m_numSteps;
+}
+
+std::uint64_t TrajectoryWriter::GetNumBytes() const
+{
+    return m_numBytes;
+}
+
+std::unique_ptr<TrajectoryChunk> TrajectoryWriter::MakeChunk() const
+{
+    auto chunk = std::make_unique<TrajectoryChunk>();
+    chunk->observations.resize(m_chunkSize * ObservationEncoder::NUM_FEATURES);
+    chunk->envs.resize(m_chunkSize);
+    chunk->actions.resize(m_chunkSize);
+    chunk->actionMasks.resize(m_chunkSize * ActionEncoder::NUM_ACTIONS);
+    chunk->rewards.resize(m_chunkSize);
+    chunk->dones.resize(m_chunkSize);
+
+    return chunk;
+}
+
+void TrajectoryWriter::PushChunk()
+{
+    std::unique_ptr<TrajectoryChunk> nextChunk;
+
+    {
+        std::unique_lock<std::mutex> lock(m_queueMutex);
+        m_writtenCondition.wait(lock, [this] {
+            return m_pendingChunks.size() < m_maxPendingChunks || m_error;
+        });
+        CheckError();
+
+        m_pendingChunks.emplace_back(std::move(m_chunk));
+        ++m_numPushedChunks;
+        if (!m_freeChunks.empty())
+        {
+            nextChunk = std::move(m_freeChunks.back());
+            m_freeChunks.pop_back();
+        }
+    }
+
+    m_queueCondition.notify_one();
+    m_chunk = nextChunk ? std::move(nextChunk) : MakeChunk();
+}
+
+void TrajectoryWriter::CheckError() const
+{
+    if (m_error)
+    {
+        std::rethrow_exception(m_error);
+    }
+}
+
+void TrajectoryWriter::Run()
+{
+    while (true)
+    {
+        std::unique_ptr<TrajectoryChunk> chunk;
+        std::uint64_t numFlushRequests = 0;
+
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCondition.wait(lock, [this] {
+                return m_stop || !m_pendingChunks.empty() ||
+                       m_numFlushes < m_numFlushRequests;
+            });
+
+            // NOTE: A flush is done as soon as the chunks pushed before it
+            // are written, so appending steps can't delay it.
+            if (m_numFlushes < m_numFlushRequests &&
+                m_numWrittenChunks >= m_flushTarget)
+            {
+                numFlushRequests = m_numFlushRequests;
+            }
+            else if (!m_pendingChunks.empty())
+            {
+                chunk = std::move(m_pendingChunks.front());
+                m_pendingChunks.pop_front();
+            }
+            else
+            {
+                return;
+            }
+        }
+
+        try
+        {
+            if (!m_error && chunk)
+            {
+                WriteChunk(*chunk);
+            }
+            else if (!m_error)
+            {
+                m_file.flush();
+                if (!m_file)
+                {
+                    throw std::runtime_error("Can't write trajectory file: " +
+                                             m_path);
+                }
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            if (chunk)
+            {
+                chunk->numSteps = 0;
+                m_freeChunks.emplace_back(std::move(chunk));
+                ++m_numWrittenChunks;
+            }
+            else
+            {
+                m_numFlushes = numFlushRequests;
+            }
+        }
+
+        m_writtenCondition.notify_all();
+    }
+}
+
+void TrajectoryWriter::WriteChunk(const TrajectoryChunk& chunk)
+{
+    using namespace TrajectoryFile;
+
+    const std::size_t numSteps = chunk.numSteps;
+    const std::pair<const void*, std::size_t> columns[NUM_COLUMNS] = {
+        { chunk.observations.data(),
+          sizeof(float) * ObservationEncoder::NUM_FEATURES },
+        { chunk.envs.data(), sizeof(std::uint32_t) },
+        { chunk.actions.data(), sizeof(std::int32_t) },
+        { chunk.actionMasks.data(), ActionEncoder::NUM_ACTIONS },
+        { chunk.rewards.data(), sizeof(float) },
+        { chunk.dones.data(), sizeof(std::uint8_t) },
+    };
+
+    ChunkHeader header{};
+    header.numSteps = static_cast<std::uint32_t>(numSteps);
+    m_compressed.clear();
+
+    for (std::size_t i = 0; i < NUM_COLUMNS; ++i)
+    {
+        const std::size_t prevSize = m_compressed.size();
+        Compress(columns[i].first, columns[i].second, numSteps, m_compressed);
+        header.columnSizes[i] = m_compressed.size() - prevSize;
+    }
+
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_file.write(m_compressed.data(),
+                 static_cast<std::streamsize>(m_compressed.size()));
+
+    if (!m_file)
+    {
+        throw std::runtime_error("Can't write trajectory file: " + m_path);
+    }
+
+    m_numBytes += sizeof(header) + m_compressed.size();
+}
+}  // namespace RosettaStone::PlayMode
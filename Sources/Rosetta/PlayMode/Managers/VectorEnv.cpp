@@ -0,0 +1,323 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Common/Utils.hpp>
+#include <Rosetta/PlayMode/Managers/VectorEnv.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+
+#include <effolkronium/random.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+using Random = effolkronium::random_thread_local;
+
+namespace RosettaStone::PlayMode
+{
+VectorEnv::VectorEnv(const GameConfig& gameConfig, std::size_t numEnvs,
+                     std::size_t numThreads)
+    : m_gameConfig(gameConfig),
+      m_games(numEnvs),
+      m_numEpisodes(numEnvs, 0),
+      m_numSteps(numEnvs, 0),
+      m_pool(numThreads)
+{
+    m_gameConfig.skipMulligan = true;
+    m_gameConfig.autoRun = true;
+
+    for (auto& buffers : m_buffers)
+    {
+        buffers.observations.assign(
+            numEnvs * ObservationEncoder::NUM_FEATURES, 0.0f);
+        buffers.actionMasks.assign(numEnvs * ActionEncoder::NUM_ACTIONS, 0);
+        buffers.currentPlayers.assign(numEnvs, 0);
+        buffers.turns.assign(numEnvs, 0);
+        buffers.rewards.assign(numEnvs * 2, 0.0f);
+        buffers.dones.assign(numEnvs, 0);
+    }
+}
+
+template <typename F>
+void VectorEnv::ForEachEnv(F&& func)
+{
+    if (m_pool.GetNumThreads() > 1)
+    {
+        m_pool.ParallelFor(m_games.size(), func);
+    }
+    else
+    {
+        for (std::size_t envIdx = 0; envIdx < m_games.size(); ++envIdx)
+        {
+            func(envIdx);
+        }
+    }
+}
+
+void VectorEnv::SetMaxTurns(int maxTurns)
+{
+    m_maxTurns = maxTurns;
+}
+
+void VectorEnv::Reset(unsigned int seed)
+{
+    std::lock_guard<std::mutex> lock(m_stepMutex);
+    Buffers& back = m_buffers[m_front ^ 1];
+
+    // NOTE: The games are replaced in place, so the environment is invalid
+    // until all of them are started.
+    m_isValid = false;
+    m_seed = seed;
+    std::fill(m_numEpisodes.begin(), m_numEpisodes.end(), 0);
+    std::fill(back.rewards.begin(), back.rewards.end(), 0.0f);
+    std::fill(back.dones.begin(), back.dones.end(), 0);
+
+    ForEachEnv([&](std::size_t envIdx) {
+        ResetEnv(envIdx);
+        WriteOutputs(envIdx, back);
+    });
+
+    m_isValid = true;
+    m_front ^= 1;
+}
+
+void VectorEnv::Step(const std::vector<Action>& actions)
+{
+    std::lock_guard<std::mutex> lock(m_stepMutex);
+    CheckValid();
+
+    if (actions.size() != m_games.size())
+    {
+        throw std::invalid_argument("The number of actions must be " +
+                                    std::to_string(m_games.size()));
+    }
+
+    // NOTE: Actions are checked on the calling thread so that an illegal
+    // action throws before any game is changed. An action is legal if its
+    // index is legal in the mask and the index decodes to the same action.
+    for (std::size_t envIdx = 0; envIdx < m_games.size(); ++envIdx)
+    {
+        std::size_t actionIdx = ActionEncoder::NUM_ACTIONS;
+        try
+        {
+            actionIdx = ActionEncoder::Encode(actions[envIdx]);
+        }
+        catch (const std::invalid_argument&)
+        {
+            // Do nothing
+        }
+
+        if (!IsLegal(envIdx, actionIdx) ||
+            ActionEncoder::Decode(actionIdx) != actions[envIdx])
+        {
+            throw std::invalid_argument("Illegal action of environment " +
+                                        std::to_string(envIdx));
+        }
+    }
+
+    Buffers& back = m_buffers[m_front ^ 1];
+    m_isValid = false;
+    ForEachEnv(
+        [&](std::size_t envIdx) { StepEnv(envIdx, actions[envIdx], back); });
+
+    m_isValid = true;
+    m_front ^= 1;
+}
+
+void VectorEnv::Step(const std::vector<std::size_t>& actionIndices)
+{
+    std::lock_guard<std::mutex> lock(m_stepMutex);
+    CheckValid();
+
+    if (actionIndices.size() != m_games.size())
+    {
+        throw std::invalid_argument("The number of actions must be " +
+                                    std::to_string(m_games.size()));
+    }
+
+    for (std::size_t envIdx = 0; envIdx < m_games.size(); ++envIdx)
+    {
+        if (!IsLegal(envIdx, actionIndices[envIdx]))
+        {
+            throw std::invalid_argument("Illegal action of environment " +
+                                        std::to_string(envIdx));
+        }
+    }
+
+    Buffers& back = m_buffers[m_front ^ 1];
+    m_isValid = false;
+    ForEachEnv([&](std::size_t envIdx) {
+        StepEnv(envIdx, ActionEncoder::Decode(actionIndices[envIdx]), back);
+    });
+
+    m_isValid = true;
+    m_front ^= 1;
+}
+
+std::size_t VectorEnv::GetNumEnvs() const
+{
+    return m_games.size();
+}
+
+Game& VectorEnv::GetGame(std::size_t envIdx)
+{
+    return *m_games.at(envIdx);
+}
+
+std::vector<Action> VectorEnv::GetLegalActions(std::size_t envIdx) const
+{
+    if (envIdx >= m_games.size())
+    {
+        throw std::out_of_range("The index of environment is out of range");
+    }
+
+    // NOTE: An index is legal in the mask if and only if its action is in the
+    // legal actions of the game, so the list is decoded from the mask instead
+    // of being built in each step. END_TURN has the last index, so it stays
+    // the last action.
+    const std::uint8_t* mask =
+        &m_buffers[m_front].actionMasks[envIdx * ActionEncoder::NUM_ACTIONS];
+    std::vector<Action> legalActions;
+
+    for (std::size_t actionIdx = 0; actionIdx < ActionEncoder::NUM_ACTIONS;
+         ++actionIdx)
+    {
+        if (mask[actionIdx])
+        {
+            legalActions.emplace_back(ActionEncoder::Decode(actionIdx));
+        }
+    }
+
+    return legalActions;
+}
+
+std::size_t VectorEnv::GetBufferIndex() const
+{
+    return m_front;
+}
+
+const std::vector<float>& VectorEnv::GetObservations() const
+{
+    return m_buffers[m_front].observations;
+}
+
+const std::vector<std::uint8_t>& VectorEnv::GetActionMasks() const
+{
+    return m_buffers[m_front].actionMasks;
+}
+
+const std::vector<std::int32_t>& VectorEnv::GetCurrentPlayers() const
+{
+    return m_buffers[m_front].currentPlayers;
+}
+
+const std::vector<std::int32_t>& VectorEnv::GetTurns() const
+{
+    return m_buffers[m_front].turns;
+}
+
+const std::vector<float>& VectorEnv::GetRewards() const
+{
+    return m_buffers[m_front].rewards;
+}
+
+const std::vector<std::uint8_t>& VectorEnv::GetDones() const
+{
+    return m_buffers[m_front].dones;
+}
+
+void VectorEnv::CheckValid() const
+{
+    if (!m_isValid)
+    {
+        throw std::logic_error(
+            "VectorEnv must be reset before the first step and after a "
+            "failed call");
+    }
+}
+
+bool VectorEnv::IsLegal(std::size_t envIdx, std::size_t actionIdx) const
+{
+    return actionIdx < ActionEncoder::NUM_ACTIONS &&
+           m_buffers[m_front]
+               .actionMasks[envIdx * ActionEncoder::NUM_ACTIONS + actionIdx];
+}
+
+void VectorEnv::ResetEnv(std::size_t envIdx)
+{
+    m_numSteps[envIdx] = 0;
+    SeedNextStep(envIdx);
+
+    // NOTE: Game is neither copyable nor movable, so the previous game is
+    // released before the next one is created.
+    m_games[envIdx].reset();
+    m_games[envIdx] = std::make_unique<Game>(m_gameConfig);
+    m_games[envIdx]->Start();
+
+    ++m_numEpisodes[envIdx];
+}
+
+void VectorEnv::SeedNextStep(std::size_t envIdx)
+{
+    const unsigned int episodeSeed =
+        MixSeed(MixSeed(m_seed, envIdx), m_numEpisodes[envIdx]);
+    Random::seed(MixSeed(episodeSeed, m_numSteps[envIdx]++));
+}
+
+void VectorEnv::StepEnv(std::size_t envIdx, const Action& action,
+                        Buffers& buffers)
+{
+    SeedNextStep(envIdx);
+    ApplyAction(*m_games[envIdx], action);
+
+    if (WriteResults(envIdx, buffers))
+    {
+        ResetEnv(envIdx);
+    }
+
+    WriteOutputs(envIdx, buffers);
+}
+
+bool VectorEnv::WriteResults(std::size_t envIdx, Buffers& buffers)
+{
+    Game& game = *m_games[envIdx];
+    float* rewards = &buffers.rewards[envIdx * 2];
+
+    if (game.state == State::COMPLETE)
+    {
+        const auto toReward = [](PlayState playState) {
+            return playState == PlayState::WON    ? 1.0f
+                   : playState == PlayState::LOST ? -1.0f
+                                                  : 0.0f;
+        };
+
+        rewards[0] = toReward(game.GetPlayer1()->playState);
+        rewards[1] = toReward(game.GetPlayer2()->playState);
+        buffers.dones[envIdx] = 1;
+    }
+    else
+    {
+        rewards[0] = rewards[1] = 0.0f;
+        buffers.dones[envIdx] = game.GetTurn() > m_maxTurns ? 1 : 0;
+    }
+
+    return buffers.dones[envIdx] == 1;
+}
+
+void VectorEnv::WriteOutputs(std::size_t envIdx, Buffers& buffers)
+{
+    Game& game = *m_games[envIdx];
+
+    ObservationEncoder::Encode(
+        *game.GetCurrentPlayer(),
+        &buffers.observations[envIdx * ObservationEncoder::NUM_FEATURES]);
+    ActionEncoder::WriteMask(
+        game, &buffers.actionMasks[envIdx * ActionEncoder::NUM_ACTIONS]);
+    buffers.currentPlayers[envIdx] =
+        game.GetCurrentPlayer() == game.GetPlayer1() ? 0 : 1;
+    buffers.turns[envIdx] = game.GetTurn();
+}
+}  // namespace RosettaStone::PlayMode
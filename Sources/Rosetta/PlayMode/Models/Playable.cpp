@@ -4,7 +4,6 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Models/Playable.hpp>
 #include <Rosetta/PlayMode/Models/Player.hpp>
@@ -16,7 +15,7 @@
 
 #include <utility>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode
 {
@@ -279,10 +278,10 @@ bool Playable::IsPlayableByCardReq(int chooseOne) const
     // These cards can be targeting or non-targeting.
     if (card->dbfID == 52812)
     {
-        Card* card1 =
-            Cards::FindCardByDbfID(GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_1));
-        Card* card2 =
-            Cards::FindCardByDbfID(GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2));
+        Card* card1 = game->GetCardDatabase().FindCardByDbfID(
+            GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_1));
+        Card* card2 = game->GetCardDatabase().FindCardByDbfID(
+            GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2));
 
         return IsPlayableByCardReqInternal(card1, card2);
     }
@@ -291,16 +290,18 @@ bool Playable::IsPlayableByCardReq(int chooseOne) const
     {
         if (player->ChooseBoth())
         {
-            Card* card1 = Cards::FindCardByID(card->chooseCardIDs[0]);
-            Card* card2 = Cards::FindCardByID(card->chooseCardIDs[1]);
+            Card* card1 = game->GetCardDatabase().FindCardByID(
+                card->chooseCardIDs[0]);
+            Card* card2 = game->GetCardDatabase().FindCardByID(
+                card->chooseCardIDs[1]);
 
             return IsPlayableByCardReqInternal(card1, card2);
         }
 
         if (!player->ChooseBoth() && chooseOne > 0)
         {
-            Card* chosenCard =
-                Cards::FindCardByID(card->chooseCardIDs[chooseOne - 1]);
+            Card* chosenCard = game->GetCardDatabase().FindCardByID(
+                card->chooseCardIDs[chooseOne - 1]);
 
             return IsPlayableByCardReqInternal(chosenCard);
         }
@@ -315,10 +316,10 @@ std::vector<Character*> Playable::GetValidPlayTargets() const
     // These cards can be targeting or non-targeting.
     if (card->dbfID == 52812)
     {
-        const auto card1 =
-            Cards::FindCardByDbfID(GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_1));
-        const auto card2 =
-            Cards::FindCardByDbfID(GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2));
+        const auto card1 = game->GetCardDatabase().FindCardByDbfID(
+            GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_1));
+        const auto card2 = game->GetCardDatabase().FindCardByDbfID(
+            GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2));
 
         auto targets1 = card1->GetValidPlayTargets(player);
         auto targets2 = card2->GetValidPlayTargets(player);
@@ -341,6 +342,24 @@ std::vector<Character*> Playable::GetValidPlayTargets() const
     return card->GetValidPlayTargets(player);
 }
 
+bool Playable::IsInValidPlayTargets(Character* target) const
+{
+    // NOTE: Card 'Drustvar Horror' (DAL_431t) has two generated spells.
+    // These cards can be targeting or non-targeting.
+    if (card->dbfID == 52812)
+    {
+        const auto card1 = game->GetCardDatabase().FindCardByDbfID(
+            GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_1));
+        const auto card2 = game->GetCardDatabase().FindCardByDbfID(
+            GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2));
+
+        return card1->IsInValidPlayTargets(player, target) ||
+               card2->IsInValidPlayTargets(player, target);
+    }
+
+    return card->IsInValidPlayTargets(player, target);
+}
+
 Character* Playable::GetRandomValidTarget()
 {
     const std::vector<Character*> validTargets = GetValidPlayTargets();
@@ -364,9 +383,9 @@ bool Playable::IsValidPlayTarget(Character* target, int chooseOne) const
         // These cards can be targeting or non-targeting.
         if (card->dbfID == 52812)
         {
-            const auto card1 = Cards::FindCardByDbfID(
+            const auto card1 = game->GetCardDatabase().FindCardByDbfID(
                 GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_1));
-            const auto card2 = Cards::FindCardByDbfID(
+            const auto card2 = game->GetCardDatabase().FindCardByDbfID(
                 GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2));
 
             return IsValidPlayTargetInternal(target, card1, card2);
@@ -376,16 +395,18 @@ bool Playable::IsValidPlayTarget(Character* target, int chooseOne) const
         {
             if (player->ChooseBoth())
             {
-                Card* card1 = Cards::FindCardByID(card->chooseCardIDs[0]);
-                Card* card2 = Cards::FindCardByID(card->chooseCardIDs[1]);
+                Card* card1 = game->GetCardDatabase().FindCardByID(
+                    card->chooseCardIDs[0]);
+                Card* card2 = game->GetCardDatabase().FindCardByID(
+                    card->chooseCardIDs[1]);
 
                 return IsValidPlayTargetInternal(target, card1, card2);
             }
 
             if (!player->ChooseBoth() && chooseOne > 0)
             {
-                Card* chosenCard =
-                    Cards::FindCardByID(card->chooseCardIDs[chooseOne - 1]);
+                Card* chosenCard = game->GetCardDatabase().FindCardByID(
+                    card->chooseCardIDs[chooseOne - 1]);
 
                 return IsValidPlayTargetInternal(target, chosenCard);
             }
@@ -398,10 +419,10 @@ bool Playable::IsValidPlayTarget(Character* target, int chooseOne) const
     // These cards can be targeting or non-targeting.
     if (card->dbfID == 52812)
     {
-        const auto card1 =
-            Cards::FindCardByDbfID(GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_1));
-        const auto card2 =
-            Cards::FindCardByDbfID(GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2));
+        const auto card1 = game->GetCardDatabase().FindCardByDbfID(
+            GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_1));
+        const auto card2 = game->GetCardDatabase().FindCardByDbfID(
+            GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2));
 
         return IsValidPlayTargetInternal(card1, card2);
     }
@@ -410,16 +431,18 @@ bool Playable::IsValidPlayTarget(Character* target, int chooseOne) const
     {
         if (player->ChooseBoth())
         {
-            Card* card1 = Cards::FindCardByID(card->chooseCardIDs[0]);
-            Card* card2 = Cards::FindCardByID(card->chooseCardIDs[1]);
+            Card* card1 = game->GetCardDatabase().FindCardByID(
+                card->chooseCardIDs[0]);
+            Card* card2 = game->GetCardDatabase().FindCardByID(
+                card->chooseCardIDs[1]);
 
             return IsValidPlayTargetInternal(card1, card2);
         }
 
         if (!player->ChooseBoth() && chooseOne > 0)
         {
-            Card* chosenCard =
-                Cards::FindCardByID(card->chooseCardIDs[chooseOne - 1]);
+            Card* chosenCard = game->GetCardDatabase().FindCardByID(
+                card->chooseCardIDs[chooseOne - 1]);
 
             return IsValidPlayTargetInternal(chosenCard);
         }
@@ -577,9 +600,10 @@ void Playable::ActivateTask(PowerType type, Character* target, int chooseOne,
                 return;
             }
 
-            Playable* playable0 =
-                GetFromCard(player, Cards::FindCardByID(card->chooseCardIDs[0]),
-                            std::nullopt, player->GetSetasideZone());
+            Playable* playable0 = GetFromCard(
+                player,
+                game->GetCardDatabase().FindCardByID(card->chooseCardIDs[0]),
+                std::nullopt, player->GetSetasideZone());
 
             // Check card has overload
             if (playable0->HasOverload())
@@ -590,9 +614,10 @@ void Playable::ActivateTask(PowerType type, Character* target, int chooseOne,
 
             playable0->ActivateTask(type, target, chooseOne, this);
 
-            Playable* playable1 =
-                GetFromCard(player, Cards::FindCardByID(card->chooseCardIDs[1]),
-                            std::nullopt, player->GetSetasideZone());
+            Playable* playable1 = GetFromCard(
+                player,
+                game->GetCardDatabase().FindCardByID(card->chooseCardIDs[1]),
+                std::nullopt, player->GetSetasideZone());
 
             // Check card has overload
             if (playable1->HasOverload())
@@ -614,7 +639,8 @@ void Playable::ActivateTask(PowerType type, Character* target, int chooseOne,
             }
 
             Playable* playable = GetFromCard(
-                player, Cards::FindCardByID(card->chooseCardIDs[chooseOne - 1]),
+                player, game->GetCardDatabase().FindCardByID(
+                    card->chooseCardIDs[chooseOne - 1]),
                 std::nullopt, player->GetSetasideZone());
 
             // Check card has overload
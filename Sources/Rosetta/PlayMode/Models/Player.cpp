@@ -5,7 +5,6 @@
 // property of any third parties.
 
 #include <Rosetta/Common/Utils.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Models/HeroPower.hpp>
 #include <Rosetta/PlayMode/Models/Player.hpp>
@@ -84,6 +83,17 @@ HeroPower& Player::GetHeroPower() const
     return *m_hero->heroPower;
 }
 
+void Player::DeleteHeroPower()
+{
+    HeroPower* heroPower = m_hero->heroPower;
+
+    // NOTE: The entry is erased so that the entity list never refers to a
+    // deleted entity.
+    game->entityList.erase(heroPower->GetGameTag(GameTag::ENTITY_ID));
+    delete heroPower;
+    m_hero->heroPower = nullptr;
+}
+
 Weapon& Player::GetWeapon() const
 {
     return *m_hero->weapon;
@@ -435,11 +445,12 @@ void Player::UpgradeGalakrond() const
     // For example, "DRG_600".
     if (cardID.size() == 7)
     {
-        galakrond->card = Cards::FindCardByID(cardID + "t2");
+        galakrond->card = game->GetCardDatabase().FindCardByID(cardID + "t2");
     }
     else if (EndsWith(cardID, "t2"))
     {
-        galakrond->card = Cards::FindCardByID(cardID.substr(0, 7) + "t3");
+        galakrond->card = game->GetCardDatabase().FindCardByID(
+            cardID.substr(0, 7) + "t3");
     }
 }
 
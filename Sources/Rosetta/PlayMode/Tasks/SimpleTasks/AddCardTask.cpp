@@ -4,7 +4,7 @@
 // Copyright (c) 2017-2021 Chris Ohk
 
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/AddCardTask.hpp>
 #include <Rosetta/PlayMode/Zones/DeckZone.hpp>
 
@@ -20,13 +20,15 @@ AddCardTask::AddCardTask(EntityType entityType, std::string cardID, int amount)
 
 TaskStatus AddCardTask::Impl(Player* player)
 {
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
     switch (m_entityType)
     {
         case EntityType::HAND:
         {
             for (int i = 0; i < m_amount; ++i)
             {
-                Card* card = Cards::FindCardByID(m_cardID);
+                Card* card = cardDatabase.FindCardByID(m_cardID);
                 Generic::AddCardToHand(player,
                                        Entity::GetFromCard(player, card));
             }
@@ -36,7 +38,7 @@ TaskStatus AddCardTask::Impl(Player* player)
         {
             for (int i = 0; i < m_amount; ++i)
             {
-                Card* card = Cards::FindCardByID(m_cardID);
+                Card* card = cardDatabase.FindCardByID(m_cardID);
                 Generic::AddCardToHand(
                     player->opponent,
                     Entity::GetFromCard(player->opponent, card));
@@ -48,7 +50,7 @@ TaskStatus AddCardTask::Impl(Player* player)
             for (int i = 0; i < m_amount && !player->GetDeckZone()->IsFull();
                  ++i)
             {
-                Card* card = Cards::FindCardByID(m_cardID);
+                Card* card = cardDatabase.FindCardByID(m_cardID);
                 Generic::ShuffleIntoDeck(player, m_source,
                                          Entity::GetFromCard(player, card));
             }
@@ -60,7 +62,7 @@ TaskStatus AddCardTask::Impl(Player* player)
                  i < m_amount && !player->opponent->GetDeckZone()->IsFull();
                  ++i)
             {
-                Card* card = Cards::FindCardByID(m_cardID);
+                Card* card = cardDatabase.FindCardByID(m_cardID);
                 Generic::ShuffleIntoDeck(
                     player->opponent, m_source,
                     Entity::GetFromCard(player->opponent, card));
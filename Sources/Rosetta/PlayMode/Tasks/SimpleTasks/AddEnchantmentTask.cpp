@@ -46,17 +46,18 @@ TaskStatus AddEnchantmentTask::Impl(Player* player)
     }
 
     const auto source = dynamic_cast<Playable*>(m_source);
+    Card* enchantmentCard = player->game->FindCard(m_enchantmentCard);
 
     if (m_entityType == EntityType::PLAYER)
     {
-        Generic::AddEnchantment(m_enchantmentCard, source, player, num1, num2,
+        Generic::AddEnchantment(enchantmentCard, source, player, num1, num2,
                                 entityID);
         return TaskStatus::COMPLETE;
     }
 
     if (m_entityType == EntityType::ENEMY_PLAYER)
     {
-        Generic::AddEnchantment(m_enchantmentCard, source, player->opponent,
+        Generic::AddEnchantment(enchantmentCard, source, player->opponent,
                                 num1, num2, entityID);
         return TaskStatus::COMPLETE;
     }
@@ -71,7 +72,7 @@ TaskStatus AddEnchantmentTask::Impl(Player* player)
             continue;
         }
 
-        Generic::AddEnchantment(m_enchantmentCard, source, playable, num1, num2,
+        Generic::AddEnchantment(enchantmentCard, source, playable, num1, num2,
                                 entityID);
     }
 
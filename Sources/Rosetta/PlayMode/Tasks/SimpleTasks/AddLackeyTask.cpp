@@ -4,14 +4,13 @@
 // Copyright (c) 2017-2021 Chris Ohk
 
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/AddLackeyTask.hpp>
 #include <Rosetta/PlayMode/Zones/HandZone.hpp>
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
@@ -22,7 +21,9 @@ AddLackeyTask::AddLackeyTask(int amount) : m_amount(amount)
 
 TaskStatus AddLackeyTask::Impl(Player* player)
 {
-    auto lackeys = Cards::GetLackeys();
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
+    auto lackeys = cardDatabase.GetLackeys();
 
     std::vector<Playable*> cards;
 
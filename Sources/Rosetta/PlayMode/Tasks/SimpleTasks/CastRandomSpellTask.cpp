@@ -5,7 +5,6 @@
 
 #include <Rosetta/PlayMode/Actions/CastSpell.hpp>
 #include <Rosetta/PlayMode/Actions/Choose.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Models/Spell.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/CastRandomSpellTask.hpp>
@@ -14,19 +13,21 @@
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
 TaskStatus CastRandomSpellTask::Impl(Player* player)
 {
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
     player->SetGameTag(GameTag::CAST_RANDOM_SPELLS, 1);
 
     std::vector<Card*> result;
 
     const auto cards = m_source->game->GetFormatType() == FormatType::STANDARD
-                           ? Cards::GetAllStandardCards()
-                           : Cards::GetAllWildCards();
+                           ? cardDatabase.GetAllStandardCards()
+                           : cardDatabase.GetAllWildCards();
 
     for (const auto& card : cards)
     {
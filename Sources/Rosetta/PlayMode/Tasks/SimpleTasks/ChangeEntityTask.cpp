@@ -5,13 +5,14 @@
 
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
 #include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/ChangeEntityTask.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/IncludeTask.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/RandomCardTask.hpp>
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
@@ -90,7 +91,7 @@ TaskStatus ChangeEntityTask::Impl(Player* player)
     }
     else
     {
-        card = m_card;
+        card = player->game->FindCard(m_card);
     }
 
     for (auto& playable : playables)
@@ -16,9 +16,9 @@ ChangeHeroPowerTask::ChangeHeroPowerTask(const std::string& cardID)
 
 TaskStatus ChangeHeroPowerTask::Impl(Player* player)
 {
-    delete player->GetHero()->heroPower;
-    player->GetHero()->heroPower =
-        dynamic_cast<HeroPower*>(Entity::GetFromCard(player, m_card));
+    player->DeleteHeroPower();
+    player->GetHero()->heroPower = dynamic_cast<HeroPower*>(
+        Entity::GetFromCard(player, player->game->FindCard(m_card)));
 
     return TaskStatus::COMPLETE;
 }
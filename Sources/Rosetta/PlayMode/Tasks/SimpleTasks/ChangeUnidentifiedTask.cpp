@@ -4,12 +4,12 @@
 // Copyright (c) 2017-2021 Chris Ohk
 
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/ChangeUnidentifiedTask.hpp>
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
@@ -18,8 +18,10 @@ TaskStatus ChangeUnidentifiedTask::Impl(Player* player)
     const auto idx =
         Random::get<std::size_t>(0, m_source->card->entourages.size() - 1);
 
-    Generic::ChangeEntity(player, dynamic_cast<Playable*>(m_source),
-                          Cards::FindCardByID(m_source->card->entourages[idx]),
+    Card* card = player->game->GetCardDatabase().FindCardByID(
+        m_source->card->entourages[idx]);
+
+    Generic::ChangeEntity(player, dynamic_cast<Playable*>(m_source), card,
                           false);
 
     return TaskStatus::COMPLETE;
@@ -17,7 +17,7 @@
 
 #include <utility>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
@@ -164,7 +164,14 @@ TaskStatus DiscoverTask::Impl(Player* player)
 
     if (!m_cards.empty())
     {
-        result = GetChoices(m_source, m_cards, std::vector<int>{},
+        std::vector<Card*> cards;
+        cards.reserve(m_cards.size());
+        for (Card* card : m_cards)
+        {
+            cards.emplace_back(player->game->FindCard(card));
+        }
+
+        result = GetChoices(m_source, cards, std::vector<int>{},
                             m_numberOfChoices, m_doShuffle);
     }
     else if (m_discoverType != DiscoverType::INVALID)
@@ -234,8 +241,10 @@ auto DiscoverTask::Discover(const Game* game, Player* player,
                             ChoiceAction& choiceAction) const
     -> std::tuple<std::vector<Card*>, std::vector<int>>
 {
+    const CardDatabase& cardDatabase = game->GetCardDatabase();
+
     std::vector<Card*> allCards =
-        Cards::GetDiscoverCards(player->baseClass, game->GetFormatType());
+        cardDatabase.GetDiscoverCards(player->baseClass, game->GetFormatType());
 
     std::vector<Card*> cardsForGeneration;
     std::vector<int> cardsForOtherEffect;
@@ -260,16 +269,16 @@ auto DiscoverTask::Discover(const Game* game, Player* player,
         {
             choiceAction = ChoiceAction::CHANGE_HERO_POWER;
             cardsForGeneration = {
-                Cards::FindCardByID("HERO_01bp"),
-                Cards::FindCardByID("HERO_02bp"),
-                Cards::FindCardByID("HERO_03bp"),
-                Cards::FindCardByID("HERO_04bp"),
-                Cards::FindCardByID("HERO_05bp"),
-                Cards::FindCardByID("HERO_06bp"),
-                Cards::FindCardByID("HERO_07bp"),
-                Cards::FindCardByID("HERO_08bp"),
-                Cards::FindCardByID("HERO_09bp"),
-                Cards::FindCardByID("HERO_10bp"),
+                cardDatabase.FindCardByID("HERO_01bp"),
+                cardDatabase.FindCardByID("HERO_02bp"),
+                cardDatabase.FindCardByID("HERO_03bp"),
+                cardDatabase.FindCardByID("HERO_04bp"),
+                cardDatabase.FindCardByID("HERO_05bp"),
+                cardDatabase.FindCardByID("HERO_06bp"),
+                cardDatabase.FindCardByID("HERO_07bp"),
+                cardDatabase.FindCardByID("HERO_08bp"),
+                cardDatabase.FindCardByID("HERO_09bp"),
+                cardDatabase.FindCardByID("HERO_10bp"),
             };
             break;
         }
@@ -299,17 +308,21 @@ auto DiscoverTask::Discover(const Game* game, Player* player,
         }
         case DiscoverType::BASIC_TOTEM:
             choiceAction = ChoiceAction::SUMMON;
-            cardsForGeneration = { Cards::FindCardByID("AT_132_SHAMANa"),
-                                   Cards::FindCardByID("AT_132_SHAMANb"),
-                                   Cards::FindCardByID("AT_132_SHAMANc"),
-                                   Cards::FindCardByID("AT_132_SHAMANe") };
+            cardsForGeneration = {
+                cardDatabase.FindCardByID("AT_132_SHAMANa"),
+                cardDatabase.FindCardByID("AT_132_SHAMANb"),
+                cardDatabase.FindCardByID("AT_132_SHAMANc"),
+                cardDatabase.FindCardByID("AT_132_SHAMANe"),
+            };
             break;
         case DiscoverType::BASIC_TOTEM_CLASSIC:
             choiceAction = ChoiceAction::SUMMON;
-            cardsForGeneration = { Cards::FindCardByID("AT_132_SHAMANa"),
-                                   Cards::FindCardByID("AT_132_SHAMANb"),
-                                   Cards::FindCardByID("AT_132_SHAMANc"),
-                                   Cards::FindCardByID("AT_132_SHAMANd") };
+            cardsForGeneration = {
+                cardDatabase.FindCardByID("AT_132_SHAMANa"),
+                cardDatabase.FindCardByID("AT_132_SHAMANb"),
+                cardDatabase.FindCardByID("AT_132_SHAMANc"),
+                cardDatabase.FindCardByID("AT_132_SHAMANd"),
+            };
             break;
         case DiscoverType::CHOOSE_ONE:
             choiceAction = ChoiceAction::HAND;
@@ -532,7 +545,7 @@ auto DiscoverTask::Discover(const Game* game, Player* player,
             break;
         case DiscoverType::LACKEY:
             choiceAction = ChoiceAction::HAND;
-            for (const auto& card : Cards::GetAllCards())
+            for (const auto& card : cardDatabase.GetAllCards())
             {
                 if (card->IsLackey())
                 {
@@ -542,10 +555,10 @@ auto DiscoverTask::Discover(const Game* game, Player* player,
             break;
         case DiscoverType::HEISTBARON_TOGWAGGLE:
             choiceAction = ChoiceAction::HAND;
-            cardsForGeneration = { Cards::FindCardByID("LOOT_998h"),
-                                   Cards::FindCardByID("LOOT_998j"),
-                                   Cards::FindCardByID("LOOT_998l"),
-                                   Cards::FindCardByID("LOOT_998k") };
+            cardsForGeneration = { cardDatabase.FindCardByID("LOOT_998h"),
+                                   cardDatabase.FindCardByID("LOOT_998j"),
+                                   cardDatabase.FindCardByID("LOOT_998l"),
+                                   cardDatabase.FindCardByID("LOOT_998k") };
             break;
         case DiscoverType::MADAME_LAZUL:
             choiceAction = ChoiceAction::MADAME_LAZUL;
@@ -591,24 +604,24 @@ auto DiscoverTask::Discover(const Game* game, Player* player,
         }
         case DiscoverType::SIAMAT:
             choiceAction = ChoiceAction::SIAMAT;
-            cardsForGeneration = { Cards::FindCardByID("ULD_178a2"),
-                                   Cards::FindCardByID("ULD_178a"),
-                                   Cards::FindCardByID("ULD_178a3"),
-                                   Cards::FindCardByID("ULD_178a4") };
+            cardsForGeneration = { cardDatabase.FindCardByID("ULD_178a2"),
+                                   cardDatabase.FindCardByID("ULD_178a"),
+                                   cardDatabase.FindCardByID("ULD_178a3"),
+                                   cardDatabase.FindCardByID("ULD_178a4") };
             break;
         case DiscoverType::SIR_FINLEY_OF_THE_SANDS:
             choiceAction = ChoiceAction::CHANGE_HERO_POWER;
             cardsForGeneration = {
-                Cards::FindCardByID("HERO_01bp2"),
-                Cards::FindCardByID("HERO_02bp2"),
-                Cards::FindCardByID("HERO_03bp2"),
-                Cards::FindCardByID("HERO_04bp2"),
-                Cards::FindCardByID("HERO_05bp2"),
-                Cards::FindCardByID("HERO_06bp2"),
-                Cards::FindCardByID("HERO_07bp2"),
-                Cards::FindCardByID("HERO_08bp2"),
-                Cards::FindCardByID("HERO_09bp2"),
-                Cards::FindCardByID("HERO_10bp2"),
+                cardDatabase.FindCardByID("HERO_01bp2"),
+                cardDatabase.FindCardByID("HERO_02bp2"),
+                cardDatabase.FindCardByID("HERO_03bp2"),
+                cardDatabase.FindCardByID("HERO_04bp2"),
+                cardDatabase.FindCardByID("HERO_05bp2"),
+                cardDatabase.FindCardByID("HERO_06bp2"),
+                cardDatabase.FindCardByID("HERO_07bp2"),
+                cardDatabase.FindCardByID("HERO_08bp2"),
+                cardDatabase.FindCardByID("HERO_09bp2"),
+                cardDatabase.FindCardByID("HERO_10bp2"),
             };
             break;
         case DiscoverType::VULPERA_SCOUNDREL:
@@ -623,7 +636,8 @@ auto DiscoverTask::Discover(const Game* game, Player* player,
             Random::shuffle(cardsForGeneration.begin(),
                             cardsForGeneration.end());
             cardsForGeneration.resize(3);
-            cardsForGeneration.emplace_back(Cards::FindCardByID("ULD_209t"));
+            cardsForGeneration.emplace_back(
+                cardDatabase.FindCardByID("ULD_209t"));
             break;
         case DiscoverType::BODY_WRAPPER:
             choiceAction = ChoiceAction::DECK;
@@ -661,9 +675,9 @@ auto DiscoverTask::Discover(const Game* game, Player* player,
         case DiscoverType::ARCH_THIEF_RAFAAM:
             choiceAction = ChoiceAction::HAND;
             cardsForGeneration = {
-                Cards::FindCardByID("LOEA16_3"),
-                Cards::FindCardByID("LOEA16_5"),
-                Cards::FindCardByID("LOEA16_4"),
+                cardDatabase.FindCardByID("LOEA16_3"),
+                cardDatabase.FindCardByID("LOEA16_5"),
+                cardDatabase.FindCardByID("LOEA16_4"),
             };
             break;
     }
@@ -698,6 +712,8 @@ std::vector<Card*> DiscoverTask::Discover(const Game* game,
                                           const Player* player,
                                           DiscoverCriteria criteria) const
 {
+    const CardDatabase& cardDatabase = game->GetCardDatabase();
+
     const FormatType format = game->GetFormatType();
     std::vector<Card*> cards;
 
@@ -706,8 +722,8 @@ std::vector<Card*> DiscoverTask::Discover(const Game* game,
         criteria.cardClass == CardClass::ANOTHER_CLASS)
     {
         auto allCards = (format == FormatType::STANDARD)
-                            ? Cards::GetAllStandardCards()
-                            : Cards::GetAllWildCards();
+                            ? cardDatabase.GetAllStandardCards()
+                            : cardDatabase.GetAllWildCards();
 
         for (auto& card : allCards)
         {
@@ -743,8 +759,8 @@ std::vector<Card*> DiscoverTask::Discover(const Game* game,
     else
     {
         auto allCards = (format == FormatType::STANDARD)
-                            ? Cards::GetStandardCards(criteria.cardClass)
-                            : Cards::GetWildCards(criteria.cardClass);
+                            ? cardDatabase.GetStandardCards(criteria.cardClass)
+                            : cardDatabase.GetWildCards(criteria.cardClass);
 
         for (auto& card : allCards)
         {
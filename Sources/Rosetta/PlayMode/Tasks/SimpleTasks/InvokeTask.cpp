@@ -3,7 +3,6 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2017-2021 Chris Ohk
 
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Models/Player.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/InvokeTask.hpp>
@@ -26,7 +25,7 @@ TaskStatus InvokeTask::Impl(Player* player)
     }
 
     // Activate hero power of Galakrond
-    const auto heroPower = Cards::FindCardByDbfID(
+    const auto heroPower = player->game->GetCardDatabase().FindCardByDbfID(
         player->galakrond->GetGameTag(GameTag::HERO_POWER));
     const auto heroPowerTasks = heroPower->power.GetPowerTask();
 
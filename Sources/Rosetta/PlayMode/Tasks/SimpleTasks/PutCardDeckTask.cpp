@@ -4,7 +4,7 @@
 // Copyright (c) 2017-2021 Chris Ohk
 
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/PutCardDeckTask.hpp>
 #include <Rosetta/PlayMode/Zones/DeckZone.hpp>
 
@@ -21,6 +21,8 @@ PutCardDeckTask::PutCardDeckTask(std::string cardID, DeckPosition position,
 
 TaskStatus PutCardDeckTask::Impl(Player* player)
 {
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
     for (int i = 0; i < m_amount; ++i)
     {
         if (m_player->GetDeckZone()->IsFull())
@@ -28,7 +30,7 @@ TaskStatus PutCardDeckTask::Impl(Player* player)
             break;
         }
 
-        Card* card = Cards::FindCardByID(m_cardID);
+        Card* card = cardDatabase.FindCardByID(m_cardID);
         Playable* playable = Entity::GetFromCard(player, card);
 
         switch (m_position)
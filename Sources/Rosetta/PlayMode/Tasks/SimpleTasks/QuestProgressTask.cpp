@@ -100,13 +100,14 @@ TaskStatus QuestProgressTask::Impl(Player* player)
     {
         if (!m_questRewardCard->id.empty())
         {
-            Playable* reward = Entity::GetFromCard(player, m_questRewardCard);
+            Playable* reward = Entity::GetFromCard(
+                player, player->game->FindCard(m_questRewardCard));
 
             // Reward card is hero power or minion
             if (const auto heroPower = dynamic_cast<HeroPower*>(reward);
                 heroPower)
             {
-                delete player->GetHero()->heroPower;
+                player->DeleteHeroPower();
                 player->GetHero()->heroPower = heroPower;
 
                 // Process aura
@@ -159,8 +160,8 @@ TaskStatus QuestProgressTask::Impl(Player* player)
             // Set next quest for keyword 'Questline'
             if (!m_nextQuestCard->id.empty())
             {
-                Playable* nextQuest =
-                    Entity::GetFromCard(player, m_nextQuestCard);
+                Playable* nextQuest = Entity::GetFromCard(
+                    player, player->game->FindCard(m_nextQuestCard));
 
                 // Process trigger
                 if (nextQuest->card->power.GetTrigger())
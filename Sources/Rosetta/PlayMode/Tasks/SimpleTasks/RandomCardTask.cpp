@@ -3,7 +3,6 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2017-2021 Chris Ohk
 
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/RandomCardTask.hpp>
 
@@ -11,7 +10,7 @@
 
 #include <utility>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
@@ -91,12 +90,14 @@ std::vector<Card*> RandomCardTask::GetCardList(
 const std::vector<Card*>& RandomCardTask::GetCardList(const Entity* source,
                                                       CardClass cardClass)
 {
+    const CardDatabase& cardDatabase = source->game->GetCardDatabase();
+
     if (cardClass == CardClass::INVALID ||
         cardClass == CardClass::ANOTHER_CLASS)
     {
         return source->game->GetFormatType() == FormatType::STANDARD
-                   ? Cards::GetAllStandardCards()
-                   : Cards::GetAllWildCards();
+                   ? cardDatabase.GetAllStandardCards()
+                   : cardDatabase.GetAllWildCards();
     }
     else if (cardClass == CardClass::PLAYER_CLASS)
     {
@@ -104,8 +105,8 @@ const std::vector<Card*>& RandomCardTask::GetCardList(const Entity* source,
             source->player->GetHero()->card->GetCardClass();
 
         return source->game->GetFormatType() == FormatType::STANDARD
-                   ? Cards::GetStandardCards(playerClass)
-                   : Cards::GetWildCards(playerClass);
+                   ? cardDatabase.GetStandardCards(playerClass)
+                   : cardDatabase.GetWildCards(playerClass);
     }
     else if (cardClass == CardClass::OPPONENT_CLASS)
     {
@@ -113,14 +114,14 @@ const std::vector<Card*>& RandomCardTask::GetCardList(const Entity* source,
             source->player->opponent->GetHero()->card->GetCardClass();
 
         return source->game->GetFormatType() == FormatType::STANDARD
-                   ? Cards::GetStandardCards(opponentClass)
-                   : Cards::GetWildCards(opponentClass);
+                   ? cardDatabase.GetStandardCards(opponentClass)
+                   : cardDatabase.GetWildCards(opponentClass);
     }
     else
     {
         return source->game->GetFormatType() == FormatType::STANDARD
-                   ? Cards::GetStandardCards(cardClass)
-                   : Cards::GetWildCards(cardClass);
+                   ? cardDatabase.GetStandardCards(cardClass)
+                   : cardDatabase.GetWildCards(cardClass);
     }
 }
 
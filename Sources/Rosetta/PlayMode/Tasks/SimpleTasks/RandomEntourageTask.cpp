@@ -3,13 +3,12 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2017-2021 Chris Ohk
 
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/RandomEntourageTask.hpp>
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
@@ -21,6 +20,8 @@ RandomEntourageTask::RandomEntourageTask(int count, bool isOpponent)
 
 TaskStatus RandomEntourageTask::Impl(Player* player)
 {
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
     std::vector<Playable*> list;
 
     if (!m_source || m_source->card->entourages.empty())
@@ -38,7 +39,7 @@ TaskStatus RandomEntourageTask::Impl(Player* player)
         const auto idx =
             Random::get<std::size_t>(0, m_source->card->entourages.size() - 1);
         const auto entourageCard =
-            Cards::FindCardByID(m_source->card->entourages[idx]);
+            cardDatabase.FindCardByID(m_source->card->entourages[idx]);
 
         Playable* entouragePlayable =
             Entity::GetFromCard(player, entourageCard);
@@ -3,13 +3,12 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2017-2021 Chris Ohk
 
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/RandomMinionNumberTask.hpp>
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
@@ -21,9 +20,11 @@ RandomMinionNumberTask::RandomMinionNumberTask(GameTag tag, bool toOpponent)
 
 TaskStatus RandomMinionNumberTask::Impl(Player* player)
 {
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
     const auto cards = m_source->game->GetFormatType() == FormatType::STANDARD
-                           ? Cards::GetAllStandardCards()
-                           : Cards::GetAllWildCards();
+                           ? cardDatabase.GetAllStandardCards()
+                           : cardDatabase.GetAllWildCards();
 
     std::vector<Card*> cardsList;
     const int num = player->game->taskStack.num[0];
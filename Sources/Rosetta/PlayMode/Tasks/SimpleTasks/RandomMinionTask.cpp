@@ -3,7 +3,6 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2017-2021 Chris Ohk
 
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/RandomMinionTask.hpp>
 
@@ -11,7 +10,7 @@
 
 #include <utility>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
@@ -27,9 +26,11 @@ RandomMinionTask::RandomMinionTask(std::vector<TagValue> tagValues, int amount,
 
 TaskStatus RandomMinionTask::Impl(Player* player)
 {
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
     const auto cards = m_source->game->GetFormatType() == FormatType::STANDARD
-                           ? Cards::GetAllStandardCards()
-                           : Cards::GetAllWildCards();
+                           ? cardDatabase.GetAllStandardCards()
+                           : cardDatabase.GetAllWildCards();
 
     std::vector<Card*> cardsList;
 
@@ -3,13 +3,12 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2017-2021 Chris Ohk
 
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/RandomSpellTask.hpp>
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
@@ -33,26 +32,28 @@ RandomSpellTask::RandomSpellTask(CardClass cardClass, GameTag tag, int value,
 
 TaskStatus RandomSpellTask::Impl(Player* player)
 {
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
     std::vector<Card*> cards, result;
 
     if (m_cardClass == CardClass::INVALID)
     {
         cards = m_source->game->GetFormatType() == FormatType::STANDARD
-                    ? Cards::GetAllStandardCards()
-                    : Cards::GetAllWildCards();
+                    ? cardDatabase.GetAllStandardCards()
+                    : cardDatabase.GetAllWildCards();
     }
     else if (m_cardClass == CardClass::PLAYER_CLASS)
     {
         const auto playerClass = player->GetHero()->card->GetCardClass();
         cards = m_source->game->GetFormatType() == FormatType::STANDARD
-                    ? Cards::GetStandardCards(playerClass)
-                    : Cards::GetWildCards(playerClass);
+                    ? cardDatabase.GetStandardCards(playerClass)
+                    : cardDatabase.GetWildCards(playerClass);
     }
     else
     {
         cards = m_source->game->GetFormatType() == FormatType::STANDARD
-                    ? Cards::GetStandardCards(m_cardClass)
-                    : Cards::GetWildCards(m_cardClass);
+                    ? cardDatabase.GetStandardCards(m_cardClass)
+                    : cardDatabase.GetWildCards(m_cardClass);
     }
 
     for (const auto& card : cards)
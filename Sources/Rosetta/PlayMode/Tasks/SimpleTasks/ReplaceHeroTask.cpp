@@ -4,6 +4,7 @@
 // Copyright (c) 2017-2021 Chris Ohk
 
 #include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/ReplaceHeroTask.hpp>
 #include <Rosetta/PlayMode/Zones/SetasideZone.hpp>
 
@@ -51,12 +52,14 @@ TaskStatus ReplaceHeroTask::Impl(Player* player)
             playable->zone->Remove(playable));
     }
 
-    player->AddHeroAndPower(m_heroCard, m_heroPowerCard);
+    const Game* game = player->game;
+    player->AddHeroAndPower(game->FindCard(m_heroCard),
+                            game->FindCard(m_heroPowerCard));
 
     if (m_weaponCard)
     {
-        const auto weapon =
-            dynamic_cast<Weapon*>(Entity::GetFromCard(player, m_weaponCard));
+        const auto weapon = dynamic_cast<Weapon*>(
+            Entity::GetFromCard(player, game->FindCard(m_weaponCard)));
 
         player->GetHero()->AddWeapon(*weapon);
     }
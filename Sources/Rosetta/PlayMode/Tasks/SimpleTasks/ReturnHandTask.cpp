@@ -31,6 +31,9 @@ TaskStatus ReturnHandTask::Impl(Player* player)
             playable->zone->Remove(playable);
             playable->Reset();
 
+            // NOTE: The card was seen in play, so the opponent knows it.
+            playable->SetGameTag(GameTag::REVEALED, 1);
+
             Generic::AddCardToHand(playable->player, playable);
         }
     }
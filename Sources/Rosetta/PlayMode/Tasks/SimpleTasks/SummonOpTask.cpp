@@ -50,8 +50,8 @@ TaskStatus SummonOpTask::Impl(Player* player)
         }
         else
         {
-            summonEntity = dynamic_cast<Minion*>(
-                Entity::GetFromCard(player->opponent, m_card.value()));
+            summonEntity = dynamic_cast<Minion*>(Entity::GetFromCard(
+                player->opponent, player->game->FindCard(m_card.value())));
         }
 
         const int pos =
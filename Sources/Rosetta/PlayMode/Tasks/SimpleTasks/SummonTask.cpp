@@ -196,8 +196,8 @@ TaskStatus SummonTask::Impl(Player* player)
 
         if (m_card.has_value())
         {
-            summonEntity = dynamic_cast<Minion*>(
-                Entity::GetFromCard(player, m_card.value()));
+            summonEntity = dynamic_cast<Minion*>(Entity::GetFromCard(
+                player, player->game->FindCard(m_card.value())));
 
             if (m_addToStack)
             {
@@ -4,14 +4,13 @@
 // Copyright (c) 2017-2021 Chris Ohk
 
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/IncludeTask.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/TransformMinionTask.hpp>
 
 #include <effolkronium/random.hpp>
 
-using Random = effolkronium::random_static;
+using Random = effolkronium::random_thread_local;
 
 namespace RosettaStone::PlayMode::SimpleTasks
 {
@@ -36,6 +35,8 @@ TransformMinionTask::TransformMinionTask(EntityType entityType, int costChange)
 
 TaskStatus TransformMinionTask::Impl(Player* player)
 {
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
     const auto playables =
         IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
     const FormatType format = player->game->GetFormatType();
@@ -43,7 +44,7 @@ TaskStatus TransformMinionTask::Impl(Player* player)
 
     if (format == FormatType::STANDARD)
     {
-        for (auto& card : Cards::GetAllStandardCards())
+        for (auto& card : cardDatabase.GetAllStandardCards())
         {
             if (card->GetCardType() == CardType::MINION)
             {
@@ -53,7 +54,7 @@ TaskStatus TransformMinionTask::Impl(Player* player)
     }
     else
     {
-        for (auto& card : Cards::GetAllWildCards())
+        for (auto& card : cardDatabase.GetAllWildCards())
         {
             if (card->GetCardType() == CardType::MINION)
             {
@@ -4,7 +4,7 @@
 // Copyright (c) 2017-2021 Chris Ohk
 
 #include <Rosetta/PlayMode/Actions/Generic.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/IncludeTask.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/TransformTask.hpp>
 
@@ -20,12 +20,14 @@ TransformTask::TransformTask(EntityType entityType, std::string cardID)
 
 TaskStatus TransformTask::Impl(Player* player)
 {
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
     const auto playables =
         IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
 
     for (const auto& playable : playables)
     {
-        Card* card = Cards::FindCardByID(m_cardID);
+        Card* card = cardDatabase.FindCardByID(m_cardID);
 
         auto* minion = dynamic_cast<Minion*>(playable);
 
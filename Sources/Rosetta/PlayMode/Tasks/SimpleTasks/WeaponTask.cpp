@@ -4,7 +4,7 @@
 // Copyright (c) 2017-2021 Chris Ohk
 
 #include <Rosetta/PlayMode/Actions/PlayCard.hpp>
-#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
 #include <Rosetta/PlayMode/Tasks/SimpleTasks/WeaponTask.hpp>
 
 namespace RosettaStone::PlayMode::SimpleTasks
@@ -17,7 +17,9 @@ WeaponTask::WeaponTask(std::string cardID, bool isOpponent)
 
 TaskStatus WeaponTask::Impl(Player* player)
 {
-    Card* weaponCard = Cards::FindCardByID(m_cardID);
+    const CardDatabase& cardDatabase = player->game->GetCardDatabase();
+
+    Card* weaponCard = cardDatabase.FindCardByID(m_cardID);
     if (weaponCard->id.empty())
     {
         return TaskStatus::STOP;
@@ -14,6 +14,12 @@
 namespace RosettaStone::PlayMode
 {
 Deck DeckCode::Decode(std::string_view deckCode)
+{
+    return Decode(deckCode, Cards::GetDatabase());
+}
+
+Deck DeckCode::Decode(std::string_view deckCode,
+                      const CardDatabase& cardDatabase)
 {
     const std::vector<unsigned char> code = DecodeBase64(deckCode);
     std::size_t pos = 0;
@@ -64,7 +70,7 @@ Deck DeckCode::Decode(std::string_view deckCode)
         throw std::runtime_error("Hero count must be 1");
     }
 
-    const Card* hero = Cards::FindCardByDbfID(ReadVarint());
+    const Card* hero = cardDatabase.FindCardByDbfID(ReadVarint());
     if (hero->GetCardClass() == CardClass::INVALID)
     {
         throw std::runtime_error("Invalid hero");
@@ -77,7 +83,8 @@ Deck DeckCode::Decode(std::string_view deckCode)
     for (int i = 0; i < num; ++i)
     {
         const int cardID = ReadVarint();
-        deckInfo.AddCard(Cards::FindCardByDbfID(cardID)->id, 1);
+        deckInfo.AddCard(cardDatabase.FindCardByDbfID(cardID)->id, 1,
+                         cardDatabase);
     }
 
     // 2-copy cards
@@ -85,7 +92,8 @@ Deck DeckCode::Decode(std::string_view deckCode)
     for (int i = 0; i < num; ++i)
     {
         const int cardID = ReadVarint();
-        deckInfo.AddCard(Cards::FindCardByDbfID(cardID)->id, 2);
+        deckInfo.AddCard(cardDatabase.FindCardByDbfID(cardID)->id, 2,
+                         cardDatabase);
     }
 
     // n-copy cards
@@ -94,7 +102,8 @@ Deck DeckCode::Decode(std::string_view deckCode)
     {
         const int cardID = ReadVarint();
         const int count = ReadVarint();
-        deckInfo.AddCard(Cards::FindCardByDbfID(cardID)->id, count);
+        deckInfo.AddCard(cardDatabase.FindCardByDbfID(cardID)->id, count,
+                         cardDatabase);
     }
 
     return deckInfo;
@@ -0,0 +1,168 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Models/Hero.hpp>
+#include <Rosetta/PlayMode/Models/Minion.hpp>
+#include <Rosetta/PlayMode/Models/Weapon.hpp>
+#include <Rosetta/PlayMode/Views/EntityView.hpp>
+
+namespace RosettaStone::PlayMode
+{
+EntityView::EntityView(const Playable* playable)
+    : m_playable(playable),
+      m_character(dynamic_cast<const Character*>(playable)),
+      m_minion(dynamic_cast<const Minion*>(m_character)),
+      m_hero(dynamic_cast<const Hero*>(m_character)),
+      m_weapon(dynamic_cast<const Weapon*>(playable))
+{
+    // Do nothing
+}
+
+const Card& EntityView::GetCard() const
+{
+    return *m_playable->card;
+}
+
+int EntityView::GetID() const
+{
+    return m_playable->GetGameTag(GameTag::ENTITY_ID);
+}
+
+int EntityView::GetGameTag(GameTag tag) const
+{
+    return m_playable->GetGameTag(tag);
+}
+
+int EntityView::GetZonePosition() const
+{
+    return m_playable->GetZonePosition();
+}
+
+int EntityView::GetCost() const
+{
+    return m_playable->GetCost();
+}
+
+int EntityView::GetAttack() const
+{
+    if (m_character)
+    {
+        return m_character->GetAttack();
+    }
+
+    return m_weapon ? m_weapon->GetAttack() : 0;
+}
+
+int EntityView::GetHealth() const
+{
+    return m_character ? m_character->GetHealth() : 0;
+}
+
+int EntityView::GetBaseHealth() const
+{
+    return m_character ? m_character->GetBaseHealth() : 0;
+}
+
+int EntityView::GetArmor() const
+{
+    return m_hero ? m_hero->GetArmor() : 0;
+}
+
+int EntityView::GetDurability() const
+{
+    return m_weapon ? m_weapon->GetDurability() : 0;
+}
+
+int EntityView::GetSpellPower() const
+{
+    return m_character ? m_character->GetSpellPower() : 0;
+}
+
+bool EntityView::IsExhausted() const
+{
+    return m_playable->IsExhausted();
+}
+
+bool EntityView::CanAttack() const
+{
+    return m_character && m_character->CanAttack();
+}
+
+bool EntityView::IsFrozen() const
+{
+    return m_character && m_character->IsFrozen();
+}
+
+bool EntityView::IsImmune() const
+{
+    if (m_character)
+    {
+        return m_character->IsImmune();
+    }
+
+    return m_weapon && m_weapon->IsImmune();
+}
+
+bool EntityView::IsSilenced() const
+{
+    return m_playable->GetGameTag(GameTag::SILENCED) == 1;
+}
+
+bool EntityView::HasTaunt() const
+{
+    return m_minion && m_minion->HasTaunt();
+}
+
+bool EntityView::HasDivineShield() const
+{
+    return m_minion && m_minion->HasDivineShield();
+}
+
+bool EntityView::HasCharge() const
+{
+    return m_minion && m_minion->HasCharge();
+}
+
+bool EntityView::HasRush() const
+{
+    return m_minion && m_minion->HasRush();
+}
+
+bool EntityView::HasWindfury() const
+{
+    return m_character && m_character->HasWindfury();
+}
+
+bool EntityView::HasStealth() const
+{
+    return m_character && m_character->HasStealth();
+}
+
+bool EntityView::HasPoisonous() const
+{
+    if (m_minion)
+    {
+        return m_minion->HasPoisonous();
+    }
+
+    return m_weapon && m_weapon->HasPoisonous();
+}
+
+bool EntityView::HasLifesteal() const
+{
+    return m_playable->HasLifesteal();
+}
+
+bool EntityView::HasDeathrattle() const
+{
+    return m_playable->HasDeathrattle();
+}
+
+bool EntityView::HasReborn() const
+{
+    return m_minion && m_minion->HasReborn();
+}
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,54 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Views/ObservationView.hpp>
+
+namespace RosettaStone::PlayMode
+{
+ObservationView::ObservationView(const Player& player) : m_player(&player)
+{
+    // Do nothing
+}
+
+int ObservationView::GetTurn() const
+{
+    return m_player->game->GetTurn();
+}
+
+PlayerView ObservationView::GetPlayer() const
+{
+    return PlayerView(m_player, true);
+}
+
+PlayerView ObservationView::GetOpponent() const
+{
+    return PlayerView(m_player->opponent, false);
+}
+
+int ObservationView::GetNumChoices() const
+{
+    return m_player->choice
+               ? static_cast<int>(m_player->choice->choices.size())
+               : 0;
+}
+
+void ObservationView::ForEachChoice(
+    const std::function<void(const EntityView&)>& func) const
+{
+    if (!m_player->choice)
+    {
+        return;
+    }
+
+    const auto& entityList = m_player->game->entityList;
+    for (const int entityID : m_player->choice->choices)
+    {
+        func(EntityView(entityList.at(entityID)));
+    }
+}
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,177 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Models/Hero.hpp>
+#include <Rosetta/PlayMode/Models/HeroPower.hpp>
+#include <Rosetta/PlayMode/Models/Minion.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Models/Spell.hpp>
+#include <Rosetta/PlayMode/Models/Weapon.hpp>
+#include <Rosetta/PlayMode/Views/PlayerView.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+#include <Rosetta/PlayMode/Zones/SecretZone.hpp>
+
+namespace RosettaStone::PlayMode
+{
+PlayerView::PlayerView(const Player* player, bool isObserver)
+    : m_player(player), m_isObserver(isObserver)
+{
+    // Do nothing
+}
+
+PlayerType PlayerView::GetPlayerType() const
+{
+    return m_player->playerType;
+}
+
+CardClass PlayerView::GetClass() const
+{
+    return m_player->baseClass;
+}
+
+bool PlayerView::IsCurrentPlayer() const
+{
+    return m_player->game->GetCurrentPlayer() == m_player;
+}
+
+int PlayerView::GetTotalMana() const
+{
+    return m_player->GetTotalMana();
+}
+
+int PlayerView::GetRemainingMana() const
+{
+    return m_player->GetRemainingMana();
+}
+
+int PlayerView::GetOverloadOwed() const
+{
+    return m_player->GetOverloadOwed();
+}
+
+int PlayerView::GetOverloadLocked() const
+{
+    return m_player->GetOverloadLocked();
+}
+
+EntityView PlayerView::GetHero() const
+{
+    return EntityView(m_player->GetHero());
+}
+
+EntityView PlayerView::GetHeroPower() const
+{
+    return EntityView(&m_player->GetHeroPower());
+}
+
+bool PlayerView::HasWeapon() const
+{
+    return m_player->GetHero()->HasWeapon();
+}
+
+EntityView PlayerView::GetWeapon() const
+{
+    return EntityView(&m_player->GetWeapon());
+}
+
+int PlayerView::GetNumMinions() const
+{
+    return m_player->GetFieldZone()->GetCount();
+}
+
+void PlayerView::ForEachMinion(
+    const std::function<void(const EntityView&)>& func) const
+{
+    m_player->GetFieldZone()->ForEach(
+        [&](const Minion* minion) { func(EntityView(minion)); });
+}
+
+int PlayerView::GetHandCount() const
+{
+    return m_player->GetHandZone()->GetCount();
+}
+
+void PlayerView::ForEachHandCard(
+    const std::function<void(const EntityView* card)>& func) const
+{
+    m_player->GetHandZone()->ForEach([&](const Playable* playable) {
+        if (IsVisible(playable))
+        {
+            const EntityView card(playable);
+            func(&card);
+        }
+        else
+        {
+            func(nullptr);
+        }
+    });
+}
+
+int PlayerView::GetDeckCount() const
+{
+    return m_player->GetDeckZone()->GetCount();
+}
+
+int PlayerView::GetSecretCount() const
+{
+    return m_player->GetSecretZone()->GetCount();
+}
+
+void PlayerView::ForEachSecret(
+    const std::function<void(const EntityView* secret, CardClass)>& func)
+    const
+{
+    m_player->GetSecretZone()->ForEach([&](const Spell* spell) {
+        const CardClass cardClass = spell->card->GetCardClass();
+
+        if (IsVisible(spell))
+        {
+            const EntityView secret(spell);
+            func(&secret, cardClass);
+        }
+        else
+        {
+            func(nullptr, cardClass);
+        }
+    });
+}
+
+void PlayerView::ForEachPlayedCard(
+    const std::function<void(const PlayedCard&)>& func) const
+{
+    const auto& entityList = m_player->game->entityList;
+
+    for (const auto& history : m_player->playHistory)
+    {
+        PlayedCard playedCard;
+        playedCard.card = history.sourceCard;
+        playedCard.target = history.targetCard;
+        playedCard.turn = history.turn;
+        playedCard.chooseOne = history.chooseOne;
+
+        // NOTE: A secret is played face down, so the opponent doesn't know
+        // the card until it is revealed.
+        if (!m_isObserver && history.sourceCard->IsSecret())
+        {
+            const auto iter = entityList.find(history.sourceID);
+            if (iter == entityList.end() || !IsVisible(iter->second))
+            {
+                playedCard.card = nullptr;
+            }
+        }
+
+        func(playedCard);
+    }
+}
+
+bool PlayerView::IsVisible(const Playable* playable) const
+{
+    return m_isObserver || playable->GetGameTag(GameTag::REVEALED) == 1;
+}
+}  // namespace RosettaStone::PlayMode
@@ -0,0 +1,69 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import numpy as np
+import pyRosetta
+import pytest
+
+bg = pyRosetta.battlegrounds
+
+def test_game_env():
+	env = bg.GameEnv()
+	env.reset(42)
+
+	assert not env.is_done
+	assert env.current_player == 0
+	assert env.num_turns == 1
+
+	mask = env.legal_mask()
+	assert mask.shape == (bg.GameEnv.NUM_ACTIONS,)
+	assert mask.sum() == len(env.legal_actions())
+
+	end_turn = bg.Action(bg.ActionType.END_TURN)
+	assert mask[bg.GameEnv.encode_action(end_turn)] == 1
+	assert bg.GameEnv.decode_action(bg.GameEnv.encode_action(end_turn)) == end_turn
+
+	observation = env.observation(0)
+	assert observation.shape == (bg.GameEnv.NUM_OBSERVATIONS,)
+	assert observation.dtype == np.float32
+
+	env.step(bg.Action(bg.ActionType.PURCHASE, 0))
+	env.step(bg.GameEnv.encode_action(end_turn))
+	assert env.current_player == 1
+
+	env.advance_phase()
+	assert env.num_turns == 2
+	assert env.current_player == 0
+
+def test_vector_env():
+	num_envs = 8
+	env = bg.VectorEnv(num_envs, 2)
+	env.set_max_turns(3)
+
+	with pytest.raises(Exception):
+		env.step(np.zeros(num_envs, dtype=np.int32))
+
+	observations, masks, players = env.reset(7)
+	assert observations.shape == (num_envs, bg.GameEnv.NUM_OBSERVATIONS)
+	assert masks.shape == (num_envs, bg.GameEnv.NUM_ACTIONS)
+	assert players.shape == (num_envs,)
+
+	rng = np.random.default_rng(0)
+	num_dones = 0
+
+	for _ in range(300):
+		actions = np.array([rng.choice(np.flatnonzero(mask)) for mask in masks], dtype=np.int32)
+		observations, rewards, dones, masks, players = env.step(actions)
+
+		assert rewards.shape == (num_envs, 8)
+		num_dones += dones.sum()
+
+	assert num_dones > 0
+
+	with pytest.raises(Exception):
+		env.step(np.zeros(num_envs - 1, dtype=np.int32))
@@ -0,0 +1,178 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import random
+
+import numpy as np
+import pyRosetta
+
+def make_config():
+	config = pyRosetta.GameConfig()
+	config.player1_class = pyRosetta.CardClass.MAGE
+	config.player2_class = pyRosetta.CardClass.HUNTER
+	config.start_player = pyRosetta.PlayerType.PLAYER1
+	config.do_fill_decks = True
+	config.skip_mulligan = True
+	config.auto_run = True
+	return config
+
+def test_game_config():
+	config = make_config()
+	assert config.player1_deck == []
+
+	card = pyRosetta.Cards.find_card_by_id('AT_001')
+	config.player1_deck = [card] * 30
+	assert len(config.player1_deck) == 30
+	assert config.player1_deck[0].id == 'AT_001'
+
+def test_game():
+	game = pyRosetta.Game(make_config())
+	game.start()
+
+	assert game.state == pyRosetta.State.RUNNING
+	assert game.turn() == 1
+
+	player1 = game.player1()
+	assert player1.player_type == pyRosetta.PlayerType.PLAYER1
+	assert player1.hero_health() == 30
+	assert player1.remaining_mana() == 1
+	assert game.current_player().player_type == pyRosetta.PlayerType.PLAYER1
+
+	actions = pyRosetta.legal_actions(game)
+	assert actions[-1] == pyRosetta.Action(pyRosetta.ActionType.END_TURN)
+
+	pyRosetta.end_turn(game)
+	assert game.turn() == 2
+	assert game.current_player().player_type == pyRosetta.PlayerType.PLAYER2
+
+def test_vector_env():
+	env = pyRosetta.VectorEnv(make_config(), 4, 2)
+	env.set_max_turns(10)
+	observations, current_players, turns = env.reset(42)
+
+	assert env.num_envs == 4
+	assert observations.shape == (4, pyRosetta.ObservationEncoder.NUM_FEATURES)
+	assert current_players.shape == (4,)
+	assert (turns == 1).all()
+
+	rng = random.Random(7)
+	num_dones = 0
+
+	for _ in range(200):
+		actions = [rng.choice(env.legal_actions(i)) for i in range(env.num_envs)]
+		observations, rewards, dones, current_players, turns = env.step(actions)
+
+		assert rewards.shape == (4, 2)
+		assert rewards.dtype == np.float32
+		num_dones += int(dones.sum())
+
+	assert num_dones > 0
+
+
+def test_observation_encoder():
+	games = [pyRosetta.Game(make_config()) for _ in range(3)]
+	for game in games:
+		game.start()
+
+	observation = pyRosetta.ObservationEncoder.encode(games[0].current_player())
+	assert observation.shape == (pyRosetta.ObservationEncoder.NUM_FEATURES,)
+	assert observation.dtype == np.float32
+	assert observation[0] == 1
+
+	hero_offset = pyRosetta.ObservationEncoder.PLAYER_OFFSET + pyRosetta.ObservationEncoder.NUM_PLAYER_FEATURES
+	assert observation[hero_offset + 1] == 30
+
+	encoder = pyRosetta.ObservationEncoder(2)
+	observations = encoder.encode_batch(games)
+	assert observations.shape == (3, pyRosetta.ObservationEncoder.NUM_FEATURES)
+	assert (observations[0] == observation).all()
+
+def test_action_encoder():
+	game = pyRosetta.Game(make_config())
+	game.start()
+
+	mask = pyRosetta.ActionEncoder.mask(game)
+	actions = pyRosetta.legal_actions(game)
+	assert mask.shape == (pyRosetta.ActionEncoder.NUM_ACTIONS,)
+	assert mask.sum() == len(actions)
+
+	for action in actions:
+		action_idx = pyRosetta.ActionEncoder.encode(action)
+		assert mask[action_idx]
+		assert pyRosetta.ActionEncoder.decode(action_idx) == action
+
+	end_turn = pyRosetta.Action(pyRosetta.ActionType.END_TURN)
+	assert pyRosetta.ActionEncoder.encode(end_turn) == pyRosetta.ActionEncoder.END_TURN_OFFSET
+
+	encoder = pyRosetta.ActionEncoder(2)
+	masks = encoder.mask_batch([game, game])
+	assert (masks[1] == mask).all()
+
+def test_vector_env_action_indices():
+	env = pyRosetta.VectorEnv(make_config(), 3)
+	env.reset(3)
+
+	rng = np.random.default_rng(5)
+
+	for _ in range(50):
+		masks = env.action_masks()
+		assert masks.shape == (3, pyRosetta.ActionEncoder.NUM_ACTIONS)
+
+		action_indices = [int(rng.choice(np.flatnonzero(mask))) for mask in masks]
+		env.step(action_indices)
+
+def test_vector_env_views():
+	env = pyRosetta.VectorEnv(make_config(), 2)
+	observations, _, _ = env.reset(1)
+
+	assert not observations.flags.writeable
+	assert not observations.flags.owndata
+	assert np.shares_memory(observations, env.observations())
+
+	prev = observations.copy()
+	end_turn = pyRosetta.Action(pyRosetta.ActionType.END_TURN)
+	next_observations, _, _, _, _ = env.step([end_turn] * 2)
+
+	assert not np.shares_memory(observations, next_observations)
+	assert (observations == prev).all()
+
+	masks = env.action_masks()
+	assert masks.dtype == np.bool_
+	assert not masks.flags.writeable
+
+	env.step([end_turn] * 2)
+	assert np.shares_memory(observations, env.observations())
+
+def test_trajectory_writer(tmp_path):
+	path = str(tmp_path / 'trajectory.bin')
+	env = pyRosetta.VectorEnv(make_config(), 2)
+	observations, _, _ = env.reset(8)
+
+	writer = pyRosetta.TrajectoryWriter(path, 16)
+	expected = []
+
+	for _ in range(20):
+		masks = env.action_masks()
+		action_indices = np.array([np.flatnonzero(mask)[-1] for mask in masks], dtype=np.int32)
+		expected.append(observations.copy())
+
+		next_observations, rewards, dones, _, _ = env.step([int(idx) for idx in action_indices])
+		writer.append_batch(observations, action_indices, masks, rewards[:, 0], dones)
+		observations = next_observations
+
+	writer.close()
+	assert writer.num_steps == 40
+
+	reader = pyRosetta.TrajectoryReader()
+	reader.open(path)
+	assert reader.num_steps == 40
+
+	chunks = [reader.read_chunk(i) for i in range(reader.num_chunks)]
+	read_observations = np.concatenate([chunk['observations'] for chunk in chunks])
+	assert (read_observations == np.concatenate(expected)).all()
+	assert (np.concatenate([chunk['envs'] for chunk in chunks])[:4] == [0, 1, 0, 1]).all()
@@ -0,0 +1,25 @@
+"""
+Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+We are making my contributions/submissions to this project solely in our
+personal capacity and are not conveying any rights to any intellectual
+property of any third parties.
+"""
+
+import pyRosetta
+
+def test_card_loading_phases():
+	pyRosetta.Cards.all_cards()
+
+	phase = pyRosetta.StartupProfiler.find_phase("PlayMode::Cards")
+	assert phase.num_calls == 1
+	assert phase.depth == 0
+	assert phase.elapsed_ms > 0.0
+	counting = pyRosetta.StartupProfiler.is_counting_allocations()
+	assert (phase.num_allocations > 0) == counting
+
+	names = [p.name for p in pyRosetta.StartupProfiler.phases()]
+	assert "PlayMode::Cards/CardLoader::Load/JSON parse" in names
+	assert "PlayMode::Cards/InternalCardLoader::Load/CardDefs" in names
+
+	assert "JSON parse" in pyRosetta.StartupProfiler.to_string()
@@ -685,9 +685,6 @@ TEST_CASE("[Battlegrounds : Minion] - BGS_061 : Scallywag")
     Battle battle(player1, player2);
     battle.Initialize();
 
-    player1.getBattleCallback = [&]() -> Battle& { return battle; };
-    player2.getBattleCallback = [&]() -> Battle& { return battle; };
-
     CHECK_EQ(battle.GetPlayer1Field().GetCount(), 2);
     CHECK_EQ(battle.GetPlayer2Field().GetCount(), 1);
     CHECK_EQ(battle.GetPlayer2Field()[0].GetHealth(), 4);
@@ -757,9 +754,6 @@ TEST_CASE("[Battlegrounds : Minion] - OG_221 : Selfless Hero")
     Battle battle(player1, player2);
     battle.Initialize();
 
-    player1.getBattleCallback = [&]() -> Battle& { return battle; };
-    player2.getBattleCallback = [&]() -> Battle& { return battle; };
-
     CHECK_EQ(battle.GetPlayer1Field().GetCount(), 2);
     CHECK_EQ(battle.GetPlayer2Field().GetCount(), 1);
     CHECK_EQ(battle.GetPlayer1Field()[1].HasDivineShield(), false);
@@ -17,4 +17,27 @@ TEST_CASE("[Cards] - GetAllCards")
 
     CHECK_FALSE(cards.empty());
     CHECK_EQ(static_cast<int>(cards.size()), NUM_BATTLEGROUNDS_CARDS);
-}
\ No newline at end of file
+}
+
+TEST_CASE("[Cards] - FindCardByID")
+{
+    const Card& card1 = Cards::FindCardByID("BGS_039");
+    const Card& card2 = Cards::FindCardByID("BGS_039");
+
+    CHECK_EQ(card1.id, "BGS_039");
+    CHECK_EQ(&card1, &card2);
+    CHECK_EQ(&card1, &Cards::FindCardByDbfID(card1.dbfID));
+
+    const Card& emptyCard = Cards::FindCardByID("INVALID_CARD_ID");
+    CHECK(emptyCard.id.empty());
+}
+
+TEST_CASE("[Cards] - GetTier1Minions")
+{
+    for (const auto& card : Cards::GetTier1Minions())
+    {
+        REQUIRE(card != nullptr);
+        CHECK_EQ(card->GetTier(), 1);
+        CHECK_EQ(card, &Cards::FindCardByDbfID(card->dbfID));
+    }
+}
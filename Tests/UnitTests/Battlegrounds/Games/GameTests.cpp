@@ -8,11 +8,16 @@
 
 #include <Rosetta/Battlegrounds/Cards/Cards.hpp>
 #include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Battlegrounds/Models/Battle.hpp>
 #include <Rosetta/Battlegrounds/Utils/GameUtils.hpp>
 
+#include <effolkronium/random.hpp>
+
 using namespace RosettaStone;
 using namespace Battlegrounds;
 
+using Random = effolkronium::random_thread_local;
+
 TEST_CASE("[Game] - Basic")
 {
     Game game;
@@ -40,7 +45,7 @@ TEST_CASE("[Game] - Basic")
 
     for (auto& player : game.GetGameState().players)
     {
-        CHECK_EQ(player.hero.health, player.hero.card.GetHealth());
+        CHECK_EQ(player.hero.health, player.hero.card->GetHealth());
 
         CHECK_EQ(player.remainCoin, 3);
         CHECK_EQ(player.totalCoin, 3);
@@ -222,6 +227,104 @@ TEST_CASE("[Game] - DetermineOpponent")
     }
 }
 
+TEST_CASE("[Game] - DeterminePlayerToFightGhost")
+{
+    Game game;
+    game.Start();
+
+    auto& players = game.GetGameState().players;
+    for (std::size_t i = 0; i < players.size(); ++i)
+    {
+        players.at(i).hero.health = 40 - static_cast<int>(i);
+    }
+
+    players.at(7).hero.health = 0;
+    game.ProcessDefeat(players.at(7));
+    CHECK_EQ(game.GetGameState().ghostPlayerIdx, 7);
+
+    // Players 4, 5 and 6 are bottom 3
+    std::size_t prevGhostFighter = players.size();
+    for (int turn = 0; turn < 10; ++turn)
+    {
+        game.DetermineOpponent();
+
+        std::size_t ghostFighter = players.size();
+        for (auto& player : players)
+        {
+            if (player.playState != PlayState::PLAYING)
+            {
+                continue;
+            }
+
+            if (game.FindPlayerNextFight(player.idx) == 7)
+            {
+                CHECK_EQ(ghostFighter, players.size());
+                ghostFighter = player.idx;
+            }
+        }
+
+        CHECK_GE(ghostFighter, 4);
+        CHECK_LE(ghostFighter, 6);
+        CHECK(players.at(ghostFighter).isFoughtGhostLastTurn);
+        CHECK_NE(ghostFighter, prevGhostFighter);
+
+        prevGhostFighter = ghostFighter;
+    }
+
+    // The ghost is defeated only once
+    game.ProcessDefeat(players.at(7));
+    CHECK_EQ(players.at(7).rank, 8);
+    CHECK_EQ(game.GetGameState().numRemainPlayer, 7);
+
+    // Someone fights the ghost even if all bottom 3 fought it last turn
+    for (auto& player : players)
+    {
+        player.isFoughtGhostLastTurn = true;
+    }
+
+    game.DetermineOpponent();
+
+    std::size_t ghostFighter = players.size();
+    for (auto& player : players)
+    {
+        if (player.playState == PlayState::PLAYING &&
+            game.FindPlayerNextFight(player.idx) == 7)
+        {
+            ghostFighter = player.idx;
+        }
+    }
+
+    CHECK_GE(ghostFighter, 4);
+    CHECK_LE(ghostFighter, 6);
+    CHECK(players.at(ghostFighter).isFoughtGhostLastTurn);
+}
+
+TEST_CASE("[Game] - Recruit after combat")
+{
+    Game game;
+    game.Start();
+
+    for (auto& player : game.GetGameState().players)
+    {
+        player.SelectHero(0);
+    }
+
+    auto& players = game.GetGameState().players;
+    for (auto& player : players)
+    {
+        player.isInCombat = true;
+    }
+
+    // Battlecries in recruit phase must resolve on the recruit field
+    game.Recruit();
+
+    for (auto& player : players)
+    {
+        CHECK_FALSE(player.isInCombat);
+        CHECK_EQ(&player.GetField(), &player.recruitField);
+    }
+}
+
 TEST_CASE("[Game] - Freeze")
 {
     Game game;
@@ -388,4 +491,196 @@ TEST_CASE("[Game] - Rank")
     CHECK_EQ(players.at(5).rank, 5);
     CHECK_EQ(players.at(6).rank, 4);
     CHECK_EQ(players.at(7).rank, 3);
-}
\ No newline at end of file
+}
+
+TEST_CASE("[Game] - Combat in parallel")
+{
+    auto playRound = [](std::size_t numCombatThreads) {
+        Random::seed(2021);
+
+        Game game;
+        game.SetNumCombatThreads(numCombatThreads);
+        game.Start();
+
+        for (auto& player : game.GetGameState().players)
+        {
+            player.SelectHero(1);
+        }
+
+        for (auto& player : game.GetGameState().players)
+        {
+            for (std::size_t i = 0; i <= player.idx % 3; ++i)
+            {
+                Minion minion(Cards::FindCardByID("BGS_039"));
+                player.hand.Add(minion);
+                player.PlayCard(0, 0);
+            }
+        }
+
+        for (auto& player : game.GetGameState().players)
+        {
+            player.CompleteRecruit();
+        }
+
+        std::vector<int> healths;
+        for (auto& player : game.GetGameState().players)
+        {
+            healths.emplace_back(player.hero.health);
+            CHECK_EQ(player.battle, nullptr);
+        }
+
+        return healths;
+    };
+
+    const std::vector<int> healths1 = playRound(1);
+    const std::vector<int> healths2 = playRound(4);
+
+    CHECK(healths1 == healths2);
+}
+
+TEST_CASE("[Game] - Player context")
+{
+    Game game;
+    game.Start();
+
+    for (auto& player : game.GetGameState().players)
+    {
+        CHECK_EQ(player.game, &game);
+        player.SelectHero(1);
+    }
+
+    for (auto& player : game.GetGameState().players)
+    {
+        Player& opponent = player.GetOpponentPlayer();
+        CHECK_EQ(opponent.idx, game.FindPlayerNextFight(player.idx));
+        CHECK_EQ(&opponent.GetOpponentPlayer(), &player);
+    }
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = player1.GetOpponentPlayer();
+
+    {
+        Battle battle(player1, player2);
+        CHECK_EQ(player1.battle, &battle);
+        CHECK_EQ(&player1.GetOpponentPlayer(), &player2);
+    }
+    CHECK_EQ(player1.battle, nullptr);
+
+    for (int tier = 2; tier <= TIER_UPPER_LIMIT; ++tier)
+    {
+        player1.remainCoin = 10;
+        player1.UpgradeTavern();
+        CHECK_EQ(player1.currentTier, tier);
+    }
+}
+
+TEST_CASE("[Game] - Clone")
+{
+    Game game;
+    game.SetNumCombatThreads(4);
+    game.Start();
+
+    for (auto& player : game.GetGameState().players)
+    {
+        player.SelectHero(0);
+    }
+
+    Player& player = game.GetGameState().players[0];
+    player.remainCoin = 10;
+    player.PurchaseMinion(0);
+
+    Minion minion(Cards::FindCardByID("BGS_039"));
+    player.hand.Add(minion);
+    player.PlayCard(player.hand.GetCount() - 1, 0);
+
+    const auto poolCount = game.GetGameState().minionPool.GetCount();
+    const auto numHandCards = player.hand.GetCount();
+    const auto numRecruitMinions = player.recruitField.GetCount();
+    const auto numTavernMinions = player.tavern.fieldZone.GetCount();
+
+    std::vector<int> healths;
+    for (auto& p : game.GetGameState().players)
+    {
+        healths.emplace_back(p.hero.health);
+    }
+
+    const auto clone = game.Clone();
+    auto& clonePlayers = clone->GetGameState().players;
+
+    // The clone doesn't inherit the thread pool of the game.
+    CHECK_EQ(clone->GetNumCombatThreads(), 1u);
+    CHECK_EQ(game.GetNumCombatThreads(), 4u);
+
+    for (std::size_t i = 0; i < clonePlayers.size(); ++i)
+    {
+        CHECK_EQ(clonePlayers[i].game, clone.get());
+        CHECK_EQ(clonePlayers[i].hero.health,
+                 game.GetGameState().players[i].hero.health);
+        CHECK_EQ(clone->FindPlayerNextFight(i), game.FindPlayerNextFight(i));
+    }
+
+    Player& clonePlayer = clonePlayers[0];
+    CHECK_EQ(clonePlayer.recruitField.GetCount(), numRecruitMinions);
+    clonePlayer.recruitField.ForEach([&](MinionData& minion) {
+        CHECK_EQ(minion.value().owner, &clonePlayer);
+    });
+
+    // Changes of the clone don't affect the original
+    clonePlayer.PurchaseMinion(0);
+    clonePlayer.SellMinion(0);
+    clonePlayer.RefreshTavern();
+
+    CHECK_EQ(player.remainCoin, 7);
+    CHECK_EQ(player.recruitField.GetCount(), numRecruitMinions);
+    CHECK_EQ(player.tavern.fieldZone.GetCount(), numTavernMinions);
+    CHECK_EQ(player.hand.GetCount(), numHandCards);
+    CHECK_EQ(game.GetGameState().minionPool.GetCount(), poolCount);
+
+    for (auto& p : clonePlayers)
+    {
+        p.CompleteRecruit();
+    }
+
+    CHECK_EQ(clone->GetGameState().phase, Phase::RECRUIT);
+    for (auto& p : game.GetGameState().players)
+    {
+        CHECK_EQ(p.hero.health, healths[p.idx]);
+        CHECK_EQ(p.battle, nullptr);
+    }
+}
+
+TEST_CASE("[Game] - Snapshot and restore")
+{
+    Game game;
+    game.Start();
+
+    for (auto& player : game.GetGameState().players)
+    {
+        player.SelectHero(0);
+    }
+
+    Player& player = game.GetGameState().players[0];
+    player.remainCoin = 10;
+
+    const GameSnapshot snapshot = game.Snapshot();
+    const auto poolCount = game.GetGameState().minionPool.GetCount();
+    const auto poolIdx = player.tavern.fieldZone[0].GetPoolIndex();
+
+    for (int i = 0; i < 2; ++i)
+    {
+        player.PurchaseMinion(0);
+        player.UpgradeTavern();
+        CHECK_EQ(player.hand.GetCount(), 1);
+        CHECK_EQ(player.currentTier, 2);
+
+        game.Restore(snapshot);
+
+        CHECK_EQ(player.remainCoin, 10);
+        CHECK_EQ(player.currentTier, 1);
+        CHECK_EQ(player.hand.GetCount(), 0);
+        CHECK_EQ(player.recruitField.GetCount(), 0);
+        CHECK_EQ(player.tavern.fieldZone[0].GetPoolIndex(), poolIdx);
+        CHECK_EQ(player.game, &game);
+        CHECK_EQ(game.GetGameState().minionPool.GetCount(), poolCount);
+    }
+}
@@ -0,0 +1,206 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Managers/GameEnv.hpp>
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+namespace
+{
+//! Returns the index of a legal action chosen by \p engine.
+std::size_t ChooseAction(
+    const std::array<std::uint8_t, GameEnv::NUM_ACTIONS>& mask,
+    std::mt19937& engine)
+{
+    std::vector<std::size_t> candidates;
+    for (std::size_t i = 0; i < mask.size(); ++i)
+    {
+        if (mask[i])
+        {
+            candidates.emplace_back(i);
+        }
+    }
+
+    return candidates[engine() % candidates.size()];
+}
+
+//! Plays an episode with actions chosen by an engine seeded by \p seed and
+//! returns the observations of the current players.
+std::vector<float> PlayEpisode(GameEnv& env, std::size_t maxTurns,
+                               unsigned int envSeed, unsigned int seed)
+{
+    std::mt19937 engine(seed);
+    std::array<std::uint8_t, GameEnv::NUM_ACTIONS> mask{};
+    std::array<float, GameEnv::NUM_OBSERVATIONS> observation{};
+    std::vector<float> observations;
+
+    env.SetMaxTurns(maxTurns);
+    env.Reset(envSeed);
+
+    while (!env.IsDone())
+    {
+        env.WriteObservation(env.GetCurrentPlayerIdx(), observation.data());
+        observations.insert(observations.end(), observation.begin(),
+                            observation.end());
+
+        env.WriteLegalMask(mask.data());
+        env.Step(GameEnv::DecodeAction(ChooseAction(mask, engine)));
+    }
+
+    return observations;
+}
+}  // namespace
+
+TEST_CASE("[GameEnv] - EncodeAction and DecodeAction")
+{
+    for (std::size_t i = 0; i < GameEnv::NUM_ACTIONS; ++i)
+    {
+        CHECK_EQ(GameEnv::EncodeAction(GameEnv::DecodeAction(i)), i);
+    }
+
+    CHECK_EQ(GameEnv::EncodeAction(Action{ ActionType::PLAY, 0, -1 }),
+             GameEnv::PLAY_OFFSET);
+    CHECK_EQ(GameEnv::EncodeAction(Action{ ActionType::PLAY, 1, 0 }),
+             GameEnv::PLAY_OFFSET + GameEnv::NUM_PLAY_TARGETS + 1);
+    CHECK_EQ(GameEnv::EncodeAction(Action{ ActionType::REARRANGE, 6, 5 }),
+             GameEnv::END_TURN_INDEX - 2);
+    const Action endTurn{ ActionType::END_TURN, -1, -1 };
+    CHECK(GameEnv::DecodeAction(GameEnv::END_TURN_INDEX) == endTurn);
+    CHECK_THROWS(GameEnv::DecodeAction(GameEnv::NUM_ACTIONS));
+}
+
+TEST_CASE("[GameEnv] - Reset")
+{
+    GameEnv env;
+    CHECK(env.IsDone());
+    CHECK_THROWS(env.Step(Action{ ActionType::END_TURN, -1, -1 }));
+
+    env.Reset(42);
+    CHECK_FALSE(env.IsDone());
+    CHECK_EQ(env.GetNumTurns(), 1);
+    CHECK_EQ(env.GetCurrentPlayerIdx(), 0);
+
+    Player& player = env.GetGame().GetGameState().players[0];
+
+    std::array<float, GameEnv::NUM_OBSERVATIONS> observation{};
+    env.WriteObservation(0, observation.data());
+    CHECK_EQ(observation[0], static_cast<float>(player.hero.health));
+    CHECK_EQ(observation[1], static_cast<float>(player.remainCoin));
+    CHECK_EQ(observation[3], 1.0f);
+    CHECK_EQ(observation[6], 8.0f);
+    CHECK_EQ(observation[7], 1.0f);
+
+    // Minions in Tavern
+    const std::size_t tavernOffset =
+        GameEnv::NUM_PLAYER_FEATURES +
+        MAX_FIELD_SIZE * GameEnv::NUM_CARD_FEATURES;
+    CHECK_EQ(observation[GameEnv::NUM_PLAYER_FEATURES], 0.0f);
+    CHECK_EQ(observation[tavernOffset], 1.0f);
+    CHECK_EQ(observation[tavernOffset + 1],
+             static_cast<float>(
+                 player.tavern.fieldZone[0].GetCard().dbfID));
+
+    std::array<std::uint8_t, GameEnv::NUM_ACTIONS> mask{};
+    env.WriteLegalMask(mask.data());
+    const auto actions = env.GetLegalActions();
+
+    std::size_t numLegalActions = 0;
+    for (const auto flag : mask)
+    {
+        numLegalActions += flag;
+    }
+    CHECK_EQ(numLegalActions, actions.size());
+    CHECK_EQ(mask[GameEnv::END_TURN_INDEX], 1);
+    CHECK_EQ(mask[GameEnv::PURCHASE_OFFSET], 1);
+    CHECK_EQ(mask[GameEnv::SELL_OFFSET], 0);
+}
+
+TEST_CASE("[GameEnv] - Step and AdvancePhase")
+{
+    GameEnv env;
+    env.Reset(7);
+
+    Player& player = env.GetGame().GetGameState().players[0];
+
+    env.Step(Action{ ActionType::PURCHASE, 0, -1 });
+    CHECK_EQ(player.hand.GetCount(), 1);
+    CHECK_EQ(env.GetCurrentPlayerIdx(), 0);
+
+    env.Step(Action{ ActionType::END_TURN, -1, -1 });
+    CHECK_EQ(env.GetCurrentPlayerIdx(), 1);
+    CHECK_EQ(env.GetNumTurns(), 1);
+
+    env.AdvancePhase();
+    CHECK_EQ(env.GetCurrentPlayerIdx(), 0);
+    CHECK_EQ(env.GetNumTurns(), 2);
+    CHECK_EQ(player.totalCoin, 4);
+
+    // Illegal actions don't change the game.
+    CHECK_THROWS_AS(env.Step(Action{ ActionType::SELL, 3, -1 }),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(env.Step(Action{ ActionType::PLAY, 5, -1 }),
+                    std::invalid_argument);
+    CHECK_EQ(env.GetCurrentPlayerIdx(), 0);
+    CHECK_EQ(player.hand.GetCount(), 1);
+
+    // The turn ends when the player reaches the maximum number of actions.
+    env.SetMaxActionsPerTurn(1);
+    env.Step(Action{ ActionType::FREEZE, -1, -1 });
+    CHECK_EQ(env.GetCurrentPlayerIdx(), 1);
+}
+
+TEST_CASE("[GameEnv] - Episode")
+{
+    GameEnv env1;
+    GameEnv env2;
+
+    const auto observations1 = PlayEpisode(env1, 10, 3, 5);
+    const auto observations2 = PlayEpisode(env2, 10, 3, 5);
+
+    // The episode only depends on the seed and actions.
+    CHECK(observations1 == observations2);
+    CHECK(env1.IsDone());
+    CHECK(env1.IsTruncated());
+    CHECK_EQ(env1.GetNumTurns(), 10);
+    CHECK_EQ(env1.GetReward(0), 0.0f);
+
+    // Rewards of a complete episode are linear in the placement.
+    for (unsigned int seed = 0; seed < 10; ++seed)
+    {
+        PlayEpisode(env1, 100, seed, seed);
+        if (!env1.IsTruncated())
+        {
+            break;
+        }
+    }
+    REQUIRE_FALSE(env1.IsTruncated());
+    CHECK_THROWS(env1.AdvancePhase());
+
+    float sum = 0.0f;
+    for (const auto& player : env1.GetGame().GetGameState().players)
+    {
+        const float reward = env1.GetReward(player.idx);
+        sum += reward;
+
+        if (player.rank == 1)
+        {
+            CHECK_EQ(reward, 1.0f);
+        }
+        else if (player.rank == 8)
+        {
+            CHECK_EQ(reward, -1.0f);
+        }
+    }
+    CHECK(std::abs(sum) < 1e-5f);
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Agents/RandomAgent.hpp>
+#include <Rosetta/Battlegrounds/Managers/GameRunner.hpp>
+
+#include <effolkronium/random.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+using Random = effolkronium::random_thread_local;
+
+namespace
+{
+std::unique_ptr<IAgent> CreateRandomAgent(std::size_t)
+{
+    return std::make_unique<RandomAgent>();
+}
+}  // namespace
+
+TEST_CASE("[GameRunner] - GetLegalActions")
+{
+    Game game;
+    game.Start();
+
+    for (auto& player : game.GetGameState().players)
+    {
+        player.SelectHero(0);
+    }
+
+    Player& player = game.GetGameState().players[0];
+    player.remainCoin = NUM_COIN_PURCHASE_MINION;
+
+    auto actions = GetLegalActions(player);
+    CHECK_EQ(actions.back().type, ActionType::END_TURN);
+    CHECK_EQ(std::count_if(actions.begin(), actions.end(),
+                           [](const Action& action) {
+                               return action.type == ActionType::PURCHASE;
+                           }),
+             player.tavern.fieldZone.GetCount());
+    CHECK(std::none_of(actions.begin(), actions.end(), [](const Action& a) {
+        return a.type == ActionType::SELL || a.type == ActionType::UPGRADE;
+    }));
+
+    ApplyAction(player, Action{ ActionType::PURCHASE, 0, -1 });
+    CHECK_EQ(player.hand.GetCount(), 1);
+    CHECK_EQ(player.remainCoin, 0);
+
+    actions = GetLegalActions(player);
+    CHECK(std::none_of(actions.begin(), actions.end(), [](const Action& a) {
+        return a.type == ActionType::PURCHASE || a.type == ActionType::REFRESH;
+    }));
+}
+
+TEST_CASE("[GameRunner] - GetLegalActions with spell")
+{
+    Game game;
+    game.Start();
+
+    for (auto& player : game.GetGameState().players)
+    {
+        player.SelectHero(0);
+    }
+
+    Player& player = game.GetGameState().players[0];
+    player.remainCoin = NUM_COIN_PURCHASE_MINION;
+
+    ApplyAction(player, Action{ ActionType::PURCHASE, 0, -1 });
+    player.hand.Add(Spell{}, 0);
+    REQUIRE_EQ(player.hand.GetCount(), 2);
+
+    // Spells can't be played yet, so only the minion has PLAY actions.
+    const auto actions = GetLegalActions(player);
+    CHECK(std::none_of(actions.begin(), actions.end(), [](const Action& a) {
+        return a.type == ActionType::PLAY && a.index == 0;
+    }));
+    CHECK(std::any_of(actions.begin(), actions.end(), [](const Action& a) {
+        return a.type == ActionType::PLAY && a.index == 1;
+    }));
+
+    CHECK_THROWS_AS(ApplyAction(player, Action{ ActionType::PLAY, 0, -1 }),
+                    std::invalid_argument);
+    CHECK_EQ(player.hand.GetCount(), 2);
+}
+
+TEST_CASE("[GameRunner] - Play")
+{
+    Random::seed(2021);
+
+    RandomAgent agent;
+    std::array<IAgent*, NUM_BATTLEGROUNDS_PLAYERS> agents{};
+    agents.fill(&agent);
+
+    GameRunner runner(CreateRandomAgent, 1);
+    runner.SetMaxTurns(1000);
+
+    Game game;
+    GameStats stats;
+
+    if (runner.Play(game, agents, stats))
+    {
+        CHECK_EQ(game.GetGameState().phase, Phase::COMPLETE);
+        CHECK_EQ(game.GetGameState().numRemainPlayer, 1);
+        CHECK_EQ(stats.numGames, 1);
+
+        std::vector<std::size_t> ranks;
+        for (const auto& player : game.GetGameState().players)
+        {
+            ranks.emplace_back(player.rank);
+        }
+        std::sort(ranks.begin(), ranks.end());
+
+        for (std::size_t i = 0; i < ranks.size(); ++i)
+        {
+            CHECK_EQ(ranks[i], i + 1);
+        }
+    }
+    else
+    {
+        CHECK_EQ(stats.numTruncatedGames, 1);
+    }
+
+    CHECK_GT(stats.numTurns, 0);
+    CHECK_GT(stats.numActions, 0);
+}
+
+TEST_CASE("[GameRunner] - Run")
+{
+    GameRunner runner1(CreateRandomAgent, 1);
+    GameRunner runner2(CreateRandomAgent, 4);
+
+    const GameStats stats1 = runner1.Run(8, 2021);
+    const GameStats stats2 = runner2.Run(8, 2021);
+
+    CHECK_EQ(stats1.numGames + stats1.numTruncatedGames, 8);
+    CHECK_EQ(stats1.numGames, stats2.numGames);
+    CHECK_EQ(stats1.numTurns, stats2.numTurns);
+    CHECK_EQ(stats1.numActions, stats2.numActions);
+    CHECK(stats1.placements == stats2.placements);
+
+    for (std::size_t seat = 0; seat < NUM_BATTLEGROUNDS_PLAYERS; ++seat)
+    {
+        std::size_t numPlacements = 0;
+        for (const auto count : stats1.placements[seat])
+        {
+            numPlacements += count;
+        }
+        CHECK_EQ(numPlacements, stats1.numGames);
+    }
+}
@@ -0,0 +1,152 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Managers/VectorEnv.hpp>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+namespace
+{
+//! Chooses a legal action of each environment with \p engine.
+std::vector<std::int32_t> ChooseActions(const VectorEnv& env,
+                                        std::mt19937& engine)
+{
+    const auto& masks = env.GetLegalMasks();
+    std::vector<std::int32_t> actions(env.GetNumEnvs());
+
+    for (std::size_t envIdx = 0; envIdx < env.GetNumEnvs(); ++envIdx)
+    {
+        std::vector<std::int32_t> candidates;
+        for (std::size_t i = 0; i < GameEnv::NUM_ACTIONS; ++i)
+        {
+            if (masks[envIdx * GameEnv::NUM_ACTIONS + i])
+            {
+                candidates.emplace_back(static_cast<std::int32_t>(i));
+            }
+        }
+
+        actions[envIdx] = candidates[engine() % candidates.size()];
+    }
+
+    return actions;
+}
+}  // namespace
+
+TEST_CASE("[VectorEnv] - Reset")
+{
+    VectorEnv env(4);
+
+    // Environments are not started before the first reset.
+    std::vector<std::int32_t> actions(4, GameEnv::END_TURN_INDEX);
+    CHECK_THROWS_AS(env.Step(actions.data()), std::logic_error);
+
+    env.Reset(42);
+
+    CHECK_EQ(env.GetNumEnvs(), 4);
+    CHECK_EQ(env.GetObservations().size(), 4 * GameEnv::NUM_OBSERVATIONS);
+    CHECK_EQ(env.GetLegalMasks().size(), 4 * GameEnv::NUM_ACTIONS);
+    CHECK_EQ(env.GetRewards().size(), 4 * NUM_BATTLEGROUNDS_PLAYERS);
+
+    for (std::size_t envIdx = 0; envIdx < 4; ++envIdx)
+    {
+        CHECK_EQ(env.GetCurrentPlayers()[envIdx], 0);
+        CHECK_EQ(env.GetDones()[envIdx], 0);
+        CHECK_EQ(env.GetLegalMasks()[envIdx * GameEnv::NUM_ACTIONS +
+                                     GameEnv::END_TURN_INDEX],
+                 1);
+        CHECK_EQ(env.GetObservations()[envIdx * GameEnv::NUM_OBSERVATIONS +
+                                       3],
+                 1.0f);
+    }
+
+    // Environments have different episodes.
+    const auto& observations = env.GetObservations();
+    CHECK_FALSE(std::equal(
+        observations.begin(),
+        observations.begin() + GameEnv::NUM_OBSERVATIONS,
+        observations.begin() + GameEnv::NUM_OBSERVATIONS));
+
+    // Illegal actions
+    actions.assign(4, GameEnv::SELL_OFFSET);
+    CHECK_THROWS(env.Step(actions.data()));
+    actions.assign(4, static_cast<std::int32_t>(GameEnv::NUM_ACTIONS));
+    CHECK_THROWS(env.Step(actions.data()));
+}
+
+TEST_CASE("[VectorEnv] - Outputs")
+{
+    VectorEnv env(3);
+
+    std::vector<float> observations(3 * GameEnv::NUM_OBSERVATIONS);
+    std::vector<std::uint8_t> legalMasks(3 * GameEnv::NUM_ACTIONS);
+    std::vector<std::int32_t> currentPlayers(3, -1);
+    std::vector<float> rewards(3 * NUM_BATTLEGROUNDS_PLAYERS, -2.0f);
+    std::vector<std::uint8_t> dones(3, 2);
+
+    VectorEnvOutputs outputs;
+    outputs.observations = observations.data();
+    outputs.legalMasks = legalMasks.data();
+    outputs.currentPlayers = currentPlayers.data();
+
+    // Null buffers are skipped.
+    env.Reset(5, outputs);
+    CHECK(observations == env.GetObservations());
+    CHECK(legalMasks == env.GetLegalMasks());
+    CHECK(currentPlayers == env.GetCurrentPlayers());
+
+    outputs.rewards = rewards.data();
+    outputs.dones = dones.data();
+
+    const std::vector<std::int32_t> actions(3, GameEnv::END_TURN_INDEX);
+    env.Step(actions.data(), outputs);
+    CHECK(observations == env.GetObservations());
+    CHECK(legalMasks == env.GetLegalMasks());
+    CHECK(currentPlayers == env.GetCurrentPlayers());
+    CHECK(rewards == env.GetRewards());
+    CHECK(dones == env.GetDones());
+    CHECK_EQ(currentPlayers[0], 1);
+}
+
+TEST_CASE("[VectorEnv] - Deterministic with seed")
+{
+    VectorEnv serialEnv(6, 1);
+    VectorEnv parallelEnv(6, 4);
+    serialEnv.SetMaxTurns(3);
+    parallelEnv.SetMaxTurns(3);
+    serialEnv.Reset(11);
+    parallelEnv.Reset(11);
+
+    std::mt19937 engine(13);
+    std::size_t numDones = 0;
+
+    for (int step = 0; step < 500; ++step)
+    {
+        const auto actions = ChooseActions(serialEnv, engine);
+        serialEnv.Step(actions.data());
+        parallelEnv.Step(actions.data());
+
+        CHECK(serialEnv.GetObservations() == parallelEnv.GetObservations());
+        CHECK(serialEnv.GetLegalMasks() == parallelEnv.GetLegalMasks());
+        CHECK(serialEnv.GetCurrentPlayers() ==
+              parallelEnv.GetCurrentPlayers());
+        CHECK(serialEnv.GetDones() == parallelEnv.GetDones());
+
+        for (const auto done : serialEnv.GetDones())
+        {
+            numDones += done;
+        }
+    }
+
+    // Episodes that are done are reset automatically.
+    CHECK(numDones > 0);
+}
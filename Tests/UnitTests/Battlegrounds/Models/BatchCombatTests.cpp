@@ -0,0 +1,172 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Battlegrounds/Models/BatchCombat.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatSimulator.hpp>
+
+#include <cmath>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[BatchCombat] - IsSupported")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    Minion minion1(Cards::FindCardByID("BGS_039"));
+    Minion minion2(Cards::FindCardByID("EX1_506"));
+    player1.recruitField.Add(minion1);
+    player2.recruitField.Add(minion2);
+
+    // Battlecries don't matter in combat.
+    CHECK(BatchCombat::IsSupported(player1, player2));
+
+    // Micro Machine has a trigger.
+    Minion minion3(Cards::FindCardByID("GVG_103"));
+    player2.recruitField.Add(minion3);
+    CHECK_FALSE(BatchCombat::IsSupported(player1, player2));
+    CHECK_FALSE(BatchCombat::IsSupported(player2, player1));
+}
+
+TEST_CASE("[BatchCombat] - Player 2 always wins")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    Minion minion1(Cards::FindCardByID("EX1_506"));
+    Minion minion2(Cards::FindCardByID("BGS_039"));
+    minion2.SetAttack(5);
+    minion2.SetHealth(5);
+    player1.recruitField.Add(minion1);
+    player2.recruitField.Add(minion2);
+    player2.currentTier = 3;
+
+    std::array<std::tuple<BattleResult, int>, BatchCombat::NUM_LANES> results;
+    BatchCombat batch(player1, player2);
+    batch.Run(results.size(), 42, results.data());
+
+    for (const auto& [result, damage] : results)
+    {
+        CHECK_EQ(result, BattleResult::PLAYER2_WIN);
+        CHECK_EQ(damage, 4);
+    }
+
+    // The batch can be run again with a part of lanes.
+    batch.Run(10, 7, results.data());
+    CHECK_EQ(std::get<0>(results[9]), BattleResult::PLAYER2_WIN);
+    CHECK_THROWS(batch.Run(BatchCombat::NUM_LANES + 1, 7, results.data()));
+}
+
+TEST_CASE("[BatchCombat] - Divine shield")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    // A 2/3 with divine shield beats a 2/4 without it.
+    Minion minion1(Cards::FindCardByID("BGS_039"));
+    Minion minion2(Cards::FindCardByID("BGS_039"));
+    minion1.SetHealth(3);
+    minion1.SetGameTag(GameTag::DIVINE_SHIELD, 1);
+    minion2.SetHealth(4);
+    player1.recruitField.Add(minion1);
+    player2.recruitField.Add(minion2);
+
+    std::array<std::tuple<BattleResult, int>, BatchCombat::NUM_LANES> results;
+    BatchCombat batch(player1, player2);
+    batch.Run(results.size(), 42, results.data());
+
+    for (const auto& [result, damage] : results)
+    {
+        CHECK_EQ(result, BattleResult::PLAYER1_WIN);
+        CHECK_EQ(damage, 1 + player1.currentTier);
+    }
+}
+
+TEST_CASE("[BatchCombat] - Matches the scalar path")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(59397));
+    player2.hero.Initialize(Cards::FindCardByDbfID(59397));
+
+    const std::array<std::array<int, 3>, 4> stats1{
+        { { 3, 2, 0 }, { 1, 5, 1 }, { 2, 2, 0 }, { 4, 1, 0 } }
+    };
+    const std::array<std::array<int, 3>, 4> stats2{
+        { { 2, 4, 1 }, { 3, 3, 0 }, { 0, 6, 0 }, { 5, 2, 0 } }
+    };
+
+    for (std::size_t i = 0; i < stats1.size(); ++i)
+    {
+        Minion minion1(Cards::FindCardByID(i % 2 == 0 ? "EX1_506" : "BGS_039"));
+        minion1.SetAttack(stats1[i][0]);
+        minion1.SetHealth(stats1[i][1]);
+        minion1.SetGameTag(GameTag::DIVINE_SHIELD, stats1[i][2]);
+        player1.recruitField.Add(minion1);
+
+        Minion minion2(Cards::FindCardByID(i % 2 == 0 ? "BGS_039" : "EX1_506"));
+        minion2.SetAttack(stats2[i][0]);
+        minion2.SetHealth(stats2[i][1]);
+        minion2.SetGameTag(GameTag::DIVINE_SHIELD, stats2[i][2]);
+        player2.recruitField.Add(minion2);
+    }
+
+    REQUIRE(BatchCombat::IsSupported(player1, player2));
+
+    constexpr std::size_t NUM_SAMPLES = 4000;
+
+    CombatSimulator batchSimulator(2);
+    CombatSimulator scalarSimulator(2);
+    scalarSimulator.SetBatchKernelEnabled(false);
+
+    const CombatResult batchResult =
+        batchSimulator.Run(player1, player2, NUM_SAMPLES, 42);
+    const CombatResult scalarResult =
+        scalarSimulator.Run(player1, player2, NUM_SAMPLES, 42);
+
+    CHECK_EQ(batchResult.numSamples, NUM_SAMPLES);
+    CHECK_EQ(batchResult.numWins + batchResult.numTies +
+                 batchResult.numLosses,
+             NUM_SAMPLES);
+
+    // NOTE: The standard error of a probability with 4000 samples is at most
+    // about 0.008, so the bounds are loose enough for any seed.
+    CHECK(std::abs(batchResult.GetWinProbability() -
+                   scalarResult.GetWinProbability()) < 0.05);
+    CHECK(std::abs(batchResult.GetTieProbability() -
+                   scalarResult.GetTieProbability()) < 0.05);
+    CHECK(std::abs(batchResult.GetLossProbability() -
+                   scalarResult.GetLossProbability()) < 0.05);
+    CHECK(std::abs(batchResult.GetAverageDamage() -
+                   scalarResult.GetAverageDamage()) < 0.5);
+
+    // The result only depends on the seed.
+    CombatSimulator serialSimulator(1);
+    const CombatResult serialResult =
+        serialSimulator.Run(player1, player2, NUM_SAMPLES, 42);
+    CHECK_EQ(serialResult.numWins, batchResult.numWins);
+    CHECK_EQ(serialResult.numTies, batchResult.numTies);
+    CHECK(serialResult.damageDealt == batchResult.damageDealt);
+    CHECK(serialResult.damageTaken == batchResult.damageTaken);
+}
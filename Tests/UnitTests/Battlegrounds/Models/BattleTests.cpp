@@ -157,4 +157,57 @@ TEST_CASE("[Battle] - Next Attacker")
 
     CHECK_EQ(battle.GetPlayer1NextAttacker(), 0);
     CHECK_EQ(battle.GetPlayer2NextAttacker(), 1);
-}
\ No newline at end of file
+}
+
+TEST_CASE("[Battle] - Trigger index of field zone")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    Minion minion1(Cards::FindCardByID("BGS_039"));
+    Minion minion2(Cards::FindCardByID("GVG_103"));
+    Minion minion3(Cards::FindCardByID("BG_EX1_531"));
+    minion1.owner = &player1;
+    minion2.owner = &player1;
+    minion3.owner = &player1;
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(59397));
+    player2.hero.Initialize(Cards::FindCardByDbfID(59397));
+
+    FieldZone& field = player1.recruitField;
+    field.Add(minion1);
+    field.Add(minion2);
+    field.Add(minion3);
+
+    CHECK(field.HasTrigger(TriggerType::TURN_START));
+    CHECK(field.HasTrigger(TriggerType::DEATH));
+    CHECK(!field.HasTrigger(TriggerType::SUMMON));
+
+    std::vector<int> positions;
+    field.ForEachAliveWithTrigger(
+        TriggerType::TURN_START, [&](MinionData& minion) {
+            positions.emplace_back(minion.value().GetZonePosition());
+        });
+    CHECK(positions == std::vector<int>{ 1 });
+
+    // Moving a minion moves its trigger too
+    field.Move(1, 2);
+    positions.clear();
+    field.ForEachAliveWithTrigger(
+        TriggerType::TURN_START, [&](MinionData& minion) {
+            positions.emplace_back(minion.value().GetZonePosition());
+        });
+    CHECK(positions == std::vector<int>{ 2 });
+
+    field.Remove(field[2]);
+    CHECK(!field.HasTrigger(TriggerType::TURN_START));
+    CHECK(field.HasTrigger(TriggerType::DEATH));
+
+    // The copy of field has the same triggers
+    Battle battle(player1, player2);
+    CHECK(battle.GetPlayer1Field().HasTrigger(TriggerType::DEATH));
+    CHECK(!battle.GetPlayer2Field().HasTrigger(TriggerType::DEATH));
+}
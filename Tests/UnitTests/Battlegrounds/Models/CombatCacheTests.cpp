@@ -0,0 +1,101 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatCache.hpp>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[CombatCache] - CalculateBoardHash")
+{
+    FieldZone field1;
+    FieldZone field2;
+    FieldZone emptyField;
+
+    Minion minion1(Cards::FindCardByDbfID(42467));
+    Minion minion2(Cards::FindCardByDbfID(60628));
+
+    field1.Add(minion1);
+    field1.Add(minion2);
+    field2.Add(minion1);
+    field2.Add(minion2);
+
+    // The same minions in the same order
+    CHECK_EQ(CalculateBoardHash(field1, emptyField),
+             CalculateBoardHash(field2, emptyField));
+    CHECK(EncodeBoards(field1, emptyField) ==
+          EncodeBoards(field2, emptyField));
+
+    // The sides of boards matter
+    CHECK(EncodeBoards(field1, emptyField) !=
+          EncodeBoards(emptyField, field1));
+    CHECK_NE(CalculateBoardHash(field1, emptyField),
+             CalculateBoardHash(emptyField, field1));
+
+    // The positions of minions matter
+    field2.Move(0, 1);
+    CHECK(EncodeBoards(field1, emptyField) !=
+          EncodeBoards(field2, emptyField));
+    field2.Move(1, 0);
+
+    // The stats of minions matter
+    field2[0].SetAttack(field2[0].GetAttack() + 1);
+    CHECK(EncodeBoards(field1, emptyField) !=
+          EncodeBoards(field2, emptyField));
+}
+
+TEST_CASE("[CombatCache] - Hit and eviction")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+    Player& player3 = game.GetGameState().players[2];
+
+    Minion minion1(Cards::FindCardByDbfID(42467));
+    Minion minion2(Cards::FindCardByDbfID(60628));
+
+    player1.recruitField.Add(minion1);
+    player2.recruitField.Add(minion2);
+    player3.recruitField.Add(minion2);
+    player2.currentTier = 3;
+    player3.currentTier = 3;
+
+    CombatSimulator simulator(1);
+    CombatCache cache(simulator, 1);
+
+    const CombatResult result1 = cache.Run(player1, player2, 10, 1);
+    CHECK_EQ(cache.GetStats().numMisses, 1);
+    CHECK_EQ(cache.GetSize(), 1);
+
+    // Player 3 has the same board and tier as player 2
+    const CombatResult result2 = cache.Run(player1, player3, 10, 2);
+    CHECK_EQ(cache.GetStats().numHits, 1);
+    CHECK_EQ(result2.numLosses, result1.numLosses);
+    CHECK(result2.damageTaken == result1.damageTaken);
+
+    // The number of samples is a part of key
+    cache.Run(player1, player2, 20, 1);
+    CHECK_EQ(cache.GetStats().numMisses, 2);
+    CHECK_EQ(cache.GetStats().numEvictions, 1);
+    CHECK_EQ(cache.GetSize(), 1);
+
+    // The tier is a part of key
+    player3.currentTier = 4;
+    cache.Run(player1, player3, 20, 1);
+    CHECK_EQ(cache.GetStats().numMisses, 3);
+
+    const CombatCacheStats stats = cache.GetStats();
+    CHECK_EQ(stats.GetHitRate(), 0.25);
+
+    cache.Clear();
+    CHECK_EQ(cache.GetSize(), 0);
+}
@@ -0,0 +1,171 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Cards/Cards.hpp>
+#include <Rosetta/Battlegrounds/Games/Game.hpp>
+#include <Rosetta/Battlegrounds/Models/CombatSimulator.hpp>
+
+#include <effolkronium/random.hpp>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+using Random = effolkronium::random_thread_local;
+
+TEST_CASE("[CombatSimulator] - Player 2 always wins")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    Minion minion1(Cards::FindCardByDbfID(42467));
+    Minion minion2(Cards::FindCardByDbfID(60628));
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(59397));
+    player2.hero.Initialize(Cards::FindCardByDbfID(59397));
+    player1.recruitField.Add(minion1);
+    player2.recruitField.Add(minion2);
+    player2.currentTier = 3;
+
+    CombatSimulator simulator(2);
+    const CombatResult result = simulator.Run(player1, player2, 100, 42);
+
+    CHECK_EQ(result.numSamples, 100);
+    CHECK_EQ(result.numWins, 0);
+    CHECK_EQ(result.numTies, 0);
+    CHECK_EQ(result.numLosses, 100);
+    CHECK_EQ(result.GetLossProbability(), 1.0);
+    CHECK_EQ(result.GetAverageDamage(), -4.0);
+
+    REQUIRE_EQ(result.damageTaken.size(), 5);
+    CHECK_EQ(result.damageTaken[4], 100);
+    CHECK(result.damageDealt.empty());
+
+    // The players are not changed.
+    CHECK_EQ(player1.hero.health, 60);
+    CHECK_EQ(player2.hero.health, 60);
+    CHECK_EQ(player1.recruitField.GetCount(), 1);
+    CHECK_EQ(player2.recruitField.GetCount(), 1);
+    CHECK_EQ(player1.battleField.GetCount(), 0);
+    CHECK_EQ(player2.battleField.GetCount(), 0);
+}
+
+TEST_CASE("[CombatSimulator] - Deterministic with seed")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(59397));
+    player2.hero.Initialize(Cards::FindCardByDbfID(59397));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        Minion minion1(Cards::FindCardByDbfID(1915));
+        Minion minion2(Cards::FindCardByDbfID(49169));
+        player1.recruitField.Add(minion1);
+        player2.recruitField.Add(minion2);
+    }
+
+    CombatSimulator serialSimulator(1);
+    CombatSimulator parallelSimulator(4);
+
+    const CombatResult result1 =
+        serialSimulator.Run(player1, player2, 1000, 7);
+    const CombatResult result2 =
+        parallelSimulator.Run(player1, player2, 1000, 7);
+
+    CHECK_EQ(result1.numWins + result1.numTies + result1.numLosses, 1000);
+    CHECK_EQ(result1.numWins, result2.numWins);
+    CHECK_EQ(result1.numTies, result2.numTies);
+    CHECK_EQ(result1.numLosses, result2.numLosses);
+    CHECK(result1.damageDealt == result2.damageDealt);
+    CHECK(result1.damageTaken == result2.damageTaken);
+}
+
+TEST_CASE("[CombatSimulator] - Engine of the caller")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(59397));
+    player2.hero.Initialize(Cards::FindCardByDbfID(59397));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        Minion minion1(Cards::FindCardByDbfID(1915));
+        Minion minion2(Cards::FindCardByDbfID(49169));
+        player1.recruitField.Add(minion1);
+        player2.recruitField.Add(minion2);
+    }
+
+    // NOTE: With one thread and without the batch kernel, every battle runs
+    // on the calling thread.
+    CombatSimulator simulator(1);
+    simulator.SetBatchKernelEnabled(false);
+
+    Random::seed(5);
+    const auto expected = Random::get_engine()();
+
+    Random::seed(5);
+    simulator.Run(player1, player2, 100, 7);
+    simulator.Run(player1, player2, 100, 7, std::chrono::milliseconds(10));
+    CHECK_EQ(Random::get_engine()(), expected);
+}
+
+TEST_CASE("[CombatSimulator] - Time budget")
+{
+    Game game;
+    game.Start();
+
+    Player& player1 = game.GetGameState().players[0];
+    Player& player2 = game.GetGameState().players[1];
+
+    player1.hero.Initialize(Cards::FindCardByDbfID(59397));
+    player2.hero.Initialize(Cards::FindCardByDbfID(59397));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        Minion minion1(Cards::FindCardByDbfID(1915));
+        Minion minion2(Cards::FindCardByDbfID(49169));
+        player1.recruitField.Add(minion1);
+        player2.recruitField.Add(minion2);
+    }
+
+    CombatSimulator simulator(2);
+    simulator.SetBatchKernelEnabled(false);
+
+    // The budget runs out long before all battles are simulated.
+    const CombatResult result = simulator.Run(player1, player2, 1000000, 7,
+                                              std::chrono::microseconds(1000));
+    CHECK(result.numSamples > 0);
+    CHECK(result.numSamples < 1000000);
+    CHECK_EQ(result.numWins + result.numTies + result.numLosses,
+             result.numSamples);
+
+    // The battles that ran are the first battles of Run().
+    const CombatResult prefix =
+        simulator.Run(player1, player2, result.numSamples, 7);
+    CHECK_EQ(result.numWins, prefix.numWins);
+    CHECK_EQ(result.numTies, prefix.numTies);
+    CHECK_EQ(result.numLosses, prefix.numLosses);
+    CHECK(result.damageDealt == prefix.damageDealt);
+    CHECK(result.damageTaken == prefix.damageTaken);
+
+    // All battles run if the budget is large enough.
+    const CombatResult full = simulator.Run(player1, player2, 1000, 7,
+                                            std::chrono::seconds(60));
+    CHECK_EQ(full.numSamples, 1000);
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Battlegrounds/Models/MinionPool.hpp>
+
+#include <memory>
+
+using namespace RosettaStone;
+using namespace Battlegrounds;
+
+TEST_CASE("[MinionPool] - AddMinionsToTavern")
+{
+    // NOTE: The pool holds all minions by value, so it is too large to be on
+    // the stack.
+    auto pool = std::make_unique<MinionPool>();
+    pool->Initialize(Race::MURLOC);
+
+    const auto numPoolMinions = static_cast<int>(pool->GetCount());
+    CHECK_EQ(static_cast<int>(pool->GetMinions(1, 6, true).size()),
+             numPoolMinions);
+
+    Player player;
+    player.currentTier = 1;
+    pool->AddMinionsToTavern(player, player.tavern);
+
+    CHECK_EQ(player.tavern.fieldZone.GetCount(), 3);
+    CHECK_EQ(static_cast<int>(pool->GetMinions(1, 6, true).size()),
+             numPoolMinions - 3);
+
+    player.tavern.fieldZone.ForEach([](const MinionData& minion) {
+        CHECK_EQ(minion.value().GetTier(), 1);
+        CHECK(minion.value().GetRace() != Race::MURLOC);
+    });
+
+    Player player2;
+    player2.currentTier = 6;
+    pool->AddMinionsToTavern(player2, player2.tavern);
+
+    CHECK_EQ(player2.tavern.fieldZone.GetCount(), 6);
+    CHECK_EQ(static_cast<int>(pool->GetMinions(1, 6, true).size()),
+             numPoolMinions - 9);
+}
+
+TEST_CASE("[MinionPool] - ReturnMinion")
+{
+    auto pool = std::make_unique<MinionPool>();
+    pool->Initialize(Race::MURLOC);
+
+    const auto numPoolMinions = static_cast<int>(pool->GetCount());
+
+    Player player;
+    player.currentTier = 2;
+    pool->AddMinionsToTavern(player, player.tavern);
+    CHECK_EQ(static_cast<int>(pool->GetMinions(1, 2, true).size()),
+             static_cast<int>(pool->GetMinions(1, 2, false).size()) - 4);
+
+    const int poolIdx = player.tavern.fieldZone[0].GetPoolIndex();
+    pool->ReturnMinion(poolIdx);
+    CHECK_EQ(static_cast<int>(pool->GetMinions(1, 6, true).size()),
+             numPoolMinions - 3);
+
+    // Returning a minion that is already in the pool does nothing
+    pool->ReturnMinion(poolIdx);
+    pool->ReturnMinion(-1);
+    pool->ReturnMinion(NUM_TOTAL_TAVERN_MINIONS);
+    CHECK_EQ(static_cast<int>(pool->GetMinions(1, 6, true).size()),
+             numPoolMinions - 3);
+
+    for (int i = 1; i < player.tavern.fieldZone.GetCount(); ++i)
+    {
+        pool->ReturnMinion(player.tavern.fieldZone[i].GetPoolIndex());
+    }
+    CHECK_EQ(static_cast<int>(pool->GetMinions(1, 6, true).size()),
+             numPoolMinions);
+}
+
+TEST_CASE("[MinionPool] - Initialize")
+{
+    auto pool = std::make_unique<MinionPool>();
+
+    // NOTE: A race is always excluded, so the pool never fills all slots,
+    // and the slots after the last minion must not be read.
+    for (const Race race : RACES_IN_BATTLEGROUNDS)
+    {
+        pool->Initialize(race);
+
+        const auto minions = pool->GetMinions(1, 6, false);
+        CHECK_EQ(minions.size(), pool->GetCount());
+        CHECK(pool->GetCount() < NUM_TOTAL_TAVERN_MINIONS);
+
+        for (const auto& minion : minions)
+        {
+            CHECK(minion.GetRace() != race);
+        }
+    }
+}
@@ -0,0 +1,122 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Common/StartupProfiler.hpp>
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace RosettaStone;
+
+TEST_CASE("[StartupProfiler] - Card loading phases")
+{
+    // NOTE: Cards are loaded in main() before running tests.
+    const auto playMode = StartupProfiler::FindPhase("PlayMode::Cards");
+    CHECK_EQ(playMode.numCalls, 1u);
+    CHECK_EQ(playMode.depth, 0u);
+    CHECK(playMode.elapsedMs > 0.0);
+    CHECK_EQ(playMode.numAllocations > 0,
+             StartupProfiler::IsCountingAllocations());
+
+    const auto jsonParse = StartupProfiler::FindPhase(
+        "PlayMode::Cards/CardLoader::Load/JSON parse");
+    CHECK_EQ(jsonParse.numCalls, 1u);
+    CHECK_EQ(jsonParse.depth, 2u);
+    CHECK(jsonParse.elapsedMs <= playMode.elapsedMs);
+
+    const auto convert = StartupProfiler::FindPhase(
+        "PlayMode::Cards/CardLoader::Load/Convert cards");
+    CHECK_EQ(convert.numCalls, 1u);
+    CHECK_EQ(convert.depth, 2u);
+
+    CHECK_EQ(StartupProfiler::FindPhase("PlayMode::Cards/InternalCardLoader::"
+                                        "Load/CardDefs")
+                 .numCalls, 1u);
+    CHECK_EQ(StartupProfiler::FindPhase("Battlegrounds::Cards").numCalls, 1u);
+    CHECK_EQ(
+        StartupProfiler::FindPhase("Battlegrounds::Cards/CardLoader::Load")
+            .numCalls, 1u);
+}
+
+TEST_CASE("[StartupProfiler] - ScopedPhase")
+{
+    std::vector<std::unique_ptr<int>> values;
+
+    {
+        StartupProfiler::ScopedPhase phase("Test");
+
+        for (int i = 0; i < 3; ++i)
+        {
+            StartupProfiler::ScopedPhase nestedPhase("Nested");
+            values.emplace_back(std::make_unique<int>(i));
+        }
+    }
+
+    const auto phase = StartupProfiler::FindPhase("Test");
+    CHECK_EQ(phase.numCalls, 1u);
+    CHECK_EQ(phase.depth, 0u);
+
+    const auto nestedPhase = StartupProfiler::FindPhase("Test/Nested");
+    CHECK_EQ(nestedPhase.numCalls, 3u);
+    CHECK_EQ(nestedPhase.depth, 1u);
+    CHECK(phase.numAllocations >= nestedPhase.numAllocations);
+
+    if (StartupProfiler::IsCountingAllocations())
+    {
+        CHECK(nestedPhase.numAllocations >= 3);
+        CHECK(nestedPhase.allocatedBytes >= 3 * sizeof(int));
+    }
+    else
+    {
+        CHECK_EQ(phase.numAllocations, 0u);
+        CHECK_EQ(phase.allocatedBytes, 0u);
+    }
+
+    CHECK_EQ(values.size(), 3u);
+    CHECK(StartupProfiler::ToString().find("Nested") != std::string::npos);
+    CHECK(StartupProfiler::FindPhase("Unknown").name.empty());
+}
+
+TEST_CASE("[StartupProfiler] - WorkerAllocations")
+{
+    ThreadPool pool(4);
+    std::vector<std::unique_ptr<int>> values(100);
+
+    {
+        StartupProfiler::ScopedPhase phase("Workers");
+        StartupProfiler::WorkerAllocations workerAllocations;
+
+        pool.ParallelFor(values.size(), [&](std::size_t idx) {
+            workerAllocations.Run([&] {
+                values[idx] = std::make_unique<int>(static_cast<int>(idx));
+            });
+        });
+
+        workerAllocations.AddToCurrentThread();
+    }
+
+    const auto phase = StartupProfiler::FindPhase("Workers");
+    CHECK_EQ(phase.numCalls, 1u);
+
+    if (StartupProfiler::IsCountingAllocations())
+    {
+        CHECK(phase.numAllocations >= values.size());
+        CHECK(phase.allocatedBytes >= values.size() * sizeof(int));
+    }
+    else
+    {
+        CHECK_EQ(phase.numAllocations, 0u);
+        CHECK_EQ(phase.allocatedBytes, 0u);
+    }
+
+    // The allocation columns are shown only if allocations are counted.
+    CHECK_EQ(
+        StartupProfiler::ToString().find("Allocations") != std::string::npos,
+        StartupProfiler::IsCountingAllocations());
+}
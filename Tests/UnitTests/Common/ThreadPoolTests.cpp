@@ -0,0 +1,69 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Common/ThreadPool.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+
+TEST_CASE("[ThreadPool] - Enqueue")
+{
+    ThreadPool pool(4);
+    CHECK_EQ(pool.GetNumThreads(), 4u);
+
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 100; ++i)
+    {
+        futures.emplace_back(pool.Enqueue([i]() { return i * i; }));
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        CHECK_EQ(futures[i].get(), i * i);
+    }
+
+    auto future =
+        pool.Enqueue([]() -> int { throw std::runtime_error("Error"); });
+    CHECK_THROWS_AS(future.get(), std::runtime_error);
+}
+
+TEST_CASE("[ThreadPool] - ParallelFor")
+{
+    ThreadPool pool(3);
+
+    std::vector<int> values(1000, 0);
+    std::atomic<int> numCalls{ 0 };
+
+    pool.ParallelFor(values.size(), [&](std::size_t idx) {
+        values[idx] = static_cast<int>(idx) * 2;
+        ++numCalls;
+    });
+
+    CHECK_EQ(numCalls.load(), 1000);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        CHECK_EQ(values[i], static_cast<int>(i) * 2);
+    }
+
+    pool.ParallelFor(0, [&](std::size_t) { ++numCalls; });
+    CHECK_EQ(numCalls.load(), 1000);
+
+    CHECK_THROWS_AS(pool.ParallelFor(10,
+                                     [](std::size_t idx) {
+                                         if (idx == 7)
+                                         {
+                                             throw std::out_of_range("Error");
+                                         }
+                                     }),
+                    std::out_of_range);
+
+    CHECK_GE(ThreadPool(0).GetNumThreads(), 1u);
+}
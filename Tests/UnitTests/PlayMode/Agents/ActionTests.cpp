@@ -0,0 +1,147 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Utils/TestUtils.hpp>
+
+#include <Rosetta/PlayMode/Agents/Action.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/EndTurnTask.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <algorithm>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+using namespace PlayerTasks;
+using namespace TestUtils;
+
+namespace
+{
+//! Returns true if \p actions contain \p action.
+bool Contains(const std::vector<Action>& actions, const Action& action)
+{
+    return std::find(actions.begin(), actions.end(), action) !=
+           actions.end();
+}
+}  // namespace
+
+TEST_CASE("[Action] - GetCharacter")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    auto& curField = *(curPlayer->GetFieldZone());
+    auto& opField = *(opPlayer->GetFieldZone());
+
+    auto card1 = GenerateMinionCard("minion1", 3, 6);
+    auto card2 = GenerateMinionCard("minion2", 5, 4);
+    PlayMinionCard(curPlayer, &card1);
+    PlayMinionCard(curPlayer, &card1);
+    PlayMinionCard(opPlayer, &card2);
+
+    CHECK_EQ(GetCharacter(curPlayer, 0), curPlayer->GetHero());
+    CHECK_EQ(GetCharacter(curPlayer, 1), curField[0]);
+    CHECK_EQ(GetCharacter(curPlayer, 2), curField[1]);
+    CHECK_EQ(GetCharacter(curPlayer, 3), nullptr);
+    CHECK_EQ(GetCharacter(curPlayer, 8), opPlayer->GetHero());
+    CHECK_EQ(GetCharacter(curPlayer, 9), opField[0]);
+    CHECK_EQ(GetCharacter(curPlayer, 10), nullptr);
+    CHECK_EQ(GetCharacter(curPlayer, -1), nullptr);
+    CHECK_EQ(GetCharacter(curPlayer, NUM_CHARACTERS), nullptr);
+    CHECK_EQ(GetCharacter(opPlayer, 9), curField[0]);
+
+    for (int charIdx : { 0, 1, 2, 8, 9 })
+    {
+        CHECK_EQ(
+            GetCharacterIndex(curPlayer, GetCharacter(curPlayer, charIdx)),
+            charIdx);
+    }
+}
+
+TEST_CASE("[Action] - GetLegalActions and ApplyAction")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    auto& curField = *(curPlayer->GetFieldZone());
+    auto& opField = *(opPlayer->GetFieldZone());
+
+    auto card1 = GenerateMinionCard("minion1", 3, 6);
+    auto card2 = GenerateMinionCard("minion2", 5, 4);
+
+    const Action attackHero{ ActionType::ATTACK, 1, 8 };
+    const Action attackMinion{ ActionType::ATTACK, 1, 9 };
+    const Action heroAttack{ ActionType::ATTACK, 0, 8 };
+    const Action heroPower{ ActionType::HERO_POWER };
+
+    // A minion can't attack in the turn it is played.
+    PlayMinionCard(curPlayer, &card1);
+    auto actions = GetLegalActions(game);
+    CHECK_EQ(actions.back(), Action{});
+    CHECK_FALSE(Contains(actions, attackHero));
+
+    game.Process(curPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    PlayMinionCard(opPlayer, &card2);
+
+    game.Process(opPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    actions = GetLegalActions(game);
+    CHECK(Contains(actions, attackHero));
+    CHECK(Contains(actions, attackMinion));
+    CHECK_FALSE(Contains(actions, heroAttack));
+    CHECK(Contains(actions, heroPower));
+
+    for (const auto& action : actions)
+    {
+        if (action.type == ActionType::PLAY_CARD)
+        {
+            CHECK((*curPlayer->GetHandZone())[action.index]
+                      ->IsPlayableByPlayer());
+        }
+    }
+
+    ApplyAction(game, attackMinion);
+    CHECK_EQ(curField[0]->GetHealth(), 1);
+    CHECK_EQ(opField[0]->GetHealth(), 1);
+
+    // The minion is exhausted after attack.
+    actions = GetLegalActions(game);
+    CHECK_FALSE(Contains(actions, attackHero));
+
+    const Action noAttacker{ ActionType::ATTACK, 2, 8 };
+    const Action noCard{ ActionType::PLAY_CARD, 10 };
+    const Action noChoice{ ActionType::CHOOSE, 0 };
+    CHECK_THROWS(ApplyAction(game, noAttacker));
+    CHECK_THROWS(ApplyAction(game, noCard));
+    CHECK_THROWS(ApplyAction(game, noChoice));
+}
@@ -46,8 +46,10 @@ TEST_CASE("[RandomAgent] - GetActionForMulligan")
     CHECK_GE(p2Choices.size(), 3);
     CHECK_LE(p2Choices.size(), 4);
 
-    const std::vector<int> indices1 = agent1->GetActionForMulligan(game);
-    const std::vector<int> indices2 = agent2->GetActionForMulligan(game);
+    const std::vector<int> indices1 =
+        agent1->GetActionForMulligan(ObservationView(*player1));
+    const std::vector<int> indices2 =
+        agent2->GetActionForMulligan(ObservationView(*player2));
     CHECK_GE(indices1.size(), 0);
     CHECK_LE(indices1.size(), 4);
     CHECK_GE(indices2.size(), 0);
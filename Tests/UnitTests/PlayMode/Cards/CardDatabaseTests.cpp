@@ -0,0 +1,133 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Loaders/CardImage.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/HeroPowerTask.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+
+#include <cstdio>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[CardDatabase] - Load with base")
+{
+    const CardDatabase& base = Cards::GetDatabase();
+
+    CardDatabase database;
+    database.Load(RESOURCES_DIR "cards.json", &base);
+
+    CHECK_EQ(database.GetAllCards().size(), base.GetAllCards().size());
+    CHECK_EQ(database.GetNumSharedCards(), base.GetAllCards().size());
+
+    // Unchanged records are shared with the base database.
+    const Card* card = base.FindCardByID("CS2_106");
+    CHECK_EQ(database.FindCardByID("CS2_106"), card);
+    CHECK_EQ(database.FindCardByDbfID(card->dbfID), card);
+    CHECK_EQ(database.GetAllStandardCards().size(),
+             base.GetAllStandardCards().size());
+}
+
+TEST_CASE("[CardDatabase] - FindCardByID")
+{
+    const CardDatabase& database = Cards::GetDatabase();
+
+    const Card* card = database.FindCardByID("CS2_106");
+    CHECK_EQ(card->id, "CS2_106");
+    CHECK_EQ(database.FindCardByDbfID(card->dbfID), card);
+
+    CHECK(database.FindCardByID("INVALID_ID")->id.empty());
+    CHECK(database.FindCardByDbfID(-1)->id.empty());
+}
+
+TEST_CASE("[CardDatabase] - GameConfig")
+{
+    CardDatabase database;
+    database.Load(RESOURCES_DIR "cards.json", &Cards::GetDatabase());
+
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::ROGUE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    const Game defaultGame{ config };
+    CHECK_EQ(&defaultGame.GetCardDatabase(), &Cards::GetDatabase());
+
+    config.cardDatabase = &database;
+
+    const Game game{ config };
+    CHECK_EQ(&game.GetCardDatabase(), &database);
+}
+
+TEST_CASE("[CardDatabase] - Powers use the cards of the game")
+{
+    const CardDatabase& base = Cards::GetDatabase();
+    const Card* baseRecruit = base.FindCardByID("CS2_101t");
+
+    // A database whose Silver Hand Recruit is a 5/1.
+    Card recruit;
+    recruit.id = baseRecruit->id;
+    recruit.dbfID = baseRecruit->dbfID;
+    recruit.name = baseRecruit->name;
+    recruit.text = baseRecruit->text;
+    recruit.gameTags = baseRecruit->gameTags;
+    recruit.gameTags[GameTag::ATK] = 5;
+
+    std::vector<Card*> cards = base.GetAllCards();
+    for (Card*& card : cards)
+    {
+        if (card->id == recruit.id)
+        {
+            card = &recruit;
+        }
+    }
+
+    const std::string path = "CardDatabaseTests.bin";
+    CardImage::Save(cards, path);
+
+    CardImage image;
+    image.Open(path);
+
+    CardDatabase database;
+    database.Load(image, &base);
+    CHECK_EQ(database.GetNumSharedCards(), cards.size() - 1);
+
+    Card* newRecruit = database.FindCardByID("CS2_101t");
+    CHECK_NE(newRecruit, baseRecruit);
+
+    GameConfig config;
+    config.player1Class = CardClass::PALADIN;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+    config.cardDatabase = &database;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    auto& curField = *(curPlayer->GetFieldZone());
+
+    // HERO_04bp summons "CS2_101t" with a SummonTask created by CardDefs.
+    game.Process(curPlayer, PlayerTasks::HeroPowerTask());
+    REQUIRE_EQ(curField.GetCount(), 1);
+    CHECK_EQ(curField[0]->card, newRecruit);
+    CHECK_EQ(curField[0]->GetAttack(), 5);
+
+    image.Close();
+    std::remove(path.c_str());
+}
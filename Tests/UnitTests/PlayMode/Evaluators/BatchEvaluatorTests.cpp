@@ -0,0 +1,132 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Evaluators/BatchEvaluator.hpp>
+#include <Rosetta/PlayMode/Evaluators/StubModel.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+constexpr std::size_t INPUT_SIZE = 8;
+constexpr std::size_t OUTPUT_SIZE = 3;
+}  // namespace
+
+TEST_CASE("[BatchEvaluator] - Submit")
+{
+    constexpr std::size_t NUM_THREADS = 4;
+    constexpr std::size_t NUM_STATES = 100;
+    constexpr std::size_t NUM_IN_FLIGHT = 8;
+    constexpr std::size_t MAX_BATCH_SIZE = 16;
+
+    const StubModel model(INPUT_SIZE, OUTPUT_SIZE);
+    std::atomic<std::size_t> maxBatchSize{ 0 };
+
+    BatchEvaluator evaluator(
+        INPUT_SIZE, OUTPUT_SIZE, MAX_BATCH_SIZE, std::chrono::microseconds(500),
+        [&](std::size_t batchSize, const float* inputs, float* outputs) {
+            maxBatchSize = std::max(maxBatchSize.load(), batchSize);
+            model(batchSize, inputs, outputs);
+        });
+
+    std::vector<std::vector<float>> inputs(NUM_THREADS);
+    std::vector<std::vector<float>> outputs(NUM_THREADS);
+    std::vector<std::thread> threads;
+
+    for (std::size_t t = 0; t < NUM_THREADS; ++t)
+    {
+        inputs[t].resize(NUM_STATES * INPUT_SIZE);
+        outputs[t].resize(NUM_STATES * OUTPUT_SIZE);
+        for (std::size_t i = 0; i < inputs[t].size(); ++i)
+        {
+            inputs[t][i] = static_cast<float>((t * 31 + i) % 17);
+        }
+
+        threads.emplace_back([&, t]() {
+            std::vector<std::future<void>> futures;
+
+            for (std::size_t i = 0; i < NUM_STATES; ++i)
+            {
+                futures.emplace_back(
+                    evaluator.Submit(&inputs[t][i * INPUT_SIZE],
+                                     &outputs[t][i * OUTPUT_SIZE]));
+
+                if (futures.size() == NUM_IN_FLIGHT || i + 1 == NUM_STATES)
+                {
+                    for (auto& future : futures)
+                    {
+                        future.get();
+                    }
+                    futures.clear();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (std::size_t t = 0; t < NUM_THREADS; ++t)
+    {
+        std::vector<float> expected(outputs[t].size());
+        model(NUM_STATES, inputs[t].data(), expected.data());
+        CHECK(outputs[t] == expected);
+    }
+
+    CHECK_EQ(evaluator.GetNumEvaluations(), NUM_THREADS * NUM_STATES);
+    CHECK(evaluator.GetNumBatches() <= NUM_THREADS * NUM_STATES);
+    CHECK(maxBatchSize <= MAX_BATCH_SIZE);
+}
+
+TEST_CASE("[BatchEvaluator] - Deadline")
+{
+    BatchEvaluator evaluator(INPUT_SIZE, OUTPUT_SIZE, 64,
+                             std::chrono::microseconds(1000),
+                             StubModel(INPUT_SIZE, OUTPUT_SIZE));
+
+    const std::vector<float> input(INPUT_SIZE, 1.0f);
+    std::vector<float> output(OUTPUT_SIZE, -1.0f);
+
+    // NOTE: The batch never fills, so the state is evaluated at the deadline.
+    evaluator.Evaluate(input.data(), output.data());
+
+    std::vector<float> expected(OUTPUT_SIZE);
+    StubModel(INPUT_SIZE, OUTPUT_SIZE)(1, input.data(), expected.data());
+    CHECK(output == expected);
+    CHECK_EQ(evaluator.GetNumBatches(), 1u);
+    CHECK_EQ(evaluator.GetNumEvaluations(), 1u);
+}
+
+TEST_CASE("[BatchEvaluator] - Error")
+{
+    BatchEvaluator evaluator(
+        INPUT_SIZE, OUTPUT_SIZE, 4, std::chrono::microseconds(100),
+        [](std::size_t, const float*, float*) {
+            throw std::runtime_error("Evaluation failed");
+        });
+
+    const std::vector<float> input(INPUT_SIZE, 0.0f);
+    std::vector<float> output(OUTPUT_SIZE);
+
+    auto future = evaluator.Submit(input.data(), output.data());
+    CHECK_THROWS_AS(future.get(), std::runtime_error);
+    CHECK_EQ(evaluator.GetNumEvaluations(), 0u);
+
+    CHECK_THROWS_AS(BatchEvaluator(INPUT_SIZE, OUTPUT_SIZE, 0,
+                                   std::chrono::microseconds(100),
+                                   StubModel(INPUT_SIZE, OUTPUT_SIZE)),
+                    std::invalid_argument);
+}
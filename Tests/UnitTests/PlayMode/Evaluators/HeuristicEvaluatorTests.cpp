@@ -0,0 +1,205 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Utils/TestUtils.hpp>
+
+#include <Rosetta/PlayMode/Evaluators/HeuristicEvaluator.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+using namespace TestUtils;
+
+namespace
+{
+using Encoder = ObservationEncoder;
+
+constexpr std::size_t HERO_HEALTH = Encoder::BLOCK_HERO_OFFSET + 1;
+
+//! Returns an observation in which both heroes have 30 health and the
+//! player has the turn.
+std::vector<float> MakeObservation()
+{
+    std::vector<float> observation(Encoder::NUM_FEATURES, 0.0f);
+    observation[Encoder::PLAYER_OFFSET + 8] = 1.0f;
+    observation[Encoder::PLAYER_OFFSET + HERO_HEALTH] = 30.0f;
+    observation[Encoder::OPPONENT_OFFSET + HERO_HEALTH] = 30.0f;
+
+    return observation;
+}
+
+//! Returns the minion at \p slot of the block at \p blockOffset.
+float* GetMinion(std::vector<float>& observation, std::size_t blockOffset,
+                 std::size_t slot)
+{
+    return &observation[blockOffset + Encoder::BLOCK_FIELD_OFFSET +
+                        slot * Encoder::NUM_MINION_FEATURES];
+}
+
+//! Writes a minion with given \p attack and \p health.
+void SetMinion(float* minion, float attack, float health)
+{
+    minion[0] = 1.0f;
+    minion[2] = attack;
+    minion[3] = health;
+    minion[4] = health;
+}
+}  // namespace
+
+TEST_CASE("[HeuristicEvaluator] - Material")
+{
+    const HeuristicEvaluator evaluator;
+
+    auto observation = MakeObservation();
+    CHECK_EQ(evaluator.Evaluate(observation.data()), 0.0f);
+
+    // 1 (minion) + 3 (attack) + 2 (health) + 1.5 (divine shield)
+    float* minion = GetMinion(observation, Encoder::PLAYER_OFFSET, 0);
+    SetMinion(minion, 3.0f, 2.0f);
+    minion[9] = 1.0f;
+    CHECK_EQ(evaluator.Evaluate(observation.data()), 7.5f);
+
+    // The same minion of the opponent cancels it out.
+    float* enemyMinion = GetMinion(observation, Encoder::OPPONENT_OFFSET, 3);
+    SetMinion(enemyMinion, 3.0f, 2.0f);
+    enemyMinion[9] = 1.0f;
+    CHECK_EQ(evaluator.Evaluate(observation.data()), 0.0f);
+
+    observation[Encoder::OPPONENT_OFFSET + HERO_HEALTH] = 25.0f;
+    CHECK_EQ(evaluator.Evaluate(observation.data()), 5.0f);
+}
+
+TEST_CASE("[HeuristicEvaluator] - Lethal")
+{
+    const HeuristicEvaluator evaluator;
+
+    auto observation = MakeObservation();
+    observation[Encoder::OPPONENT_OFFSET + HERO_HEALTH] = 8.0f;
+
+    float* minion = GetMinion(observation, Encoder::PLAYER_OFFSET, 0);
+    SetMinion(minion, 4.0f, 4.0f);
+    const float value = evaluator.Evaluate(observation.data());
+
+    // A minion with windfury that can attack deals 8 damage.
+    minion[7] = 1.0f;
+    minion[12] = 1.0f;
+    CHECK_EQ(evaluator.Evaluate(observation.data()), value + 0.5f + 100.0f);
+
+    // A taunt minion of the opponent blocks lethal.
+    SetMinion(GetMinion(observation, Encoder::OPPONENT_OFFSET, 0), 0.0f, 1.0f);
+    GetMinion(observation, Encoder::OPPONENT_OFFSET, 0)[8] = 1.0f;
+    CHECK_EQ(evaluator.Evaluate(observation.data()), value + 0.5f - 3.0f);
+}
+
+TEST_CASE("[HeuristicEvaluator] - Lethal Threat")
+{
+    const HeuristicEvaluator evaluator;
+
+    auto observation = MakeObservation();
+    observation[Encoder::PLAYER_OFFSET + HERO_HEALTH] = 5.0f;
+
+    float* enemyMinion = GetMinion(observation, Encoder::OPPONENT_OFFSET, 0);
+    SetMinion(enemyMinion, 6.0f, 6.0f);
+    CHECK_EQ(evaluator.Evaluate(observation.data()), -25.0f - 13.0f - 50.0f);
+
+    // A frozen minion can't attack next turn.
+    enemyMinion[16] = 1.0f;
+    CHECK_EQ(evaluator.Evaluate(observation.data()), -25.0f - 13.0f + 1.0f);
+}
+
+TEST_CASE("[HeuristicEvaluator] - Win")
+{
+    const HeuristicEvaluator evaluator;
+
+    auto observation = MakeObservation();
+    observation[Encoder::OPPONENT_OFFSET + HERO_HEALTH] = 0.0f;
+    CHECK_EQ(evaluator.Evaluate(observation.data()), 10000.0f);
+
+    observation[Encoder::OPPONENT_OFFSET + HERO_HEALTH] = 30.0f;
+    observation[Encoder::PLAYER_OFFSET + HERO_HEALTH] = -2.0f;
+    CHECK_EQ(evaluator.Evaluate(observation.data()), -10000.0f);
+
+    observation[Encoder::OPPONENT_OFFSET + HERO_HEALTH] = 0.0f;
+    CHECK_EQ(evaluator.Evaluate(observation.data()), 0.0f);
+}
+
+TEST_CASE("[HeuristicEvaluator] - Load")
+{
+    const std::string path = "HeuristicEvaluatorTests.json";
+
+    {
+        std::ofstream file(path);
+        file << R"({ "hero_health": 2.0, "divine_shield": 0, "win": 1 })";
+    }
+
+    const HeuristicWeights weights = HeuristicWeights::Load(path);
+    CHECK_EQ(weights.heroHealth, 2.0f);
+    CHECK_EQ(weights.divineShield, 0.0f);
+    CHECK_EQ(weights.win, 1.0f);
+    CHECK_EQ(weights.taunt, HeuristicWeights{}.taunt);
+
+    const HeuristicEvaluator evaluator(weights);
+    auto observation = MakeObservation();
+    observation[Encoder::OPPONENT_OFFSET + HERO_HEALTH] = 25.0f;
+    CHECK_EQ(evaluator.Evaluate(observation.data()), 10.0f);
+
+    {
+        std::ofstream file(path);
+        file << R"({ "hero_heatlh": 2.0 })";
+    }
+    CHECK_THROWS_AS(HeuristicWeights::Load(path), std::runtime_error);
+
+    {
+        std::ofstream file(path);
+        file << R"({ "taunt": "high" })";
+    }
+    CHECK_THROWS_AS(HeuristicWeights::Load(path), std::runtime_error);
+
+    std::remove(path.c_str());
+    CHECK_THROWS_AS(HeuristicWeights::Load(path), std::runtime_error);
+}
+
+TEST_CASE("[HeuristicEvaluator] - Player")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+
+    auto card1 = GenerateMinionCard("minion1", 3, 6);
+    auto card2 = GenerateMinionCard("minion2", 5, 4);
+    PlayMinionCard(curPlayer, &card1);
+    PlayMinionCard(opPlayer, &card2);
+
+    const HeuristicEvaluator evaluator;
+    std::vector<float> observations(2 * Encoder::NUM_FEATURES);
+    Encoder::Encode(*curPlayer, &observations[0]);
+    Encoder::Encode(*opPlayer, &observations[Encoder::NUM_FEATURES]);
+
+    std::vector<float> values(2);
+    evaluator.EvaluateBatch(2, observations.data(), values.data());
+
+    CHECK_EQ(values[0], evaluator.Evaluate(*curPlayer));
+    CHECK_EQ(values[1], evaluator.Evaluate(*opPlayer));
+    CHECK_EQ(values[0], evaluator.Evaluate(&observations[0]));
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Determinizer.hpp>
+#include <Rosetta/PlayMode/Games/GameRecorder.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/FieldZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <effolkronium/random.hpp>
+
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+using Random = effolkronium::random_thread_local;
+
+namespace
+{
+//! Plays a game of random actions and returns its record.
+GameRecord PlayGame(unsigned int seed, std::size_t maxActions)
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::HUNTER;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+
+    GameRecorder recorder(config, seed);
+    Game& game = recorder.GetGame();
+
+    for (std::size_t i = 0; i < maxActions && game.state != State::COMPLETE;
+         ++i)
+    {
+        const auto legalActions = GetLegalActions(game);
+        recorder.Apply(*Random::get(legalActions));
+    }
+
+    return recorder.GetRecord();
+}
+
+//! Returns the sorted dbfIDs of the cards in the deck of \p player.
+std::vector<int> GetDeckCards(const Player* player)
+{
+    std::vector<int> dbfIDs;
+    player->GetDeckZone()->ForEach([&](const Playable* playable) {
+        dbfIDs.emplace_back(playable->card->dbfID);
+    });
+    std::sort(dbfIDs.begin(), dbfIDs.end());
+
+    return dbfIDs;
+}
+}  // namespace
+
+TEST_CASE("[Determinizer] - Sample")
+{
+    const GameRecord record = PlayGame(3, 30);
+    const auto game = Game::Replay(record);
+
+    Card* wisp = Cards::FindCardByName("Wisp");
+    const std::vector<Card*> cardPool =
+        Cards::GetDatabase().GetDiscoverCards(CardClass::HUNTER,
+                                              FormatType::STANDARD);
+
+    SUBCASE("Deck prior")
+    {
+        const Determinizer determinizer(
+            PlayerType::PLAYER1, std::vector<Card*>(START_DECK_SIZE, wisp),
+            cardPool);
+        const auto sample = determinizer.Sample(record, 1);
+
+        CHECK_EQ(determinizer.Sample(record, 1)->GetStateHash(),
+                 sample->GetStateHash());
+
+        Player* player = sample->GetPlayer1();
+        Player* opponent = sample->GetPlayer2();
+
+        // The player knows the own hand and the cards of the own deck.
+        auto& hand = *player->GetHandZone();
+        auto& origHand = *game->GetPlayer1()->GetHandZone();
+        REQUIRE_EQ(hand.GetCount(), origHand.GetCount());
+        for (int i = 0; i < hand.GetCount(); ++i)
+        {
+            CHECK_EQ(hand[i]->card, origHand[i]->card);
+        }
+        CHECK(GetDeckCards(player) == GetDeckCards(game->GetPlayer1()));
+
+        // The opponent hasn't played a wisp, so every hidden card is a wisp.
+        CHECK_EQ(opponent->GetHandZone()->GetCount(),
+                 game->GetPlayer2()->GetHandZone()->GetCount());
+        CHECK_EQ(opponent->GetDeckZone()->GetCount(),
+                 game->GetPlayer2()->GetDeckZone()->GetCount());
+        CHECK_EQ(opponent->GetFieldZone()->GetCount(),
+                 game->GetPlayer2()->GetFieldZone()->GetCount());
+
+        opponent->GetHandZone()->ForEach([&](const Playable* playable) {
+            if (playable->GetGameTag(GameTag::REVEALED) == 1)
+            {
+                CHECK_NE(playable->card, wisp);
+            }
+            else
+            {
+                CHECK_EQ(playable->card, wisp);
+            }
+        });
+        opponent->GetDeckZone()->ForEach(
+            [&](const Playable* playable) { CHECK_EQ(playable->card, wisp); });
+    }
+
+    SUBCASE("Card pool")
+    {
+        const Determinizer determinizer(PlayerType::PLAYER1, {}, cardPool);
+        const auto sample = determinizer.Sample(record, 2);
+
+        std::set<int> pool;
+        for (const Card* card : cardPool)
+        {
+            pool.emplace(card->dbfID);
+        }
+
+        Player* opponent = sample->GetPlayer2();
+        opponent->GetHandZone()->ForEach([&](const Playable* playable) {
+            if (playable->GetGameTag(GameTag::REVEALED) != 1)
+            {
+                CHECK_EQ(pool.count(playable->card->dbfID), 1u);
+            }
+        });
+        opponent->GetDeckZone()->ForEach([&](const Playable* playable) {
+            CHECK_EQ(pool.count(playable->card->dbfID), 1u);
+        });
+    }
+
+    SUBCASE("Engine of the caller")
+    {
+        const Determinizer determinizer(PlayerType::PLAYER1, {}, cardPool);
+
+        Random::seed(5);
+        const auto expected = Random::get_engine()();
+
+        // Sample() doesn't change the state of the engine of the caller.
+        Random::seed(5);
+        const auto sample = determinizer.Sample(record, 1);
+        CHECK_EQ(Random::get_engine()(), expected);
+    }
+
+    SUBCASE("Invalid arguments")
+    {
+        CHECK_THROWS_AS(Determinizer(PlayerType::RANDOM, {}, cardPool),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(Determinizer(PlayerType::PLAYER1, {}, {}),
+                        std::invalid_argument);
+    }
+}
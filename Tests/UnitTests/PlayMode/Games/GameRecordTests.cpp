@@ -0,0 +1,178 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/GameRecorder.hpp>
+#include <Rosetta/PlayMode/Models/HeroPower.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+
+#include <effolkronium/random.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+using Random = effolkronium::random_thread_local;
+
+namespace
+{
+//! Returns the configuration of games in tests.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::HUNTER;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doFillDecks = true;
+
+    return config;
+}
+
+//! Plays a game of random actions and returns its record. Actions are
+//! chosen with the engine of the game, so the game is only reproducible if
+//! the engine is reseeded before each action.
+GameRecord PlayGame(unsigned int seed, std::size_t maxActions)
+{
+    GameRecorder recorder(MakeConfig(), seed);
+    Game& game = recorder.GetGame();
+
+    for (std::size_t i = 0; i < maxActions && game.state != State::COMPLETE;
+         ++i)
+    {
+        const auto legalActions = GetLegalActions(game);
+        recorder.Apply(*Random::get(legalActions));
+    }
+
+    return recorder.GetRecord();
+}
+}  // namespace
+
+TEST_CASE("[GameRecord] - Encode and decode")
+{
+    GameConfig config = MakeConfig();
+    config.player1Deck[3] = Cards::FindCardByName("Fireball");
+    config.player1Deck[7] = Cards::FindCardByName("Frostbolt");
+
+    GameRecorder recorder(config, 7);
+    recorder.Apply(Action{});
+    const GameRecord record = recorder.GetRecord();
+
+    std::vector<char> encoded;
+    GameRecordFile::Encode(record, encoded);
+
+    GameRecord decoded;
+    GameRecordFile::Decode(encoded.data(), encoded.size(), nullptr, decoded);
+
+    CHECK_EQ(decoded.cardDatabaseVersion, Cards::GetDatabase().GetVersion());
+    CHECK_EQ(decoded.seed, 7u);
+    CHECK_EQ(decoded.gameConfig.player1Class, CardClass::MAGE);
+    CHECK_EQ(decoded.gameConfig.player2Class, CardClass::HUNTER);
+    CHECK_EQ(decoded.gameConfig.startPlayer, PlayerType::RANDOM);
+    CHECK(decoded.gameConfig.doFillDecks);
+    CHECK(decoded.gameConfig.autoRun);
+    CHECK_EQ(decoded.gameConfig.player1Deck[0],
+             Cards::FindCardByName("Fireball"));
+    CHECK_EQ(decoded.gameConfig.player1Deck[1],
+             Cards::FindCardByName("Frostbolt"));
+    CHECK_EQ(decoded.gameConfig.player1Deck[2], nullptr);
+    CHECK(decoded.gameConfig.fillCardIDs == config.fillCardIDs);
+    CHECK(decoded.actions == record.actions);
+    CHECK_EQ(decoded.stateHash, record.stateHash);
+
+    encoded.pop_back();
+    CHECK_THROWS_AS(GameRecordFile::Decode(encoded.data(), encoded.size(),
+                                           nullptr, decoded),
+                    std::runtime_error);
+}
+
+TEST_CASE("[GameRecord] - Replay")
+{
+    const GameRecord record = PlayGame(11, 300);
+    REQUIRE(!record.actions.empty());
+
+    // NOTE: The engine is used between the actions of the recorded game, so
+    // the replay only matches if the record reseeds the engine.
+    Random::seed(12345);
+    const auto expected = Random::get_engine()();
+
+    // The replay doesn't change the state of the engine of the caller.
+    Random::seed(12345);
+    const auto game = Game::Replay(record);
+    CHECK_EQ(Random::get_engine()(), expected);
+
+    CHECK_EQ(game->GetStateHash(), record.stateHash);
+    CHECK_EQ(Game::Replay(record)->GetStateHash(), record.stateHash);
+}
+
+TEST_CASE("[GameRecord] - Replay with hero power changes")
+{
+    GameConfig config = MakeConfig();
+    config.player1Class = CardClass::PRIEST;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.player1Deck.fill(Cards::FindCardByID("EX1_625"));
+
+    GameRecorder recorder(config, 3);
+    Game& game = recorder.GetGame();
+    Player* player1 = game.GetPlayer1();
+    const int heroPowerID =
+        player1->GetHero()->heroPower->GetGameTag(GameTag::ENTITY_ID);
+
+    // Player 1 casts Shadowform whenever possible, so the hero power is
+    // replaced several times.
+    for (int i = 0; i < 40 && game.state != State::COMPLETE; ++i)
+    {
+        const auto legalActions = GetLegalActions(game);
+        const bool isPlayer1 = game.GetCurrentPlayer() == player1;
+        const auto iter = std::find_if(
+            legalActions.begin(), legalActions.end(),
+            [isPlayer1](const Action& action) {
+                return isPlayer1 && action.type == ActionType::PLAY_CARD;
+            });
+        recorder.Apply(iter != legalActions.end() ? *iter
+                                                  : legalActions.back());
+    }
+
+    // The hero powers that were replaced are not in the entity list.
+    CHECK_EQ(player1->GetHero()->heroPower->card->id, "EX1_625t");
+    CHECK_EQ(game.entityList.count(heroPowerID), 0);
+
+    const GameRecord record = recorder.GetRecord();
+    const auto replayed = Game::Replay(record);
+    CHECK_EQ(replayed->GetStateHash(), record.stateHash);
+    CHECK_EQ(replayed->GetPlayer1()->GetHero()->heroPower->card->id,
+             "EX1_625t");
+}
+
+TEST_CASE("[GameRecord] - Replay divergence")
+{
+    GameRecord record = PlayGame(5, 40);
+
+    SUBCASE("State hash")
+    {
+        ++record.stateHash;
+        CHECK_THROWS_AS(Game::Replay(record), std::runtime_error);
+    }
+
+    SUBCASE("Card database version")
+    {
+        ++record.cardDatabaseVersion;
+        CHECK_THROWS_AS(Game::Replay(record), std::runtime_error);
+    }
+
+    SUBCASE("Illegal action")
+    {
+        Action action;
+        action.type = ActionType::PLAY_CARD;
+        action.index = MAX_HAND_SIZE;
+        record.actions.emplace_back(action);
+        CHECK_THROWS_AS(Game::Replay(record), std::runtime_error);
+    }
+}
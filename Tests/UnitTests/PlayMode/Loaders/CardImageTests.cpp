@@ -0,0 +1,206 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Common/Macros.hpp>
+#include <Rosetta/Common/StartupProfiler.hpp>
+#include <Rosetta/PlayMode/Cards/CardDatabase.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Loaders/CardImage.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+
+#ifndef ROSETTASTONE_WINDOWS
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[CardImage] - Save and Open")
+{
+    const std::vector<Card*>& cards = Cards::GetInstance().GetAllCards();
+    const std::string path = "CardImageTests.bin";
+
+    CardImage::Save(cards, path);
+
+    CardImage image;
+    image.Open(path);
+
+    CHECK(image.IsOpen());
+    CHECK_EQ(image.GetCount(), cards.size());
+
+    const int idx = image.FindIndexByDbfID(559);
+    REQUIRE(idx >= 0);
+
+    const Card* card = Cards::FindCardByDbfID(559);
+    CHECK_EQ(image.GetString(image.GetRecord(idx).id), card->id);
+    CHECK_EQ(image.GetString(image.GetRecord(idx).name), card->name);
+    CHECK_EQ(image.GetGameTag(idx, GameTag::ATK),
+             card->gameTags.at(GameTag::ATK));
+    CHECK_EQ(image.GetGameTag(idx, GameTag::HEALTH),
+             card->gameTags.at(GameTag::HEALTH));
+    CHECK_EQ(image.FindIndexByDbfID(-1), -1);
+
+    std::vector<Card*> loaded;
+    image.Load(loaded);
+    REQUIRE_EQ(loaded.size(), cards.size());
+
+    for (std::size_t i = 0; i < cards.size(); ++i)
+    {
+        CHECK_EQ(loaded[i]->id, cards[i]->id);
+        CHECK_EQ(loaded[i]->dbfID, cards[i]->dbfID);
+        CHECK_EQ(loaded[i]->text, cards[i]->text);
+        CHECK(loaded[i]->gameTags == cards[i]->gameTags);
+        delete loaded[i];
+    }
+
+    image.Close();
+    CHECK_FALSE(image.IsOpen());
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("[CardImage] - Invalid image")
+{
+    const std::string path = "CardImageTests_Invalid.bin";
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    REQUIRE(file != nullptr);
+    std::fputs("This is not a card image, but a plain text.", file);
+    std::fclose(file);
+
+    CardImage image;
+    CHECK_THROWS(image.Open(path));
+    CHECK_FALSE(image.IsOpen());
+
+    std::remove(path.c_str());
+}
+
+#ifndef ROSETTASTONE_WINDOWS
+TEST_CASE("[CardImage] - Publish and Attach")
+{
+    const std::vector<Card*>& cards = Cards::GetInstance().GetAllCards();
+    const std::string name = "/rosetta-card-image-" + std::to_string(getpid());
+    constexpr int NUM_WORKERS = 4;
+
+    CardImage::Publish(cards, name);
+
+    // The segment may be mapped by workers, so it is never overwritten.
+    CHECK_THROWS_AS(CardImage::Publish(cards, name), std::runtime_error);
+
+    const Card* card = Cards::FindCardByDbfID(559);
+    std::vector<pid_t> workers;
+
+    for (int i = 0; i < NUM_WORKERS; ++i)
+    {
+        const pid_t pid = fork();
+        REQUIRE(pid >= 0);
+
+        if (pid == 0)
+        {
+            // Worker process: reports the result by exit status
+            int status = 0;
+
+            try
+            {
+                CardImage image;
+                image.Attach(name);
+
+                const int idx = image.FindIndexByDbfID(card->dbfID);
+                if (image.GetCount() != cards.size() || idx < 0 ||
+                    image.GetString(image.GetRecord(idx).id) != card->id ||
+                    image.GetGameTag(idx, GameTag::COST) != card->GetCost())
+                {
+                    status = 1;
+                }
+            }
+            catch (...)
+            {
+                status = 2;
+            }
+
+            _exit(status);
+        }
+
+        workers.emplace_back(pid);
+    }
+
+    for (const pid_t pid : workers)
+    {
+        int status = -1;
+        REQUIRE_EQ(waitpid(pid, &status, 0), pid);
+        CHECK(WIFEXITED(status));
+        CHECK_EQ(WEXITSTATUS(status), 0);
+    }
+
+    CardImage::Unpublish(name);
+
+    CardImage image;
+    CHECK_THROWS(image.Attach(name));
+}
+#endif
+
+#ifdef ROSETTASTONE_LINUX
+TEST_CASE("[CardImage] - SetCardImage")
+{
+    constexpr const char* IMAGE_ENV = "ROSETTASTONE_TEST_CARD_IMAGE";
+
+    // NOTE: Cards are loaded only once per process, so this test runs
+    // itself again in a new process, whose main() seeds Cards from the card
+    // image before the first call of Cards::GetInstance().
+    if (std::getenv(IMAGE_ENV) != nullptr)
+    {
+        CHECK_EQ(StartupProfiler::FindPhase("PlayMode::Cards/CardImage::Load")
+                     .numCalls,
+                 1u);
+
+        CardDatabase database;
+        database.Load(RESOURCES_DIR "cards.json");
+
+        REQUIRE_EQ(Cards::GetAllCards().size(),
+                   database.GetAllCards().size());
+        CHECK_EQ(Cards::GetDatabase().GetVersion(), database.GetVersion());
+
+        for (const Card* card : database.GetAllCards())
+        {
+            const Card* loaded = Cards::FindCardByDbfID(card->dbfID);
+            REQUIRE(loaded != nullptr);
+            CHECK_EQ(loaded->id, card->id);
+            CHECK_EQ(loaded->name, card->name);
+            CHECK(loaded->gameTags == card->gameTags);
+            CHECK_EQ(loaded->power.GetTrigger() != nullptr,
+                     card->power.GetTrigger() != nullptr);
+        }
+
+        return;
+    }
+
+    const std::string path = "CardImageTests_Cards.bin";
+    CardImage::Save(Cards::GetAllCards(), path);
+
+    const pid_t pid = fork();
+    REQUIRE(pid >= 0);
+
+    if (pid == 0)
+    {
+        setenv(IMAGE_ENV, path.c_str(), 1);
+        execl("/proc/self/exe", "UnitTests",
+              "--test-case=[CardImage] - SetCardImage", nullptr);
+        _exit(127);
+    }
+
+    int status = -1;
+    REQUIRE_EQ(waitpid(pid, &status, 0), pid);
+    CHECK(WIFEXITED(status));
+    CHECK_EQ(WEXITSTATUS(status), 0);
+
+    std::remove(path.c_str());
+}
+#endif
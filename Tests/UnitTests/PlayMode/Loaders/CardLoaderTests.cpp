@@ -0,0 +1,45 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Common/ThreadPool.hpp>
+#include <Rosetta/PlayMode/Loaders/CardLoader.hpp>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[CardLoader] - Load in parallel")
+{
+    std::vector<Card*> cards;
+    CardLoader::Load(cards);
+
+    std::vector<Card*> parallelCards;
+    {
+        ThreadPool pool(4);
+        CardLoader::Load(parallelCards, &pool);
+    }
+
+    REQUIRE_EQ(cards.size(), parallelCards.size());
+    CHECK(!cards.empty());
+
+    for (std::size_t i = 0; i < cards.size(); ++i)
+    {
+        CHECK_EQ(cards[i]->id, parallelCards[i]->id);
+        CHECK_EQ(cards[i]->dbfID, parallelCards[i]->dbfID);
+        CHECK_EQ(cards[i]->text, parallelCards[i]->text);
+        CHECK(cards[i]->gameTags == parallelCards[i]->gameTags);
+    }
+
+    for (Card* card : cards)
+    {
+        delete card;
+    }
+    for (Card* card : parallelCards)
+    {
+        delete card;
+    }
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Managers/ActionEncoder.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+//! Returns the configuration of games in tests.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::PRIEST;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.skipMulligan = true;
+
+    return config;
+}
+
+//! Checks that the valid play targets of each card in hand of the current
+//! player are found by IsInValidPlayTargets().
+void CheckValidPlayTargets(Game& game)
+{
+    Player* player = game.GetCurrentPlayer();
+    HandZone& hand = *player->GetHandZone();
+
+    for (int i = 0; i < hand.GetCount(); ++i)
+    {
+        const auto targets = hand[i]->GetValidPlayTargets();
+
+        for (int charIdx = 0; charIdx < NUM_CHARACTERS; ++charIdx)
+        {
+            Character* character = GetCharacter(player, charIdx);
+            if (!character)
+            {
+                continue;
+            }
+
+            const bool isInTargets =
+                std::find(targets.begin(), targets.end(), character) !=
+                targets.end();
+            CHECK_EQ(hand[i]->IsInValidPlayTargets(character), isInTargets);
+        }
+    }
+}
+}  // namespace
+
+TEST_CASE("[ActionEncoder] - Encode and Decode")
+{
+    for (std::size_t idx = 0; idx < ActionEncoder::NUM_ACTIONS; ++idx)
+    {
+        CHECK_EQ(ActionEncoder::Encode(ActionEncoder::Decode(idx)), idx);
+    }
+
+    const Action endTurn;
+    const Action playCard{ ActionType::PLAY_CARD, 2, 9, -1, 1 };
+    const Action attack{ ActionType::ATTACK, 1, 8 };
+    CHECK_EQ(ActionEncoder::Encode(endTurn), ActionEncoder::END_TURN_OFFSET);
+    CHECK_EQ(ActionEncoder::Decode(ActionEncoder::Encode(playCard)),
+             playCard);
+    CHECK_EQ(ActionEncoder::Encode(attack),
+             ActionEncoder::ATTACK_OFFSET + ActionEncoder::NUM_SIDE_CHARACTERS);
+
+    const Action withPosition{ ActionType::PLAY_CARD, 0, -1, 2 };
+    const Action ownDefender{ ActionType::ATTACK, 1, 2 };
+    const Action noChoice{ ActionType::CHOOSE, 4 };
+    CHECK_THROWS(ActionEncoder::Encode(withPosition));
+    CHECK_THROWS(ActionEncoder::Encode(ownDefender));
+    CHECK_THROWS(ActionEncoder::Encode(noChoice));
+    CHECK_THROWS(ActionEncoder::Decode(ActionEncoder::NUM_ACTIONS));
+}
+
+TEST_CASE("[ActionEncoder] - WriteMask")
+{
+    Game game(MakeConfig());
+    game.Start();
+
+    std::mt19937 engine(7);
+    std::vector<std::uint8_t> mask(ActionEncoder::NUM_ACTIONS);
+
+    for (int step = 0; step < 300 && game.state != State::COMPLETE; ++step)
+    {
+        CheckValidPlayTargets(game);
+
+        const auto legalActions = GetLegalActions(game);
+        ActionEncoder::WriteMask(game, mask.data());
+
+        std::size_t numLegal = 0;
+        for (const auto legal : mask)
+        {
+            numLegal += legal;
+        }
+        CHECK_EQ(numLegal, legalActions.size());
+
+        for (const auto& action : legalActions)
+        {
+            CHECK_EQ(mask[ActionEncoder::Encode(action)], 1);
+        }
+
+        ApplyAction(game, legalActions[engine() % legalActions.size()]);
+    }
+}
+
+TEST_CASE("[ActionEncoder] - WriteMaskBatch")
+{
+    constexpr std::size_t NUM_GAMES = 5;
+
+    std::vector<std::unique_ptr<Game>> games;
+    std::vector<Game*> gamePtrs;
+    for (std::size_t i = 0; i < NUM_GAMES; ++i)
+    {
+        games.emplace_back(std::make_unique<Game>(MakeConfig()));
+        games.back()->Start();
+        gamePtrs.emplace_back(games.back().get());
+    }
+
+    std::vector<std::uint8_t> expected(NUM_GAMES * ActionEncoder::NUM_ACTIONS);
+    for (std::size_t i = 0; i < NUM_GAMES; ++i)
+    {
+        ActionEncoder::WriteMask(*games[i],
+                                 &expected[i * ActionEncoder::NUM_ACTIONS]);
+    }
+
+    for (std::size_t numThreads : { 1, 3 })
+    {
+        ActionEncoder encoder(numThreads);
+        std::vector<std::uint8_t> masks(expected.size(), 2);
+        encoder.WriteMaskBatch(gamePtrs, masks.data());
+
+        CHECK(masks == expected);
+    }
+}
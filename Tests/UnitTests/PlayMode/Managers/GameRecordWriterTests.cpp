@@ -0,0 +1,112 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Games/GameRecorder.hpp>
+#include <Rosetta/PlayMode/Managers/GameRecordReader.hpp>
+#include <Rosetta/PlayMode/Managers/GameRecordWriter.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+//! Plays a game of random actions and returns its record.
+GameRecord PlayGame(unsigned int seed)
+{
+    GameConfig config;
+    config.player1Class = CardClass::PRIEST;
+    config.player2Class = CardClass::SHAMAN;
+    config.doFillDecks = true;
+
+    GameRecorder recorder(config, seed);
+    Game& game = recorder.GetGame();
+    std::mt19937 engine(seed);
+
+    for (int i = 0; i < 60 && game.state != State::COMPLETE; ++i)
+    {
+        const auto legalActions = GetLegalActions(game);
+        recorder.Apply(legalActions[engine() % legalActions.size()]);
+    }
+
+    return recorder.GetRecord();
+}
+}  // namespace
+
+TEST_CASE("[GameRecordWriter] - Write and read")
+{
+    const std::string path = "GameRecordWriterTests.bin";
+    constexpr unsigned int NUM_GAMES = 5;
+
+    std::vector<GameRecord> records;
+    {
+        GameRecordWriter writer(path);
+        for (unsigned int i = 0; i < NUM_GAMES; ++i)
+        {
+            records.emplace_back(PlayGame(i));
+            writer.Write(records.back());
+        }
+
+        CHECK_EQ(writer.GetNumRecords(), NUM_GAMES);
+        writer.Close();
+        CHECK_THROWS_AS(writer.Write(records[0]), std::runtime_error);
+    }
+
+    GameRecordReader reader(path);
+    GameRecord record;
+    for (const auto& expected : records)
+    {
+        REQUIRE(reader.Read(record));
+        CHECK_EQ(record.seed, expected.seed);
+        CHECK(record.actions == expected.actions);
+        CHECK_EQ(record.stateHash, expected.stateHash);
+        CHECK_EQ(Game::Replay(record)->GetStateHash(), expected.stateHash);
+    }
+    CHECK_FALSE(reader.Read(record));
+    CHECK_EQ(reader.GetNumRecords(), NUM_GAMES);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("[GameRecordWriter] - Partially written record")
+{
+    const std::string path = "GameRecordWriterTests2.bin";
+
+    {
+        GameRecordWriter writer(path);
+        writer.Write(PlayGame(1));
+        writer.Write(PlayGame(2));
+    }
+
+    std::vector<char> bytes;
+    {
+        std::ifstream file(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(),
+                   static_cast<std::streamsize>(bytes.size() - 5));
+    }
+
+    GameRecordReader reader(path);
+    GameRecord record;
+    CHECK(reader.Read(record));
+    CHECK_FALSE(reader.Read(record));
+    CHECK_EQ(reader.GetNumRecords(), 1u);
+
+    std::remove(path.c_str());
+    CHECK_THROWS_AS(GameRecordReader{ path }, std::runtime_error);
+}
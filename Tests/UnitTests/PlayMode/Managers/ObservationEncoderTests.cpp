@@ -0,0 +1,138 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Utils/TestUtils.hpp>
+
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Managers/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Zones/DeckZone.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+using namespace TestUtils;
+
+namespace
+{
+constexpr std::size_t HERO_OFFSET = ObservationEncoder::NUM_PLAYER_FEATURES;
+constexpr std::size_t WEAPON_OFFSET =
+    HERO_OFFSET + ObservationEncoder::NUM_HERO_FEATURES +
+    ObservationEncoder::NUM_HERO_POWER_FEATURES;
+constexpr std::size_t FIELD_OFFSET =
+    WEAPON_OFFSET + ObservationEncoder::NUM_WEAPON_FEATURES;
+
+//! Returns the configuration of games in tests.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    return config;
+}
+}  // namespace
+
+TEST_CASE("[ObservationEncoder] - Encode")
+{
+    Game game(MakeConfig());
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+
+    auto card1 = GenerateMinionCard("minion1", 3, 6);
+    auto card2 = GenerateMinionCard("minion2", 5, 4);
+    auto card3 = GenerateWeaponCard("weapon1", 2, 3);
+    PlayMinionCard(curPlayer, &card1);
+    PlayMinionCard(opPlayer, &card2);
+    PlayWeaponCard(curPlayer, &card3);
+
+    std::vector<float> observation(ObservationEncoder::NUM_FEATURES, -1.0f);
+    ObservationEncoder::Encode(*curPlayer, observation.data());
+
+    CHECK_EQ(observation[ObservationEncoder::GAME_OFFSET], 1.0f);
+
+    const float* player = &observation[ObservationEncoder::PLAYER_OFFSET];
+    CHECK_EQ(player[0], static_cast<float>(CardClass::WARLOCK));
+    CHECK_EQ(player[1], 1.0f);
+    CHECK_EQ(player[2], 1.0f);
+    CHECK_EQ(player[5],
+             static_cast<float>(curPlayer->GetHandZone()->GetCount()));
+    CHECK_EQ(player[6],
+             static_cast<float>(curPlayer->GetDeckZone()->GetCount()));
+    CHECK_EQ(player[8], 1.0f);
+    CHECK_EQ(player[HERO_OFFSET + 1], 30.0f);
+    CHECK_EQ(player[HERO_OFFSET + 3], 2.0f);
+    CHECK_EQ(player[WEAPON_OFFSET], 1.0f);
+    CHECK_EQ(player[WEAPON_OFFSET + 2], 2.0f);
+    CHECK_EQ(player[WEAPON_OFFSET + 3], 3.0f);
+    CHECK_EQ(player[FIELD_OFFSET], 1.0f);
+    CHECK_EQ(player[FIELD_OFFSET + 2], 3.0f);
+    CHECK_EQ(player[FIELD_OFFSET + 3], 6.0f);
+    CHECK_EQ(player[FIELD_OFFSET + ObservationEncoder::NUM_MINION_FEATURES],
+             0.0f);
+
+    const float* opponent = &observation[ObservationEncoder::OPPONENT_OFFSET];
+    CHECK_EQ(opponent[0], static_cast<float>(CardClass::WARRIOR));
+    CHECK_EQ(opponent[8], 0.0f);
+    CHECK_EQ(opponent[WEAPON_OFFSET], 0.0f);
+    CHECK_EQ(opponent[FIELD_OFFSET], 1.0f);
+    CHECK_EQ(opponent[FIELD_OFFSET + 2], 5.0f);
+    CHECK_EQ(opponent[FIELD_OFFSET + 3], 4.0f);
+
+    auto& hand = *curPlayer->GetHandZone();
+    const float* cards = &observation[ObservationEncoder::HAND_OFFSET];
+    for (int i = 0; i < hand.GetCount(); ++i)
+    {
+        CHECK_EQ(cards[0], 1.0f);
+        CHECK_EQ(cards[1], static_cast<float>(hand[i]->card->dbfID));
+        CHECK_EQ(cards[2], static_cast<float>(hand[i]->GetCost()));
+        cards += ObservationEncoder::NUM_HAND_FEATURES;
+    }
+    CHECK_EQ(cards[0], 0.0f);
+}
+
+TEST_CASE("[ObservationEncoder] - EncodeBatch")
+{
+    constexpr std::size_t NUM_GAMES = 5;
+
+    std::vector<std::unique_ptr<Game>> games;
+    std::vector<Game*> gamePtrs;
+    for (std::size_t i = 0; i < NUM_GAMES; ++i)
+    {
+        games.emplace_back(std::make_unique<Game>(MakeConfig()));
+        games.back()->Start();
+        games.back()->ProcessUntil(Step::MAIN_ACTION);
+        gamePtrs.emplace_back(games.back().get());
+    }
+
+    std::vector<float> expected(NUM_GAMES * ObservationEncoder::NUM_FEATURES);
+    for (std::size_t i = 0; i < NUM_GAMES; ++i)
+    {
+        ObservationEncoder::Encode(
+            *games[i]->GetCurrentPlayer(),
+            &expected[i * ObservationEncoder::NUM_FEATURES]);
+    }
+
+    for (std::size_t numThreads : { 1, 3 })
+    {
+        ObservationEncoder encoder(numThreads);
+        std::vector<float> observations(expected.size(), -1.0f);
+        encoder.EncodeBatch(gamePtrs, observations.data());
+
+        CHECK(observations == expected);
+    }
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Managers/TrajectoryFile.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+TEST_CASE("[TrajectoryFile] - Compress and Decompress")
+{
+    constexpr std::size_t NUM_COLUMNS = 37;
+    constexpr std::size_t NUM_ROWS = 300;
+
+    // Rows that change a little and have long zero runs.
+    std::mt19937 engine(3);
+    std::vector<float> rows(NUM_COLUMNS * NUM_ROWS, 0.0f);
+    for (std::size_t i = 0; i < rows.size(); ++i)
+    {
+        if (i % NUM_COLUMNS < 10)
+        {
+            rows[i] = static_cast<float>(engine() % 4);
+        }
+    }
+
+    std::vector<char> compressed;
+    TrajectoryFile::Compress(rows.data(), sizeof(float) * NUM_COLUMNS,
+                             NUM_ROWS, compressed);
+    CHECK(compressed.size() < rows.size() * sizeof(float) / 2);
+
+    std::vector<float> decompressed(rows.size(), -1.0f);
+    TrajectoryFile::Decompress(compressed.data(), compressed.size(),
+                               sizeof(float) * NUM_COLUMNS, NUM_ROWS,
+                               decompressed.data());
+    CHECK(decompressed == rows);
+
+    // Corrupted columns
+    CHECK_THROWS(TrajectoryFile::Decompress(
+        compressed.data(), compressed.size() - 1, sizeof(float) * NUM_COLUMNS,
+        NUM_ROWS, decompressed.data()));
+    CHECK_THROWS(TrajectoryFile::Decompress(
+        compressed.data(), compressed.size(), sizeof(float) * NUM_COLUMNS,
+        NUM_ROWS - 1, decompressed.data()));
+
+    // Empty columns
+    compressed.clear();
+    TrajectoryFile::Compress(rows.data(), sizeof(float), 0, compressed);
+    CHECK(compressed.empty());
+}
@@ -0,0 +1,257 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Managers/TrajectoryReader.hpp>
+#include <Rosetta/PlayMode/Managers/TrajectoryWriter.hpp>
+#include <Rosetta/PlayMode/Managers/VectorEnv.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+constexpr std::size_t NUM_FEATURES = ObservationEncoder::NUM_FEATURES;
+constexpr std::size_t NUM_ACTIONS = ActionEncoder::NUM_ACTIONS;
+
+//! Returns the configuration of games in tests.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::ROGUE;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doFillDecks = true;
+
+    return config;
+}
+
+//! Reads all steps of the trajectory file at \p path.
+TrajectoryChunk ReadAll(const std::string& path)
+{
+    TrajectoryReader reader;
+    reader.Open(path);
+
+    TrajectoryChunk steps;
+    TrajectoryChunk chunk;
+    for (std::size_t i = 0; i < reader.GetNumChunks(); ++i)
+    {
+        reader.ReadChunk(i, chunk);
+        CHECK_EQ(reader.GetNumSteps(i), chunk.numSteps);
+
+        steps.numSteps += chunk.numSteps;
+        steps.observations.insert(steps.observations.end(),
+                                  chunk.observations.begin(),
+                                  chunk.observations.end());
+        steps.envs.insert(steps.envs.end(), chunk.envs.begin(),
+                          chunk.envs.end());
+        steps.actions.insert(steps.actions.end(), chunk.actions.begin(),
+                             chunk.actions.end());
+        steps.actionMasks.insert(steps.actionMasks.end(),
+                                 chunk.actionMasks.begin(),
+                                 chunk.actionMasks.end());
+        steps.rewards.insert(steps.rewards.end(), chunk.rewards.begin(),
+                             chunk.rewards.end());
+        steps.dones.insert(steps.dones.end(), chunk.dones.begin(),
+                           chunk.dones.end());
+    }
+    CHECK_EQ(reader.GetNumSteps(), steps.numSteps);
+
+    return steps;
+}
+}  // namespace
+
+TEST_CASE("[TrajectoryWriter] - Write and read")
+{
+    const std::string path = "TrajectoryWriterTests.bin";
+    constexpr std::size_t NUM_ENVS = 3;
+
+    VectorEnv env(MakeConfig(), NUM_ENVS);
+    env.SetMaxTurns(6);
+    env.Reset(21);
+
+    // Columns that are expected to be read.
+    TrajectoryChunk expected;
+    std::mt19937 engine(4);
+
+    {
+        TrajectoryWriter writer(path, 32);
+
+        for (int step = 0; step < 50; ++step)
+        {
+            std::vector<std::int32_t> actionIndices(NUM_ENVS);
+            std::vector<std::size_t> actions(NUM_ENVS);
+            for (std::size_t envIdx = 0; envIdx < NUM_ENVS; ++envIdx)
+            {
+                const auto& legalActions = env.GetLegalActions(envIdx);
+                actions[envIdx] = ActionEncoder::Encode(
+                    legalActions[engine() % legalActions.size()]);
+                actionIndices[envIdx] =
+                    static_cast<std::int32_t>(actions[envIdx]);
+            }
+
+            const auto observations = env.GetObservations();
+            const auto actionMasks = env.GetActionMasks();
+            env.Step(actions);
+
+            std::vector<float> rewards(NUM_ENVS);
+            for (std::size_t envIdx = 0; envIdx < NUM_ENVS; ++envIdx)
+            {
+                rewards[envIdx] = env.GetRewards()[envIdx * 2];
+                expected.envs.emplace_back(envIdx);
+            }
+
+            writer.AppendBatch(NUM_ENVS, observations.data(),
+                               actionIndices.data(), actionMasks.data(),
+                               rewards.data(), env.GetDones().data());
+
+            expected.numSteps += NUM_ENVS;
+            expected.observations.insert(expected.observations.end(),
+                                         observations.begin(),
+                                         observations.end());
+            expected.actions.insert(expected.actions.end(),
+                                    actionIndices.begin(),
+                                    actionIndices.end());
+            expected.actionMasks.insert(expected.actionMasks.end(),
+                                        actionMasks.begin(),
+                                        actionMasks.end());
+            expected.rewards.insert(expected.rewards.end(), rewards.begin(),
+                                    rewards.end());
+            expected.dones.insert(expected.dones.end(),
+                                  env.GetDones().begin(),
+                                  env.GetDones().end());
+        }
+
+        writer.Flush();
+        CHECK_EQ(writer.GetNumSteps(), expected.numSteps);
+        CHECK(writer.GetNumBytes() <
+              expected.observations.size() * sizeof(float));
+    }
+
+    const TrajectoryChunk steps = ReadAll(path);
+    CHECK_EQ(steps.numSteps, expected.numSteps);
+    CHECK(steps.observations == expected.observations);
+    CHECK(steps.envs == expected.envs);
+    CHECK(steps.actions == expected.actions);
+    CHECK(steps.actionMasks == expected.actionMasks);
+    CHECK(steps.rewards == expected.rewards);
+    CHECK(steps.dones == expected.dones);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("[TrajectoryWriter] - Append from several threads")
+{
+    const std::string path = "TrajectoryWriterTests_Threads.bin";
+    constexpr std::size_t NUM_THREADS = 4;
+    constexpr std::size_t NUM_STEPS = 250;
+
+    const std::vector<float> observation(NUM_FEATURES, 1.0f);
+    const std::vector<std::uint8_t> actionMask(NUM_ACTIONS, 1);
+
+    {
+        // NOTE: A single pending chunk makes appending threads wait for the
+        // background thread, and flushes run while they append.
+        TrajectoryWriter writer(path, 16, 1);
+
+        std::vector<std::thread> threads;
+        threads.emplace_back([&] {
+            for (int i = 0; i < 20; ++i)
+            {
+                writer.Flush();
+            }
+        });
+
+        for (std::size_t i = 0; i < NUM_THREADS; ++i)
+        {
+            threads.emplace_back([&, i] {
+                for (std::size_t step = 0; step < NUM_STEPS; ++step)
+                {
+                    writer.Append(i, observation.data(),
+                                  static_cast<int>(step), actionMask.data(),
+                                  0.0f, false);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        writer.Close();
+        CHECK_EQ(writer.GetNumSteps(), NUM_THREADS * NUM_STEPS);
+        CHECK_THROWS(writer.Append(0, observation.data(), 0,
+                                   actionMask.data(), 0.0f, false));
+    }
+
+    const TrajectoryChunk steps = ReadAll(path);
+    REQUIRE_EQ(steps.numSteps, NUM_THREADS * NUM_STEPS);
+
+    // Steps of each thread keep their order.
+    std::vector<std::int32_t> nextActions(NUM_THREADS, 0);
+    for (std::size_t i = 0; i < steps.numSteps; ++i)
+    {
+        CHECK_EQ(steps.actions[i], nextActions[steps.envs[i]]++);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("[TrajectoryReader] - Partially written file")
+{
+    const std::string path = "TrajectoryWriterTests_Partial.bin";
+
+    const std::vector<float> observation(NUM_FEATURES, 2.0f);
+    const std::vector<std::uint8_t> actionMask(NUM_ACTIONS, 0);
+
+    {
+        TrajectoryWriter writer(path, 10);
+        for (int step = 0; step < 25; ++step)
+        {
+            writer.Append(0, observation.data(), step, actionMask.data(),
+                          1.0f, step % 5 == 4);
+        }
+    }
+
+    // Cut the last chunk in the middle.
+    std::ifstream file(path, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+    file.close();
+
+    std::ofstream truncated(path, std::ios::binary | std::ios::trunc);
+    truncated.write(bytes.data(),
+                    static_cast<std::streamsize>(bytes.size() - 3));
+    truncated.close();
+
+    TrajectoryReader reader;
+    reader.Open(path);
+    CHECK_EQ(reader.GetNumFeatures(), NUM_FEATURES);
+    CHECK_EQ(reader.GetNumActions(), NUM_ACTIONS);
+    CHECK_EQ(reader.GetNumChunks(), 2);
+    CHECK_EQ(reader.GetNumSteps(), 20);
+
+    TrajectoryChunk chunk;
+    reader.ReadChunk(1, chunk);
+    CHECK_EQ(chunk.actions[0], 10);
+    CHECK_EQ(chunk.dones[4], 1);
+    CHECK_EQ(chunk.observations[NUM_FEATURES], 2.0f);
+
+    reader.Close();
+    CHECK_FALSE(reader.IsOpen());
+    CHECK_THROWS(reader.Open("TrajectoryWriterTests_NotFound.bin"));
+
+    std::remove(path.c_str());
+}
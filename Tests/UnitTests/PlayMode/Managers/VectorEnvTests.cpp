@@ -0,0 +1,201 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/PlayMode/Managers/VectorEnv.hpp>
+#include <Rosetta/PlayMode/Models/Player.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+
+namespace
+{
+//! Returns the configuration of games in tests.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::HUNTER;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doFillDecks = true;
+
+    return config;
+}
+
+//! Chooses a legal action of each game with \p engine.
+std::vector<Action> ChooseActions(const VectorEnv& env, std::mt19937& engine)
+{
+    std::vector<Action> actions(env.GetNumEnvs());
+
+    for (std::size_t envIdx = 0; envIdx < env.GetNumEnvs(); ++envIdx)
+    {
+        const auto& legalActions = env.GetLegalActions(envIdx);
+        actions[envIdx] = legalActions[engine() % legalActions.size()];
+    }
+
+    return actions;
+}
+}  // namespace
+
+TEST_CASE("[VectorEnv] - Reset")
+{
+    VectorEnv env(MakeConfig(), 4);
+
+    // The games are not started before the first reset.
+    CHECK_THROWS_AS(env.Step(std::vector<Action>(4, Action{})),
+                    std::logic_error);
+
+    env.Reset(42);
+
+    CHECK_EQ(env.GetNumEnvs(), 4);
+    CHECK_EQ(env.GetRewards().size(), 8);
+
+    for (std::size_t envIdx = 0; envIdx < 4; ++envIdx)
+    {
+        Game& game = env.GetGame(envIdx);
+        CHECK_EQ(game.state, State::RUNNING);
+        CHECK_EQ(game.step, Step::MAIN_ACTION);
+        CHECK_EQ(env.GetTurns()[envIdx], 1);
+        CHECK_EQ(env.GetDones()[envIdx], 0);
+        CHECK_EQ(env.GetCurrentPlayers()[envIdx],
+                 game.GetCurrentPlayer() == game.GetPlayer1() ? 0 : 1);
+        CHECK_EQ(env.GetLegalActions(envIdx).back(), Action{});
+
+        // The legal actions decoded from the mask are those of the game.
+        const auto legalActions = env.GetLegalActions(envIdx);
+        const auto gameActions = GetLegalActions(game);
+        CHECK_EQ(legalActions.size(), gameActions.size());
+        for (const auto& action : gameActions)
+        {
+            CHECK(std::find(legalActions.begin(), legalActions.end(),
+                            action) != legalActions.end());
+        }
+    }
+
+    // Illegal actions
+    std::vector<Action> actions(4, Action{ ActionType::TRADE_CARD, 9 });
+    CHECK_THROWS(env.Step(actions));
+    actions.assign(3, Action{});
+    CHECK_THROWS(env.Step(actions));
+
+    // All players end the first turn.
+    actions.assign(4, Action{});
+    env.Step(actions);
+    for (std::size_t envIdx = 0; envIdx < 4; ++envIdx)
+    {
+        CHECK_EQ(env.GetTurns()[envIdx], 2);
+    }
+}
+
+TEST_CASE("[VectorEnv] - Deterministic with seed")
+{
+    VectorEnv serialEnv(MakeConfig(), 6, 1);
+    VectorEnv parallelEnv(MakeConfig(), 6, 4);
+    serialEnv.SetMaxTurns(8);
+    parallelEnv.SetMaxTurns(8);
+    serialEnv.Reset(11);
+    parallelEnv.Reset(11);
+
+    std::mt19937 engine(13);
+    std::size_t numDones = 0;
+
+    for (int step = 0; step < 300; ++step)
+    {
+        const auto actions = ChooseActions(serialEnv, engine);
+        serialEnv.Step(actions);
+        parallelEnv.Step(actions);
+
+        CHECK(serialEnv.GetCurrentPlayers() ==
+              parallelEnv.GetCurrentPlayers());
+        CHECK(serialEnv.GetTurns() == parallelEnv.GetTurns());
+        CHECK(serialEnv.GetRewards() == parallelEnv.GetRewards());
+        CHECK(serialEnv.GetDones() == parallelEnv.GetDones());
+
+        for (std::size_t envIdx = 0; envIdx < 6; ++envIdx)
+        {
+            CHECK(serialEnv.GetLegalActions(envIdx) ==
+                  parallelEnv.GetLegalActions(envIdx));
+            CHECK_EQ(serialEnv.GetGame(envIdx)
+                         .GetCurrentPlayer()
+                         ->GetHandZone()
+                         ->GetCount(),
+                     parallelEnv.GetGame(envIdx)
+                         .GetCurrentPlayer()
+                         ->GetHandZone()
+                         ->GetCount());
+        }
+
+        for (const auto done : serialEnv.GetDones())
+        {
+            numDones += done;
+        }
+    }
+
+    // Games that are done are restarted automatically.
+    CHECK(numDones > 0);
+}
+
+TEST_CASE("[VectorEnv] - Step with action indices")
+{
+    VectorEnv actionEnv(MakeConfig(), 4);
+    VectorEnv indexEnv(MakeConfig(), 4);
+    actionEnv.Reset(5);
+    indexEnv.Reset(5);
+
+    std::vector<std::size_t> illegalIndices(4, ActionEncoder::NUM_ACTIONS);
+    CHECK_THROWS(indexEnv.Step(illegalIndices));
+
+    std::mt19937 engine(17);
+    std::vector<std::size_t> actionIndices(4);
+
+    for (int step = 0; step < 100; ++step)
+    {
+        const auto actions = ChooseActions(actionEnv, engine);
+        for (std::size_t envIdx = 0; envIdx < 4; ++envIdx)
+        {
+            actionIndices[envIdx] = ActionEncoder::Encode(actions[envIdx]);
+        }
+
+        actionEnv.Step(actions);
+        indexEnv.Step(actionIndices);
+
+        CHECK(actionEnv.GetActionMasks() == indexEnv.GetActionMasks());
+        CHECK(actionEnv.GetObservations() == indexEnv.GetObservations());
+        CHECK(actionEnv.GetRewards() == indexEnv.GetRewards());
+    }
+}
+
+TEST_CASE("[VectorEnv] - Double-buffered outputs")
+{
+    VectorEnv env(MakeConfig(), 3, 2);
+    env.Reset(9);
+
+    const std::size_t bufferIdx = env.GetBufferIndex();
+    const auto& observations = env.GetObservations();
+    const auto& actionMasks = env.GetActionMasks();
+    const std::vector<float> prevObservations = observations;
+
+    std::vector<Action> actions(3, Action{});
+    env.Step(actions);
+
+    // The outputs of the previous call are not overwritten.
+    CHECK_EQ(env.GetBufferIndex(), 1 - bufferIdx);
+    CHECK_NE(env.GetObservations().data(), observations.data());
+    CHECK_NE(env.GetActionMasks().data(), actionMasks.data());
+    CHECK(observations == prevObservations);
+
+    env.Step(actions);
+
+    CHECK_EQ(env.GetBufferIndex(), bufferIdx);
+    CHECK_EQ(env.GetObservations().data(), observations.data());
+    CHECK_EQ(env.GetActionMasks().data(), actionMasks.data());
+}
@@ -0,0 +1,197 @@
+// Copyright (c) 2017-2021 Chris Ohk
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Utils/TestUtils.hpp>
+
+#include <Rosetta/PlayMode/Actions/Draw.hpp>
+#include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Games/Game.hpp>
+#include <Rosetta/PlayMode/Games/GameConfig.hpp>
+#include <Rosetta/PlayMode/Managers/ObservationEncoder.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/EndTurnTask.hpp>
+#include <Rosetta/PlayMode/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/PlayMode/Views/ObservationView.hpp>
+#include <Rosetta/PlayMode/Zones/HandZone.hpp>
+
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayMode;
+using namespace PlayerTasks;
+using namespace TestUtils;
+
+namespace
+{
+//! Returns the configuration of games in tests.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::ROGUE;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    return config;
+}
+
+//! Returns the number of cards in hand that \p view can see.
+int CountVisibleHandCards(const PlayerView& view)
+{
+    int count = 0;
+    view.ForEachHandCard([&](const EntityView* card) {
+        if (card)
+        {
+            ++count;
+        }
+    });
+
+    return count;
+}
+}  // namespace
+
+TEST_CASE("[ObservationView] - Hand")
+{
+    Game game(MakeConfig());
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+
+    const ObservationView view(*curPlayer);
+    const PlayerView player = view.GetPlayer();
+    const PlayerView opponent = view.GetOpponent();
+
+    CHECK_EQ(player.GetPlayerType(), PlayerType::PLAYER1);
+    CHECK_EQ(opponent.GetPlayerType(), PlayerType::PLAYER2);
+    CHECK(player.IsCurrentPlayer());
+    CHECK_FALSE(opponent.IsCurrentPlayer());
+
+    CHECK_EQ(player.GetHandCount(), curPlayer->GetHandZone()->GetCount());
+    CHECK_EQ(opponent.GetHandCount(), opPlayer->GetHandZone()->GetCount());
+    CHECK_EQ(CountVisibleHandCards(player), player.GetHandCount());
+    CHECK_EQ(CountVisibleHandCards(opponent), 0);
+
+    auto& hand = *curPlayer->GetHandZone();
+    int pos = 0;
+    player.ForEachHandCard([&](const EntityView* card) {
+        CHECK_EQ(card->GetID(), hand[pos]->GetGameTag(GameTag::ENTITY_ID));
+        ++pos;
+    });
+}
+
+TEST_CASE("[ObservationView] - Bounced Card")
+{
+    Game game(MakeConfig());
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+    opPlayer->SetTotalMana(10);
+    opPlayer->SetUsedMana(0);
+
+    const auto card1 =
+        Generic::DrawCard(opPlayer, Cards::FindCardByName("Wisp"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Sap"));
+
+    game.Process(curPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    game.Process(opPlayer, PlayCardTask::Minion(card1));
+    CHECK_EQ(ObservationView(*curPlayer).GetOpponent().GetNumMinions(), 1);
+
+    game.Process(opPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    game.Process(curPlayer, PlayCardTask::SpellTarget(card2, card1));
+
+    const PlayerView opponent = ObservationView(*curPlayer).GetOpponent();
+    CHECK_EQ(opponent.GetNumMinions(), 0);
+    CHECK_EQ(CountVisibleHandCards(opponent), 1);
+
+    opponent.ForEachHandCard([&](const EntityView* card) {
+        if (card)
+        {
+            CHECK_EQ(card->GetID(), card1->GetGameTag(GameTag::ENTITY_ID));
+            CHECK_EQ(card->GetCard().name, "Wisp");
+        }
+    });
+}
+
+TEST_CASE("[ObservationView] - Secret")
+{
+    Game game(MakeConfig());
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+    opPlayer->SetTotalMana(10);
+    opPlayer->SetUsedMana(0);
+
+    const auto card1 =
+        Generic::DrawCard(opPlayer, Cards::FindCardByName("Counterspell"));
+
+    game.Process(curPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    game.Process(opPlayer, PlayCardTask::Spell(card1));
+
+    const PlayerView opponent = ObservationView(*curPlayer).GetOpponent();
+    CHECK_EQ(opponent.GetSecretCount(), 1);
+    opponent.ForEachSecret([](const EntityView* secret, CardClass cardClass) {
+        CHECK(secret == nullptr);
+        CHECK_EQ(cardClass, CardClass::MAGE);
+    });
+
+    int numPlayedCards = 0;
+    opponent.ForEachPlayedCard([&](const PlayedCard& playedCard) {
+        CHECK(playedCard.card == nullptr);
+        ++numPlayedCards;
+    });
+    CHECK_EQ(numPlayedCards, 1);
+
+    const PlayerView player = ObservationView(*opPlayer).GetPlayer();
+    player.ForEachSecret([&](const EntityView* secret, CardClass) {
+        CHECK_EQ(secret->GetID(), card1->GetGameTag(GameTag::ENTITY_ID));
+    });
+    player.ForEachPlayedCard([&](const PlayedCard& playedCard) {
+        CHECK_EQ(playedCard.card, card1->card);
+    });
+}
+
+TEST_CASE("[ObservationView] - Encode")
+{
+    Game game(MakeConfig());
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+
+    auto card1 = GenerateMinionCard("minion1", 3, 6);
+    auto card2 = GenerateMinionCard("minion2", 5, 4);
+    PlayMinionCard(curPlayer, &card1);
+    PlayMinionCard(opPlayer, &card2);
+
+    std::vector<float> expected(ObservationEncoder::NUM_FEATURES, -1.0f);
+    ObservationEncoder::Encode(*curPlayer, expected.data());
+
+    std::vector<float> observation(ObservationEncoder::NUM_FEATURES, -1.0f);
+    ObservationEncoder::Encode(ObservationView(*curPlayer),
+                               observation.data());
+
+    CHECK(observation == expected);
+}
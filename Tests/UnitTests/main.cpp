@@ -9,12 +9,24 @@
 
 #include <Rosetta/Battlegrounds/Cards/Cards.hpp>
 #include <Rosetta/PlayMode/Cards/Cards.hpp>
+#include <Rosetta/PlayMode/Loaders/CardImage.hpp>
+
+#include <cstdlib>
 
 using namespace RosettaStone;
 
-int main()
+int main(int argc, char* argv[])
 {
-    doctest::Context context;
+    doctest::Context context(argc, argv);
+
+    // NOTE: "[CardImage] - SetCardImage" runs itself in a child process that
+    // loads cards from the card image in this variable.
+    PlayMode::CardImage cardImage;
+    if (const char* path = std::getenv("ROSETTASTONE_TEST_CARD_IMAGE"))
+    {
+        cardImage.Open(path);
+        PlayMode::Cards::SetCardImage(&cardImage);
+    }
 
     PlayMode::Cards::GetInstance();
     Battlegrounds::Cards::GetInstance();